@@ -2,11 +2,20 @@
 #include "impl_org_webRtc_AudioTrackSource.h"
 #include "impl_org_webRtc_helpers.h"
 #include "impl_org_webRtc_AudioOptions.h"
+#include "impl_org_webRtc_AudioData.h"
+#include "impl_org_webRtc_AudioTrackSourcePushOptions.h"
+#include "impl_org_webRtc_AudioTrackSourcePushStats.h"
 #include "impl_org_webRtc_MediaConstraints.h"
+#include "impl_org_webRtc_RTCError.h"
 #include "impl_org_webRtc_WebRtcLib.h"
 #include "impl_org_webRtc_WebRtcFactory.h"
 #include "impl_org_webRtc_enums.h"
 
+#include <zsLib/SafeInt.h>
+
+#include <limits>
+#include <sstream>
+
 //#include "impl_org_webRtc_pre_include.h"
 //#include "impl_org_webRtc_post_include.h"
 
@@ -41,7 +50,11 @@ typedef wrapper::impl::org::webRtc::WrapperMapper<NativeType, WrapperImplType> U
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::WebRtcLib, UseWebrtcLib);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaConstraints, UseMediaConstraints);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioOptions, UseAudioOptions);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioData, UseAudioData);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushOptions, UseAudioTrackSourcePushOptions);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushStats, UseAudioTrackSourcePushStats);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCError, UseError);
 
 //------------------------------------------------------------------------------
 static UseWrapperMapper &mapperSingleton()
@@ -109,6 +122,25 @@ wrapper::org::webRtc::AudioTrackSourcePtr wrapper::org::webRtc::AudioTrackSource
   return result;
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::AudioTrackSourcePtr wrapper::org::webRtc::AudioTrackSource::createPushSource(wrapper::org::webRtc::AudioTrackSourcePushOptionsPtr options) noexcept
+{
+  auto factoryImpl = UseWebRtcFactory::toWrapper(options ? options->factory : nullptr);
+  ZS_ASSERT(factoryImpl);
+  if (!factoryImpl) return WrapperTypePtr();
+
+  auto converted = UseAudioTrackSourcePushOptions::toNative(options);
+  ZS_ASSERT(converted);
+  if (!converted) return WrapperTypePtr();
+
+  auto native = ::webrtc::PushAudioSource::create(*converted);
+  if (!native) return WrapperTypePtr();
+
+  auto result = WrapperImplType::toWrapper(native.get());
+  result->factory_ = factoryImpl;
+  return result;
+}
+
 //------------------------------------------------------------------------------
 void wrapper::impl::org::webRtc::AudioTrackSource::wrapper_onObserverCountChanged(ZS_MAYBE_USED() size_t count) noexcept
 {
@@ -148,6 +180,67 @@ void wrapper::impl::org::webRtc::AudioTrackSource::set_volume(double value) noex
   native_->SetVolume(value);
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::AudioTrackSourcePushStatsPtr wrapper::impl::org::webRtc::AudioTrackSource::get_pushStats() noexcept
+{
+  auto source = pushSource();
+  if (!source) return wrapper::org::webRtc::AudioTrackSourcePushStatsPtr();
+  return UseAudioTrackSourcePushStats::toWrapper(source->stats());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::AudioTrackSource::pushAudioData(
+  wrapper::org::webRtc::AudioDataPtr data,
+  uint64_t sampleRate,
+  uint64_t channels
+  ) noexcept(false)
+{
+  auto source = pushSource();
+  if (!source) {
+    throw UseError::toWrapper(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_STATE, "audio track source was not created with createPushSource"));
+  }
+
+  auto dataImpl = UseAudioData::toWrapper(data);
+  if (!dataImpl) {
+    throw UseError::toWrapper(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_PARAMETER, "no audio data to push"));
+  }
+
+  if ((0 == channels) ||
+      (0 != (dataImpl->size() % channels))) {
+    std::stringstream ss;
+    ss << "pushed audio of " << dataImpl->size() << " samples is not a whole number of frames of " << channels << " channels";
+    throw UseError::toWrapper(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_PARAMETER, ss.str()));
+  }
+
+  // the samples are consumed in place from the caller's buffer
+  if ((sampleRate > static_cast<uint64_t>(std::numeric_limits<int>::max())) ||
+      (!source->pushAudio(
+         dataImpl->data(),
+         SafeInt<size_t>(dataImpl->size() / channels),
+         static_cast<int>(sampleRate),
+         SafeInt<size_t>(channels)
+       ))) {
+    std::stringstream ss;
+    ss << "pushed audio format not supported, rate: " << sampleRate << ", channels: " << channels;
+    throw UseError::toWrapper(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_PARAMETER, ss.str()));
+  }
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::AudioTrackSource::pushAudioData(
+  const float *interleaved,
+  size_t samplesPerChannel,
+  int sampleRate,
+  size_t channels
+  ) noexcept
+{
+  auto source = pushSource();
+  ZS_ASSERT(source);
+  if (!source) return false;
+
+  return source->pushAudio(interleaved, samplesPerChannel, sampleRate, channels);
+}
+
 //------------------------------------------------------------------------------
 void WrapperImplType::onWebrtcObserverSetVolume(double volume) noexcept
 {
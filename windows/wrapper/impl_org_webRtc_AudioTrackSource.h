@@ -9,6 +9,8 @@
 #include "api/mediastreaminterface.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include "impl_webrtc_PushAudioSource.h"
+
 #include <zsLib/IMessageQueue.h>
 
 namespace wrapper {
@@ -64,6 +66,21 @@ namespace wrapper {
           // properties AudioTrackSource
           double get_volume() noexcept override;
           void set_volume(double value) noexcept override;
+          wrapper::org::webRtc::AudioTrackSourcePushStatsPtr get_pushStats() noexcept override;
+
+          // methods AudioTrackSource
+          void pushAudioData(
+            wrapper::org::webRtc::AudioDataPtr data,
+            uint64_t sampleRate,
+            uint64_t channels
+            ) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
+
+          bool pushAudioData(
+            const float *interleaved,
+            size_t samplesPerChannel,
+            int sampleRate,
+            size_t channels
+            ) noexcept;
 
           void wrapper_onObserverCountChanged(size_t count) noexcept override;
 
@@ -74,6 +91,7 @@ namespace wrapper {
           void onWebrtcObserverSetVolume(double volume) noexcept;
 
           UseWebRtcFactoryPtr factory() noexcept { return factory_; }
+          ::webrtc::PushAudioSource *pushSource() noexcept { return dynamic_cast<::webrtc::PushAudioSource *>(native_.get()); }
 
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeType *native) noexcept;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeTypeScopedPtr native) noexcept;
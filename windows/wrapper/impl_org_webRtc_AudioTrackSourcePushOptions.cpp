@@ -0,0 +1,69 @@
+#include "impl_org_webRtc_AudioTrackSourcePushOptions.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushOptions::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::AudioTrackSourcePushOptions::AudioTrackSourcePushOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::AudioTrackSourcePushOptionsPtr wrapper::org::webRtc::AudioTrackSourcePushOptions::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::AudioTrackSourcePushOptions>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::AudioTrackSourcePushOptions::~AudioTrackSourcePushOptions() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::AudioTrackSourcePushOptions::wrapper_init_org_webRtc_AudioTrackSourcePushOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->sampleRateHz_ = SafeInt<decltype(result->sampleRateHz_)>(wrapper->sampleRate);
+  result->channels_ = SafeInt<decltype(result->channels_)>(wrapper->channels);
+
+  // the queue is measured in whole 10ms frames
+  if (::zsLib::Milliseconds() != wrapper->maxQueueDuration) {
+    result->maxQueuedFrames_ = SafeInt<decltype(result->maxQueuedFrames_)>((wrapper->maxQueueDuration.count() + 9) / 10);
+  }
+  if (::zsLib::Milliseconds() != wrapper->prebufferDuration) {
+    result->prebufferFrames_ = SafeInt<decltype(result->prebufferFrames_)>((wrapper->prebufferDuration.count() + 9) / 10);
+  }
+  return result;
+}
@@ -0,0 +1,32 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_AudioTrackSourcePushOptions.h"
+
+#include "impl_webrtc_PushAudioSource.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct AudioTrackSourcePushOptions : public wrapper::org::webRtc::AudioTrackSourcePushOptions
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::AudioTrackSourcePushOptions, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushOptions, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::PushAudioSource::CreationProperties, NativeType);
+
+          AudioTrackSourcePushOptionsWeakPtr thisWeak_;
+
+          AudioTrackSourcePushOptions() noexcept;
+          virtual ~AudioTrackSourcePushOptions() noexcept;
+          void wrapper_init_org_webRtc_AudioTrackSourcePushOptions() noexcept override;
+
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
@@ -0,0 +1,65 @@
+#include "impl_org_webRtc_AudioTrackSourcePushStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::AudioTrackSourcePushStats::AudioTrackSourcePushStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::AudioTrackSourcePushStatsPtr wrapper::org::webRtc::AudioTrackSourcePushStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::AudioTrackSourcePushStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::AudioTrackSourcePushStats::~AudioTrackSourcePushStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::AudioTrackSourcePushStats::wrapper_init_org_webRtc_AudioTrackSourcePushStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->queuedDuration = ::zsLib::Milliseconds(SafeInt<::zsLib::Milliseconds::rep>(native.queuedFrames_ * 10));
+  result->pushedSamples = SafeInt<decltype(result->pushedSamples)>(native.pushedSamples_);
+  result->deliveredFrames = SafeInt<decltype(result->deliveredFrames)>(native.deliveredFrames_);
+  result->silentFrames = SafeInt<decltype(result->silentFrames)>(native.silentFrames_);
+  result->underruns = SafeInt<decltype(result->underruns)>(native.underruns_);
+  result->overflows = SafeInt<decltype(result->overflows)>(native.overflows_);
+  result->rejectedPushes = SafeInt<decltype(result->rejectedPushes)>(native.rejectedPushes_);
+  return result;
+}
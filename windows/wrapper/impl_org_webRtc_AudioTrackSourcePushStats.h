@@ -0,0 +1,33 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_AudioTrackSourcePushStats.h"
+
+#include "impl_webrtc_PushAudioSource.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct AudioTrackSourcePushStats : public wrapper::org::webRtc::AudioTrackSourcePushStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::AudioTrackSourcePushStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::AudioTrackSourcePushStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::PushAudioSource::Stats, NativeType);
+
+          AudioTrackSourcePushStatsWeakPtr thisWeak_;
+
+          AudioTrackSourcePushStats() noexcept;
+          virtual ~AudioTrackSourcePushStats() noexcept;
+
+          void wrapper_init_org_webRtc_AudioTrackSourcePushStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
@@ -0,0 +1,126 @@
+
+#include "impl_org_webRtc_ByteBuffer.h"
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::ByteBuffer::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+typedef WrapperImplType::NativeType NativeType;
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::ByteBuffer::ByteBuffer() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr wrapper::org::webRtc::ByteBuffer::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::ByteBuffer>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::ByteBuffer::~ByteBuffer() noexcept
+{
+  thisWeak_.reset();
+  wrapper_dispose();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::ByteBuffer::wrapper_dispose() noexcept
+{
+  native_ = NativeType();
+  readOnly_ = false;
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::ByteBuffer::wrapper_init_org_webRtc_ByteBuffer() noexcept
+{
+  wrapper_dispose();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::ByteBuffer::wrapper_init_org_webRtc_ByteBuffer(size_t size) noexcept
+{
+  wrapper_dispose();
+  if (size < 1)
+    return;
+
+  native_ = NativeType(size);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::ByteBuffer::get_readOnly() noexcept
+{
+  return readOnly_;
+}
+
+//------------------------------------------------------------------------------
+const uint8_t * wrapper::impl::org::webRtc::ByteBuffer::get_data() noexcept
+{
+  const NativeType &native = native_;
+  return native.cdata();
+}
+
+//------------------------------------------------------------------------------
+uint8_t * wrapper::impl::org::webRtc::ByteBuffer::get_mutableData() noexcept
+{
+  if (readOnly_)
+    return nullptr;
+  return native_.data();
+}
+
+//------------------------------------------------------------------------------
+size_t wrapper::impl::org::webRtc::ByteBuffer::get_size() noexcept
+{
+  return native_.size();
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(
+  const NativeType &native,
+  bool readOnly) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->native_ = native;
+  result->readOnly_ = readOnly;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper)
+    return {};
+
+  auto converted = ZS_DYNAMIC_PTR_CAST(WrapperImplType, wrapper);
+  return converted;
+}
+
+//------------------------------------------------------------------------------
+NativeType WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  auto converted = toWrapper(wrapper);
+  if (!converted)
+    return NativeType();
+  return converted->native_;
+}
@@ -0,0 +1,55 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_ByteBuffer.h"
+
+#include "impl_org_webRtc_pre_include.h"
+#include "rtc_base/copyonwritebuffer.h"
+#include "impl_org_webRtc_post_include.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct ByteBuffer : public wrapper::org::webRtc::ByteBuffer
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::ByteBuffer, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::ByteBuffer, WrapperImplType);
+          typedef rtc::CopyOnWriteBuffer NativeType;
+
+          // the bytes are shared with the native buffer; writing to a buffer
+          // that is still shared (e.g. queued for sending) detaches a private
+          // copy first so the shared bytes never change underneath a reader
+          ByteBufferWeakPtr thisWeak_;
+          NativeType native_;
+          bool readOnly_ {};
+
+          ByteBuffer() noexcept;
+          virtual ~ByteBuffer() noexcept;
+          void wrapper_dispose() noexcept override;
+
+
+          // methods ByteBuffer
+          void wrapper_init_org_webRtc_ByteBuffer() noexcept override;
+          void wrapper_init_org_webRtc_ByteBuffer(size_t size) noexcept override;
+
+          // properties ByteBuffer
+          bool get_readOnly() noexcept override;
+          const uint8_t *get_data() noexcept override;
+          uint8_t *get_mutableData() noexcept override;
+
+          size_t get_size() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(
+            const NativeType &native,
+            bool readOnly = true) noexcept;
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(WrapperTypePtr wrapper) noexcept;
+          ZS_NO_DISCARD() static NativeType toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
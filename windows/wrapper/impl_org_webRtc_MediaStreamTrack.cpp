@@ -10,6 +10,12 @@
 #include "impl_org_webRtc_helpers.h"
 #include "impl_org_webRtc_MediaElement.h"
 #include "impl_org_webRtc_MediaSource.h"
+#include "impl_org_webRtc_MediaStreamTrackRenderOptions.h"
+#include "impl_org_webRtc_MediaStreamTrackRenderStats.h"
+#include "impl_org_webRtc_VideoSinkWants.h"
+#include "impl_org_webRtc_MediaStreamTrackVideoFrameOptions.h"
+#include "impl_org_webRtc_MediaStreamTrackVideoFrameStats.h"
+#include "impl_org_webRtc_MediaStreamTrackLatencyStats.h"
 #include "impl_org_webRtc_MediaConstraints.h"
 #include "impl_org_webRtc_AudioTrackSource.h"
 #include "impl_org_webRtc_VideoTrackSource.h"
@@ -25,8 +31,11 @@
 #include "api/mediastreamtrackproxy.h"
 #include "api/peerconnectioninterface.h"
 #include "third_party/winuwp_h264/native_handle_buffer.h"
+#include "rtc_base/timeutils.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include <algorithm>
+
 using ::zsLib::String;
 using ::zsLib::Optional;
 using ::zsLib::Any;
@@ -62,6 +71,12 @@ ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoTrackSource, UseVideoTra
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBuffer, UseVideoFrameBuffer);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBufferEvent, UseVideoFrameBufferEvent);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions, UseRenderOptions);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderStats, UseRenderStats);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoSinkWants, UseVideoSinkWants);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions, UseVideoFrameOptions);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats, UseVideoFrameStats);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats, UseLatencyStats);
 
 //------------------------------------------------------------------------------
 static UseWrapperMapper &mapperSingleton()
@@ -90,6 +105,42 @@ static ::webrtc::VideoTrackInterface *unproxyVideoTrack(NativeType *native)
   return WRAPPER_DEPROXIFY_CLASS(::webrtc::VideoTrack, ::webrtc::VideoTrack, converted);
 }
 
+//------------------------------------------------------------------------------
+static ::rtc::VideoSinkWants aggregateSinkWants(
+                                                const std::map<uint64_t, ::rtc::VideoSinkWants> &allWants,
+                                                bool includeUnconstrained
+                                                )
+{
+  // the track has a single sink feeding every consumer so it must ask for
+  // enough to satisfy the most demanding one, which is any consumer taking
+  // the default unconstrained wants
+  ::rtc::VideoSinkWants result;
+  if (allWants.size() < 1) return result;
+
+  bool allHaveTarget = !includeUnconstrained;
+  int maxTarget = 0;
+
+  if (!includeUnconstrained) {
+    result.max_pixel_count = 0;
+    result.max_framerate_fps = 0;
+  }
+
+  for (auto &iter : allWants) {
+    auto &wants = iter.second;
+    result.max_pixel_count = std::max(result.max_pixel_count, wants.max_pixel_count);
+    result.max_framerate_fps = std::max(result.max_framerate_fps, wants.max_framerate_fps);
+    result.rotation_applied = result.rotation_applied || wants.rotation_applied;
+    if (wants.target_pixel_count) {
+      maxTarget = std::max(maxTarget, *wants.target_pixel_count);
+    } else {
+      allHaveTarget = false;
+    }
+  }
+
+  if (allHaveTarget) result.target_pixel_count = std::min(maxTarget, result.max_pixel_count);
+  return result;
+}
+
 #ifdef CPPWINRT_VERSION
 //------------------------------------------------------------------------------
 static void notifyAboutNewMediaSource(WrapperImplType &wrapper, winrt::Windows::Media::Core::IMediaSource const & newSource)
@@ -102,7 +153,9 @@ static void notifyAboutNewMediaSource(WrapperImplType &wrapper, winrt::Windows::
 
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::MediaStreamTrack::MediaStreamTrack() noexcept :
-  videoFrameProcessingQueue_(UseWebrtcLib::videoFrameProcessingQueue())
+  videoFrameProcessingQueue_(UseWebrtcLib::videoFrameProcessingQueue()),
+  videoFrameThrottle_(::webrtc::VideoFrameThrottle::create()),
+  latencyProbe_(::webrtc::VideoLatencyProbe::create())
 {
 }
 
@@ -251,20 +304,145 @@ void wrapper::impl::org::webRtc::MediaStreamTrack::set_element(wrapper::org::web
     zsLib::AutoLock lock(lock_);
     element_ = value;
   }
+  hasElement_ = (bool)value;
 
+  updateSinkAttachment();
   autoAttachSourceToElement();
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackRenderOptionsPtr wrapper::impl::org::webRtc::MediaStreamTrack::get_renderOptions() noexcept
+{
+  zsLib::AutoLock lock(lock_);
+  return UseRenderOptions::toWrapper(renderOptions_);
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrack::set_renderOptions(wrapper::org::webRtc::MediaStreamTrackRenderOptionsPtr value) noexcept
+{
+  auto native = UseRenderOptions::toNative(value);
+
+  {
+    zsLib::AutoLock lock(lock_);
+    renderOptions_ = (native ? *native : ::webrtc::RenderFrameQueueTypes::Options{});
+  }
+
+  // the queue is fixed for the lifetime of a media source so a new source
+  // is created when the next frame arrives
+  renderOptionsChanged_ = true;
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackRenderStatsPtr wrapper::impl::org::webRtc::MediaStreamTrack::get_renderStats() noexcept
+{
+  ::webrtc::RenderFrameQueueTypes::Stats stats;
+
+#ifdef CPPWINRT_VERSION
+  {
+    zsLib::AutoLock lock(lock_);
+    if (mediaStreamSource_) stats = mediaStreamSource_->queueStats();
+  }
+#endif // CPPWINRT_VERSION
+
+  return UseRenderStats::toWrapper(stats);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackVideoFrameOptionsPtr wrapper::impl::org::webRtc::MediaStreamTrack::get_videoFrameOptions() noexcept
+{
+  return UseVideoFrameOptions::toWrapper(videoFrameThrottle_->options());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrack::set_videoFrameOptions(wrapper::org::webRtc::MediaStreamTrackVideoFrameOptionsPtr value) noexcept
+{
+  auto native = UseVideoFrameOptions::toNative(value);
+  videoFrameThrottle_->setOptions(native ? *native : ::webrtc::VideoFrameThrottle::Options{});
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackVideoFrameStatsPtr wrapper::impl::org::webRtc::MediaStreamTrack::get_videoFrameStats() noexcept
+{
+  return UseVideoFrameStats::toWrapper(videoFrameThrottle_->stats());
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::MediaStreamTrack::get_latencyProbe() noexcept
+{
+  return latencyProbe_->enabled();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrack::set_latencyProbe(bool value) noexcept
+{
+  latencyProbe_->setEnabled(value);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackLatencyStatsPtr wrapper::impl::org::webRtc::MediaStreamTrack::get_latencyStats() noexcept
+{
+  return UseLatencyStats::toWrapper(latencyProbe_->stats(UseWebrtcLib::ntpOffset().count()));
+}
+
+//------------------------------------------------------------------------------
+uint64_t wrapper::impl::org::webRtc::MediaStreamTrack::addVideoSinkWants(wrapper::org::webRtc::VideoSinkWantsPtr wants) noexcept
+{
+  auto native = UseVideoSinkWants::toNative(wants);
+
+  uint64_t id {};
+
+  {
+    zsLib::AutoLock lock(sinkLock_);
+    id = nextSinkWantsId_++;
+    sinkWants_[id] = (native ? *native : ::rtc::VideoSinkWants{});
+  }
+
+  updateSinkAttachment(true);
+  return id;
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::MediaStreamTrack::updateVideoSinkWants(
+                                                                        uint64_t id,
+                                                                        wrapper::org::webRtc::VideoSinkWantsPtr wants
+                                                                        ) noexcept
+{
+  auto native = UseVideoSinkWants::toNative(wants);
+
+  {
+    zsLib::AutoLock lock(sinkLock_);
+    auto found = sinkWants_.find(id);
+    if (found == sinkWants_.end()) return false;
+    found->second = (native ? *native : ::rtc::VideoSinkWants{});
+  }
+
+  updateSinkAttachment(true);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrack::removeVideoSinkWants(uint64_t id) noexcept
+{
+  {
+    zsLib::AutoLock lock(sinkLock_);
+    if (0 == sinkWants_.erase(id)) return;
+  }
+
+  updateSinkAttachment(true);
+}
+
 //------------------------------------------------------------------------------
 void wrapper::impl::org::webRtc::MediaStreamTrack::wrapper_onObserverCountChanged(size_t count) noexcept
 {
   hasObservers_ = (count > 0);
+  updateSinkAttachment();
 }
 
 //------------------------------------------------------------------------------
 void wrapper::impl::org::webRtc::MediaStreamTrack::wrapper_onObserveronVideoFrameCountChanged(size_t count) noexcept
 {
   hasVideoFrameObservers_ = (count > 0);
+  updateSinkAttachment();
 }
 
 //------------------------------------------------------------------------------
@@ -334,23 +512,10 @@ void WrapperImplType::setupObserver() noexcept
   if (!native_) return;
 
   auto converted = dynamic_cast<::webrtc::VideoTrackInterface *>(native_.get());
-  if (converted) {
-    if (!converted) return;
-
-    videoObserver_ = std::make_shared<WebrtcVideoObserver>(thisWeak_.lock(), UseWebrtcLib::delegateQueue());
+  if (!converted) return;
 
-    rtc::VideoSinkWants wants;
-
-#pragma ZS_BUILD_NOTE("TODO","(mosa) you may want to tweak these properties -- not sure")
-
-    // wants.rotation_applied = ;
-    // wants.black_frames = ;
-    // wants.max_pixel_count = ;
-    // wants.target_pixel_count = ;
-    // wants.max_framerate_fps = ;
-
-    converted->AddOrUpdateSink(videoObserver_.get(), wants);
-  }
+  // the sink is only attached once something consumes the frames
+  videoObserver_ = std::make_shared<WebrtcVideoObserver>(thisWeak_.lock(), UseWebrtcLib::delegateQueue());
 }
 
 //------------------------------------------------------------------------------
@@ -358,16 +523,73 @@ void WrapperImplType::teardownObserver() noexcept
 {
   if (!native_) return;
 
+  zsLib::AutoLock lock(sinkLock_);
+
   if (videoObserver_) {
     auto converted = dynamic_cast<::webrtc::VideoTrackInterface *>(native_.get());
     ZS_ASSERT(converted);
     if (!converted) return;
 
-    converted->RemoveSink(videoObserver_.get());
+    if (sinkAttached_) {
+      converted->RemoveSink(videoObserver_.get());
+      sinkAttached_ = false;
+    }
     videoObserver_.reset();
   }
 }
 
+//------------------------------------------------------------------------------
+void WrapperImplType::updateSinkAttachment(bool wantsChanged) noexcept
+{
+  zsLib::AutoLock lock(sinkLock_);
+
+  if (!native_) return;
+  if (!videoObserver_) return;
+
+  auto converted = dynamic_cast<::webrtc::VideoTrackInterface *>(native_.get());
+  if (!converted) return;
+
+  // the element and frame observers take frames as they come and register
+  // no wants, so they count as consumers asking for full quality
+  bool unconstrained = hasElement_ || hasVideoFrameObservers_;
+  bool needSink = hasElement_ || hasObservers_ || hasVideoFrameObservers_;
+  if (unconstrained != sinkUnconstrained_) wantsChanged = true;
+  if ((needSink == sinkAttached_) && ((!needSink) || (!wantsChanged))) return;
+
+  if (needSink) {
+    // the video broadcaster upstream combines these with the wants of every
+    // other sink of the source before adapting capture or encoding
+    converted->AddOrUpdateSink(videoObserver_.get(), aggregateSinkWants(sinkWants_, unconstrained));
+    sinkAttached_ = true;
+    sinkUnconstrained_ = unconstrained;
+    return;
+  }
+
+  // no frame is being delivered once RemoveSink returns
+  converted->RemoveSink(videoObserver_.get());
+  sinkAttached_ = false;
+
+  releaseMediaStreamSource();
+}
+
+//------------------------------------------------------------------------------
+void WrapperImplType::releaseMediaStreamSource() noexcept
+{
+#ifdef CPPWINRT_VERSION
+  zsLib::AutoLock lock(lock_);
+
+  if (!mediaStreamSource_) return;
+
+  if (subscription_) subscription_->cancel();
+  subscription_.reset();
+  mediaStreamSource_.reset();
+  source_.reset();
+
+  // a new media source is created when frames are wanted again
+  firstFrameReceived_ = false;
+#endif // CPPWINRT_VERSION
+}
+
 //------------------------------------------------------------------------------
 void WrapperImplType::notifyWebrtcObserverFrame(const ::webrtc::VideoFrame& frame) noexcept
 {
@@ -377,6 +599,9 @@ void WrapperImplType::notifyWebrtcObserverFrame(const ::webrtc::VideoFrame& fram
   if (!frameBuffer)
     return;
 
+  if (latencyProbe_->enabled())
+    latencyProbe_->onFrameDelivered(frame.ntp_time_ms(), ::webrtc::VideoLatencyProbe::currentNtpMs());
+
   UseVideoFrameType frameType{};
 
   switch (frameBuffer->type())
@@ -406,35 +631,68 @@ void WrapperImplType::notifyWebrtcObserverFrame(const ::webrtc::VideoFrame& fram
     }
   }
 
-  if (frameType != currentFrameType_ || !firstFrameReceived_) {
-    {
-      zsLib::AutoLock lock(lock_);
+  // only an element or event observers use the rendered media source, frame
+  // observers alone do not need one
+  if ((hasElement_) || (hasObservers_)) {
+    const auto traceId = ::webrtc::VideoFrameTrace::beginFrame();
+    ::webrtc::VideoFrameTrace::record(traceId, ::webrtc::VideoFrameTrace::Stage_RenderReceived);
+
+    bool renderOptionsChanged = renderOptionsChanged_.exchange(false);
+
+    if (frameType != currentFrameType_ || !firstFrameReceived_ || renderOptionsChanged) {
+      {
+        zsLib::AutoLock lock(lock_);
 
-      firstFrameReceived_ = true;
-      currentFrameType_ = frameType;
-      mediaStreamSource_ = UseMediaStreamSource::create(UseMediaStreamSource::CreationProperties{ frameType });
-      subscription_ = mediaStreamSource_->subscribe(videoObserver_);
+        firstFrameReceived_ = true;
+        currentFrameType_ = frameType;
+
+        UseMediaStreamSource::CreationProperties props;
+        props.frameType_ = frameType;
+        props.queueOptions_ = renderOptions_;
+        props.latencyProbe_ = latencyProbe_;
+        mediaStreamSource_ = UseMediaStreamSource::create(props);
+        subscription_ = mediaStreamSource_->subscribe(videoObserver_);
+      }
+
+      auto source = mediaStreamSource_->source();
+      notifyAboutNewMediaSource(*this, source);
     }
 
-    auto source = mediaStreamSource_->source();
-    notifyAboutNewMediaSource(*this, source);
+    mediaStreamSource_->notifyFrame(frame, traceId);
+  } else {
+    releaseMediaStreamSource();
   }
 
-  mediaStreamSource_->notifyFrame(frame);
-
   if (!hasVideoFrameObservers_)
     return;
 
-  auto wrapperBuffer = UseVideoFrameBuffer::toWrapper(frameBuffer);
-  auto wrapperEvent = UseVideoFrameBufferEvent::toWrapper(wrapperBuffer);
+  if (!videoFrameThrottle_->admit(rtc::TimeMicros())) return;
+
+  // a drain already queued will pick up the frame
+  if (!videoFrameThrottle_->offer(frameBuffer, frame.rotation())) return;
 
   auto pThis = thisWeak_.lock();
 
-  videoFrameProcessingQueue_->postClosure([pThis, wrapperEvent]() {
-    pThis->onVideoFrame(wrapperEvent);
+  videoFrameProcessingQueue_->postClosure([pThis]() {
+    pThis->deliverVideoFrames();
   });
 }
 
+//------------------------------------------------------------------------------
+void WrapperImplType::deliverVideoFrames() noexcept
+{
+  while (true) {
+    ::webrtc::VideoRotation rotation {::webrtc::kVideoRotation_0};
+    auto frameBuffer = videoFrameThrottle_->take(&rotation);
+    if (!frameBuffer) return;
+
+    auto wrapperBuffer = UseVideoFrameBuffer::toWrapper(frameBuffer);
+    auto wrapperEvent = UseVideoFrameBufferEvent::toWrapper(wrapperBuffer, static_cast<int>(rotation));
+
+    onVideoFrame(wrapperEvent);
+  }
+}
+
 //------------------------------------------------------------------------------
 void WrapperImplType::notifyWebrtcObserverDiscardedFrame() noexcept
 {
@@ -5,6 +5,9 @@
 #include "generated/org_webRtc_MediaStreamTrack.h"
 
 #include "impl_webrtc_IMediaStreamSource.h"
+#include "impl_webrtc_RenderFrameQueue.h"
+#include "impl_webrtc_VideoFrameThrottle.h"
+#include "impl_webrtc_VideoLatencyProbe.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "rtc_base/scoped_ref_ptr.h"
@@ -14,6 +17,7 @@
 
 #include <zsLib/IMessageQueue.h>
 
+#include <map>
 #include <set>
 
 namespace wrapper {
@@ -127,7 +131,16 @@ namespace wrapper {
           webrtc::IMediaStreamSourceSubscriptionPtr subscription_;
           std::atomic_bool hasObservers_;
           std::atomic_bool hasVideoFrameObservers_;
+          std::atomic_bool hasElement_ {};
+
+          zsLib::Lock sinkLock_;                    // never taken while a frame is delivered
+          bool sinkAttached_ {};
+          bool sinkUnconstrained_ {};
+          std::map<uint64_t, ::rtc::VideoSinkWants> sinkWants_;
+          uint64_t nextSinkWantsId_ {1};
           zsLib::IMessageQueuePtr videoFrameProcessingQueue_;
+          ::webrtc::VideoFrameThrottlePtr videoFrameThrottle_;
+          ::webrtc::VideoLatencyProbePtr latencyProbe_;
 
 #ifdef CPPWINRT_VERSION
           UseMediaStreamSourcePtr mediaStreamSource_;
@@ -136,6 +149,9 @@ namespace wrapper {
           UseVideoFrameType currentFrameType_{};
           bool firstFrameReceived_ { false };
 
+          ::webrtc::RenderFrameQueueTypes::Options renderOptions_;
+          std::atomic_bool renderOptionsChanged_ {};
+
           MediaStreamTrackWeakPtr thisWeak_;
 
           MediaStreamTrack() noexcept;
@@ -152,6 +168,23 @@ namespace wrapper {
           wrapper::org::webRtc::MediaSourcePtr get_source() noexcept override;
           wrapper::org::webRtc::MediaElementPtr get_element() noexcept override;
           void set_element(wrapper::org::webRtc::MediaElementPtr value) noexcept override;
+          wrapper::org::webRtc::MediaStreamTrackRenderOptionsPtr get_renderOptions() noexcept override;
+          void set_renderOptions(wrapper::org::webRtc::MediaStreamTrackRenderOptionsPtr value) noexcept override;
+          wrapper::org::webRtc::MediaStreamTrackRenderStatsPtr get_renderStats() noexcept override;
+          wrapper::org::webRtc::MediaStreamTrackVideoFrameOptionsPtr get_videoFrameOptions() noexcept override;
+          void set_videoFrameOptions(wrapper::org::webRtc::MediaStreamTrackVideoFrameOptionsPtr value) noexcept override;
+          wrapper::org::webRtc::MediaStreamTrackVideoFrameStatsPtr get_videoFrameStats() noexcept override;
+          bool get_latencyProbe() noexcept override;
+          void set_latencyProbe(bool value) noexcept override;
+          wrapper::org::webRtc::MediaStreamTrackLatencyStatsPtr get_latencyStats() noexcept override;
+
+          // methods MediaStreamTrack
+          uint64_t addVideoSinkWants(wrapper::org::webRtc::VideoSinkWantsPtr wants) noexcept override;
+          bool updateVideoSinkWants(
+                                    uint64_t id,
+                                    wrapper::org::webRtc::VideoSinkWantsPtr wants
+                                    ) noexcept override;
+          void removeVideoSinkWants(uint64_t id) noexcept override;
 
           void wrapper_onObserverCountChanged(size_t count) noexcept override;
           void wrapper_onObserveronVideoFrameCountChanged(size_t count) noexcept override;
@@ -161,10 +194,13 @@ namespace wrapper {
 
           void setupObserver() noexcept;
           void teardownObserver() noexcept;
+          void updateSinkAttachment(bool wantsChanged = false) noexcept;
+          void releaseMediaStreamSource() noexcept;
 
           // WebrtcObserver methods
           void notifyWebrtcObserverFrame(const ::webrtc::VideoFrame& frame) noexcept;
           void notifyWebrtcObserverDiscardedFrame() noexcept;
+          void deliverVideoFrames() noexcept;
           void onWebrtcObserverResolutionChanged(
                                                  uint32_t width,
                                                  uint32_t height
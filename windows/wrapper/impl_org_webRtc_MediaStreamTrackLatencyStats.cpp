@@ -0,0 +1,70 @@
+
+#include "impl_org_webRtc_MediaStreamTrackLatencyStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats::MediaStreamTrackLatencyStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackLatencyStatsPtr wrapper::org::webRtc::MediaStreamTrackLatencyStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats::~MediaStreamTrackLatencyStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats::wrapper_init_org_webRtc_MediaStreamTrackLatencyStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->deliveredFrames = SafeInt<decltype(result->deliveredFrames)>(native.delivered_);
+  result->renderedFrames = SafeInt<decltype(result->renderedFrames)>(native.rendered_);
+  if (native.rendered_ > 0)
+    result->captureTime = ::zsLib::Milliseconds(native.lastRendered_.captureTimeMs_);
+  result->deliveryLatency = ::zsLib::Milliseconds(native.lastRendered_.deliveryMs_);
+  result->renderLatency = ::zsLib::Milliseconds(native.lastRendered_.renderMs_);
+  result->latency = ::zsLib::Milliseconds(native.lastRendered_.totalMs_);
+  result->averageDeliveryLatency = native.averageDeliveryMs_;
+  result->averageLatency = native.averageTotalMs_;
+  result->maxLatency = ::zsLib::Milliseconds(native.maxTotalMs_);
+  return result;
+}
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_MediaStreamTrackLatencyStats.h"
+
+#include "impl_webrtc_VideoLatencyProbe.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct MediaStreamTrackLatencyStats : public wrapper::org::webRtc::MediaStreamTrackLatencyStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::MediaStreamTrackLatencyStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackLatencyStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoLatencyProbe::Stats, NativeType);
+
+          MediaStreamTrackLatencyStatsWeakPtr thisWeak_;
+
+          MediaStreamTrackLatencyStats() noexcept;
+          virtual ~MediaStreamTrackLatencyStats() noexcept;
+
+          void wrapper_init_org_webRtc_MediaStreamTrackLatencyStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
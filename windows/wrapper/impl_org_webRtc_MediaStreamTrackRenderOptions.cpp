@@ -0,0 +1,77 @@
+
+#include "impl_org_webRtc_MediaStreamTrackRenderOptions.h"
+#include "impl_org_webRtc_enums.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions::MediaStreamTrackRenderOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackRenderOptionsPtr wrapper::org::webRtc::MediaStreamTrackRenderOptions::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions::~MediaStreamTrackRenderOptions() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions::wrapper_init_org_webRtc_MediaStreamTrackRenderOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->latencyMode = UseEnum::toWrapper(native.latencyMode_);
+  result->smoothFrames = SafeInt<decltype(result->smoothFrames)>(native.smoothFrames_);
+  result->keyFramePolicy = UseEnum::toWrapper(native.keyFramePolicy_);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->latencyMode_ = UseEnum::toNative(wrapper->latencyMode);
+  result->smoothFrames_ = SafeInt<decltype(result->smoothFrames_)>(wrapper->smoothFrames);
+  result->keyFramePolicy_ = UseEnum::toNative(wrapper->keyFramePolicy);
+  return result;
+}
@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_MediaStreamTrackRenderOptions.h"
+
+#include "impl_webrtc_RenderFrameQueue.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct MediaStreamTrackRenderOptions : public wrapper::org::webRtc::MediaStreamTrackRenderOptions
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::MediaStreamTrackRenderOptions, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderOptions, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::RenderFrameQueueTypes::Options, NativeType);
+
+          MediaStreamTrackRenderOptionsWeakPtr thisWeak_;
+
+          MediaStreamTrackRenderOptions() noexcept;
+          virtual ~MediaStreamTrackRenderOptions() noexcept;
+
+          void wrapper_init_org_webRtc_MediaStreamTrackRenderOptions() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -0,0 +1,66 @@
+
+#include "impl_org_webRtc_MediaStreamTrackRenderStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackRenderStats::MediaStreamTrackRenderStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackRenderStatsPtr wrapper::org::webRtc::MediaStreamTrackRenderStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::MediaStreamTrackRenderStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackRenderStats::~MediaStreamTrackRenderStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrackRenderStats::wrapper_init_org_webRtc_MediaStreamTrackRenderStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->queueDepth = SafeInt<decltype(result->queueDepth)>(native.depth_);
+  result->queuedFrames = SafeInt<decltype(result->queuedFrames)>(native.pushed_);
+  result->renderedFrames = SafeInt<decltype(result->renderedFrames)>(native.delivered_);
+  result->replacedFrames = SafeInt<decltype(result->replacedFrames)>(native.replaced_);
+  result->overflowDroppedFrames = SafeInt<decltype(result->overflowDroppedFrames)>(native.overflowed_);
+  result->keyFrameWaitDroppedFrames = SafeInt<decltype(result->keyFrameWaitDroppedFrames)>(native.awaitingKeyFrame_);
+  result->skippedFrames = SafeInt<decltype(result->skippedFrames)>(native.skipped_);
+  return result;
+}
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_MediaStreamTrackRenderStats.h"
+
+#include "impl_webrtc_RenderFrameQueue.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct MediaStreamTrackRenderStats : public wrapper::org::webRtc::MediaStreamTrackRenderStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::MediaStreamTrackRenderStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackRenderStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::RenderFrameQueueTypes::Stats, NativeType);
+
+          MediaStreamTrackRenderStatsWeakPtr thisWeak_;
+
+          MediaStreamTrackRenderStats() noexcept;
+          virtual ~MediaStreamTrackRenderStats() noexcept;
+
+          void wrapper_init_org_webRtc_MediaStreamTrackRenderStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
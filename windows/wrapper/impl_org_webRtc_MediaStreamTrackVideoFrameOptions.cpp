@@ -0,0 +1,76 @@
+
+#include "impl_org_webRtc_MediaStreamTrackVideoFrameOptions.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions::MediaStreamTrackVideoFrameOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackVideoFrameOptionsPtr wrapper::org::webRtc::MediaStreamTrackVideoFrameOptions::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions::~MediaStreamTrackVideoFrameOptions() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions::wrapper_init_org_webRtc_MediaStreamTrackVideoFrameOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  if (native.maxFramerate_ > 0) result->maxFramerate = native.maxFramerate_;
+  if (native.maxWidth_ > 0) result->maxWidth = SafeInt<decltype(result->maxWidth)::value_type>(native.maxWidth_);
+  if (native.maxHeight_ > 0) result->maxHeight = SafeInt<decltype(result->maxHeight)::value_type>(native.maxHeight_);
+  result->latestFrameOnly = native.latestFrameOnly_;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  if (wrapper->maxFramerate.has_value()) result->maxFramerate_ = wrapper->maxFramerate.value();
+  if (wrapper->maxWidth.has_value()) result->maxWidth_ = SafeInt<decltype(result->maxWidth_)>(wrapper->maxWidth.value());
+  if (wrapper->maxHeight.has_value()) result->maxHeight_ = SafeInt<decltype(result->maxHeight_)>(wrapper->maxHeight.value());
+  result->latestFrameOnly_ = wrapper->latestFrameOnly;
+  return result;
+}
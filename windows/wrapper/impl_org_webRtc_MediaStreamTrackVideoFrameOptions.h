@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_MediaStreamTrackVideoFrameOptions.h"
+
+#include "impl_webrtc_VideoFrameThrottle.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct MediaStreamTrackVideoFrameOptions : public wrapper::org::webRtc::MediaStreamTrackVideoFrameOptions
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::MediaStreamTrackVideoFrameOptions, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameOptions, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoFrameThrottle::Options, NativeType);
+
+          MediaStreamTrackVideoFrameOptionsWeakPtr thisWeak_;
+
+          MediaStreamTrackVideoFrameOptions() noexcept;
+          virtual ~MediaStreamTrackVideoFrameOptions() noexcept;
+
+          void wrapper_init_org_webRtc_MediaStreamTrackVideoFrameOptions() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -0,0 +1,63 @@
+
+#include "impl_org_webRtc_MediaStreamTrackVideoFrameStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats::MediaStreamTrackVideoFrameStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::MediaStreamTrackVideoFrameStatsPtr wrapper::org::webRtc::MediaStreamTrackVideoFrameStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats::~MediaStreamTrackVideoFrameStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats::wrapper_init_org_webRtc_MediaStreamTrackVideoFrameStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->deliveredFrames = SafeInt<decltype(result->deliveredFrames)>(native.delivered_);
+  result->rateDroppedFrames = SafeInt<decltype(result->rateDroppedFrames)>(native.rateDropped_);
+  result->coalescedFrames = SafeInt<decltype(result->coalescedFrames)>(native.coalesced_);
+  result->pendingFrames = SafeInt<decltype(result->pendingFrames)>(native.pending_);
+  return result;
+}
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_MediaStreamTrackVideoFrameStats.h"
+
+#include "impl_webrtc_VideoFrameThrottle.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct MediaStreamTrackVideoFrameStats : public wrapper::org::webRtc::MediaStreamTrackVideoFrameStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::MediaStreamTrackVideoFrameStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaStreamTrackVideoFrameStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoFrameThrottle::Stats, NativeType);
+
+          MediaStreamTrackVideoFrameStatsWeakPtr thisWeak_;
+
+          MediaStreamTrackVideoFrameStats() noexcept;
+          virtual ~MediaStreamTrackVideoFrameStats() noexcept;
+
+          void wrapper_init_org_webRtc_MediaStreamTrackVideoFrameStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -1,5 +1,6 @@
 
 #include "impl_org_webRtc_MessageEvent.h"
+#include "impl_org_webRtc_ByteBuffer.h"
 
 //#include "impl_org_webRtc_pre_include.h"
 //#include "impl_org_webRtc_post_include.h"
@@ -30,6 +31,7 @@ ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
 ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
 
 ZS_DECLARE_TYPEDEF_PTR(zsLib::eventing::IHelper, UseHelper);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::ByteBuffer, UseByteBuffer);
 
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::MessageEvent::MessageEvent() noexcept
@@ -53,16 +55,25 @@ wrapper::impl::org::webRtc::MessageEvent::~MessageEvent() noexcept
 //------------------------------------------------------------------------------
 SecureByteBlockPtr wrapper::impl::org::webRtc::MessageEvent::get_binary() noexcept
 {
-  return native_;
+  zsLib::AutoLock lock(lock_);
+  if (!binary_) binary_ = UseHelper::convertToBuffer(native_.cdata(), native_.size());
+  return binary_;
 }
 
 //------------------------------------------------------------------------------
 String wrapper::impl::org::webRtc::MessageEvent::get_text() noexcept
 {
   if (isBinary_) return String();
-  if (!native_) return String();
 
-  return UseHelper::convertToString(*native_);
+  zsLib::AutoLock lock(lock_);
+  if (!text_.has_value()) text_ = String(std::string(native_.cdata<char>(), native_.size()));
+  return text_.value();
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr wrapper::impl::org::webRtc::MessageEvent::get_buffer() noexcept
+{
+  return UseByteBuffer::toWrapper(native_);
 }
 
 //------------------------------------------------------------------------------
@@ -70,7 +81,7 @@ WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
 {
   auto wrapper = make_shared<WrapperImplType>();
   wrapper->thisWeak_ = wrapper;
-  wrapper->native_ = UseHelper::convertToBuffer(native.data.data(), native.size());
+  wrapper->native_ = native.data;
   wrapper->isBinary_ = native.binary;
   return wrapper;
 }
@@ -80,7 +91,7 @@ WrapperImplTypePtr WrapperImplType::toWrapper(const SecureByteBlock &native) noe
 {
   auto wrapper = make_shared<WrapperImplType>();
   wrapper->thisWeak_ = wrapper;
-  wrapper->native_ = make_shared<SecureByteBlock>(native);
+  wrapper->native_.SetData(native.BytePtr(), native.SizeInBytes());
   wrapper->isBinary_ = true;
   return wrapper;
 }
@@ -97,7 +108,7 @@ WrapperImplTypePtr WrapperImplType::toWrapper(const String &native) noexcept
 {
   auto wrapper = make_shared<WrapperImplType>();
   wrapper->thisWeak_ = wrapper;
-  wrapper->native_ = UseHelper::convertToBuffer(native);
+  wrapper->native_.SetData(native.c_str(), native.length());
   wrapper->isBinary_ = false;
   return wrapper;
 }
@@ -109,10 +120,5 @@ NativeType WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
   auto converted = ZS_DYNAMIC_PTR_CAST(WrapperImplType, wrapper);
   ZS_ASSERT(converted);
   if (!converted) return NativeType(rtc::CopyOnWriteBuffer(), false);
-  auto buffer = converted->get_binary();
-  if ((buffer) && (buffer->SizeInBytes() > 0)) {
-    rtc::CopyOnWriteBuffer nativeBuffer(buffer->BytePtr(), buffer->SizeInBytes(), buffer->SizeInBytes() + sizeof(char)); // add space for nul character
-    return NativeType(nativeBuffer, converted->isBinary_);
-  }
-  return NativeType(rtc::CopyOnWriteBuffer(), converted->isBinary_);
+  return NativeType(converted->native_, converted->isBinary_);
 }
@@ -19,8 +19,16 @@ namespace wrapper {
           ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MessageEvent, WrapperImplType);
           ZS_DECLARE_TYPEDEF_PTR(::webrtc::DataBuffer, NativeType);
 
-          SecureByteBlockPtr native_;
+          // the received buffer is shared rather than copied; the binary and
+          // text forms are only made when first asked for. native_ is never
+          // modified after toWrapper() so it may be read without lock_, but
+          // only through its const accessors (non-const access would unshare
+          // the buffer)
+          rtc::CopyOnWriteBuffer native_;
           bool isBinary_ {};
+          zsLib::Lock lock_;
+          SecureByteBlockPtr binary_;
+          Optional< String > text_;
           MessageEventWeakPtr thisWeak_;
 
           MessageEvent() noexcept;
@@ -30,6 +38,7 @@ namespace wrapper {
           // properties MessageEvent
           SecureByteBlockPtr get_binary() noexcept override;
           String get_text() noexcept override;
+          wrapper::org::webRtc::ByteBufferPtr get_buffer() noexcept override;
 
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const SecureByteBlock &native) noexcept;
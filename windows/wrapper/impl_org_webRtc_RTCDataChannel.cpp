@@ -1,11 +1,15 @@
 
 #include "impl_org_webRtc_RTCDataChannel.h"
 #include "impl_org_webRtc_MessageEvent.h"
+#include "impl_org_webRtc_ByteBuffer.h"
+#include "impl_org_webRtc_RTCDataChannelSendQueueOptions.h"
+#include "impl_org_webRtc_RTCDataChannelSendQueueStats.h"
 #include "impl_org_webRtc_WebrtcLib.h"
 #include "impl_org_webRtc_RTCStatsProvider.h"
 #include "impl_org_webRtc_RTCError.h"
 #include "impl_org_webRtc_helpers.h"
 #include "impl_org_webRtc_enums.h"
+#include "impl_webrtc_DataChannelPayload.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "pc/datachannel.h"
@@ -13,6 +17,8 @@
 
 #include <zsLib/SafeInt.h>
 
+#include <sstream>
+
 using ::zsLib::String;
 using ::zsLib::Optional;
 using ::zsLib::Any;
@@ -43,6 +49,9 @@ typedef wrapper::impl::org::webRtc::WrapperMapper<NativeType, WrapperImplType> U
 
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::WebRtcLib, UseWebrtcLib);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MessageEvent, UseMessageEvent);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::ByteBuffer, UseByteBuffer);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions, UseSendQueueOptions);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats, UseSendQueueStats);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
 
 //------------------------------------------------------------------------------
@@ -89,6 +98,7 @@ void wrapper::impl::org::webRtc::RTCDataChannel::wrapper_dispose() noexcept
   }
 
   teardownObserver();
+  if (sendQueue_) sendQueue_->clear();
   mapperSingleton().remove(native_.get());
   native_ = NativeTypeScopedPtr();
 }
@@ -127,9 +137,7 @@ void wrapper::impl::org::webRtc::RTCDataChannel::send(String text) noexcept(fals
   ZS_ASSERT(native_);
   if (!native_) return;
 
-  auto wrapperValue = UseMessageEvent::toWrapper(text);
-  auto nativeValue = UseMessageEvent::toNative(wrapperValue);
-  native_->Send(nativeValue);
+  native_->Send(::webrtc::DataChannelPayload::fromText(text));
 }
 
 //------------------------------------------------------------------------------
@@ -140,9 +148,91 @@ void wrapper::impl::org::webRtc::RTCDataChannel::send(SecureByteBlockPtr data) n
   ZS_ASSERT(native_);
   if (!native_) return;
 
-  auto wrapperValue = UseMessageEvent::toWrapper(data);
-  auto nativeValue = UseMessageEvent::toNative(wrapperValue);
-  native_->Send(nativeValue);
+  if (!data) {
+    native_->Send(::webrtc::DataChannelPayload::fromBytes(nullptr, 0));
+    return;
+  }
+
+  native_->Send(::webrtc::DataChannelPayload::fromBytes(data->BytePtr(), data->SizeInBytes()));
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::RTCDataChannel::send(wrapper::org::webRtc::ByteBufferPtr data) noexcept(false)
+{
+  bufferLowNotified_ = false;
+
+  ZS_ASSERT(native_);
+  if (!native_) return;
+
+  native_->Send(::webrtc::DataChannelPayload::fromBuffer(UseByteBuffer::toNative(data)));
+}
+
+//------------------------------------------------------------------------------
+uint64_t wrapper::impl::org::webRtc::RTCDataChannel::sendMany(shared_ptr< list< wrapper::org::webRtc::ByteBufferPtr > > data) noexcept(false)
+{
+  std::vector<::webrtc::DataBuffer> buffers;
+  if (data) {
+    buffers.reserve(data->size());
+    for (auto iter = data->begin(); iter != data->end(); ++iter) {
+      buffers.emplace_back(UseByteBuffer::toNative(*iter), true);
+    }
+  }
+  return sendBatch(buffers);
+}
+
+//------------------------------------------------------------------------------
+uint64_t wrapper::impl::org::webRtc::RTCDataChannel::sendGathered(shared_ptr< list< wrapper::org::webRtc::ByteBufferPtr > > parts) noexcept(false)
+{
+  size_t total = 0;
+  std::vector<rtc::CopyOnWriteBuffer> natives;
+  if (parts) {
+    natives.reserve(parts->size());
+    for (auto iter = parts->begin(); iter != parts->end(); ++iter) {
+      natives.push_back(UseByteBuffer::toNative(*iter));
+      total += natives.back().size();
+    }
+  }
+
+  // a single part is sent as is, otherwise the parts are joined into one
+  // allocation sized up front
+  std::vector<::webrtc::DataBuffer> buffers;
+  if (1 == natives.size()) {
+    buffers.emplace_back(natives.front(), true);
+  } else {
+    rtc::CopyOnWriteBuffer joined(0, total);
+    for (auto &native : natives) {
+      joined.AppendData(native.cdata(), native.size());
+    }
+    buffers.emplace_back(joined, true);
+  }
+  return sendBatch(buffers);
+}
+
+//------------------------------------------------------------------------------
+PromisePtr wrapper::impl::org::webRtc::RTCDataChannel::sendAsync(wrapper::org::webRtc::ByteBufferPtr data) noexcept
+{
+  auto promise = Promise::create(UseWebrtcLib::delegateQueue());
+
+  ZS_ASSERT(native_);
+  if ((!native_) || (!sendQueue_)) {
+    RTCError::rejectPromise(promise, ::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_STATE));
+    return promise;
+  }
+
+  bufferLowNotified_ = false;
+
+  auto queued = sendQueue_->send(::webrtc::DataBuffer(UseByteBuffer::toNative(data), true), [promise](bool handedOff) {
+    if (handedOff) {
+      promise->resolve();
+      return;
+    }
+    RTCError::rejectPromise(promise, ::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_STATE, "data channel failed to queue message"));
+  });
+
+  if (!queued) {
+    RTCError::rejectPromise(promise, ::webrtc::RTCError(::webrtc::RTCErrorType::RESOURCE_EXHAUSTED, "data channel send queue is full"));
+  }
+  return promise;
 }
 
 //------------------------------------------------------------------------------
@@ -268,6 +358,30 @@ void wrapper::impl::org::webRtc::RTCDataChannel::set_binaryType(String value) no
   binaryType_ = value;
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::RTCDataChannelSendQueueOptionsPtr wrapper::impl::org::webRtc::RTCDataChannel::get_sendQueueOptions() noexcept
+{
+  if (!sendQueue_) return UseSendQueueOptions::toWrapper(::webrtc::DataChannelSendQueue::Options{});
+  return UseSendQueueOptions::toWrapper(sendQueue_->options());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::RTCDataChannel::set_sendQueueOptions(wrapper::org::webRtc::RTCDataChannelSendQueueOptionsPtr value) noexcept
+{
+  ZS_ASSERT(sendQueue_);
+  if (!sendQueue_) return;
+
+  auto native = UseSendQueueOptions::toNative(value);
+  sendQueue_->setOptions(native ? *native : ::webrtc::DataChannelSendQueue::Options{});
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::RTCDataChannelSendQueueStatsPtr wrapper::impl::org::webRtc::RTCDataChannel::get_sendQueueStats() noexcept
+{
+  if (!sendQueue_) return UseSendQueueStats::toWrapper(::webrtc::DataChannelSendQueue::Stats{});
+  return UseSendQueueStats::toWrapper(sendQueue_->stats());
+}
+
 //------------------------------------------------------------------------------
 void wrapper::impl::org::webRtc::RTCDataChannel::wrapper_onObserverCountChanged(ZS_MAYBE_USED() size_t count) noexcept
 {
@@ -325,7 +439,7 @@ void WrapperImplType::setupObserver() noexcept
   if (!native_) return;
   if (observer_) return;
 
-  observer_ = std::make_unique<WebrtcObserver>(thisWeak_.lock(), UseWebrtcLib::delegateQueue());
+  observer_ = std::make_unique<WebrtcObserver>(thisWeak_.lock(), UseWebrtcLib::delegateQueue(), sendQueue_);
   native_->RegisterObserver(observer_.get());
 }
 
@@ -339,17 +453,64 @@ void WrapperImplType::teardownObserver() noexcept
 }
 
 //------------------------------------------------------------------------------
-WrapperImplTypePtr WrapperImplType::toWrapper(NativeType *native) noexcept
+uint64_t WrapperImplType::sendBatch(const std::vector<::webrtc::DataBuffer> &buffers) noexcept(false)
+{
+  bufferLowNotified_ = false;
+
+  ZS_ASSERT(native_);
+  if (!native_) return 0;
+
+  size_t sent = 0;
+  uint64_t bufferedAmount = 0;
+
+  if (!signalingThread_) {
+    // no signaling thread is known so each message hops through the proxy
+    for (auto &buffer : buffers) {
+      if (!native_->Send(buffer)) break;
+      ++sent;
+    }
+    bufferedAmount = native_->buffered_amount();
+  } else {
+    // the proxy would block on the signaling thread once per message and
+    // again for the buffered amount; the batch is queued on the original
+    // channel in a single hop instead
+    auto original = unproxy(native_.get());
+    signalingThread_->Invoke<void>(RTC_FROM_HERE, [original, &buffers, &sent, &bufferedAmount]() {
+      for (auto &buffer : buffers) {
+        if (!original->Send(buffer)) break;
+        ++sent;
+      }
+      bufferedAmount = original->buffered_amount();
+    });
+  }
+
+  if (sent != buffers.size()) {
+    // the messages before the failing one were already queued and cannot
+    // be recalled, so the caller is told how many went out
+    std::stringstream ss;
+    ss << "data channel queued " << sent << " of " << buffers.size() << " messages";
+    throw RTCError::toWrapper(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_STATE, ss.str()));
+  }
+  return bufferedAmount;
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(
+  NativeType *native,
+  rtc::Thread *signalingThread
+  ) noexcept
 {
   if (!native) return WrapperImplTypePtr();
 
   auto original = unproxy(native);
 
   // search for original non-proxied pointer in map
-  auto wrapper = mapperSingleton().getExistingOrCreateNew(original, [native]() {
+  auto wrapper = mapperSingleton().getExistingOrCreateNew(original, [native, signalingThread]() {
     auto result = make_shared<WrapperImplType>();
     result->thisWeak_ = result;
     result->native_ = rtc::scoped_refptr<NativeType>(native); // only use proxy and never original pointer
+    result->signalingThread_ = signalingThread;
+    result->sendQueue_ = ::webrtc::DataChannelSendQueue::create(result->native_, signalingThread);
     result->setupObserver();
     return result;
   });
@@ -357,9 +518,12 @@ WrapperImplTypePtr WrapperImplType::toWrapper(NativeType *native) noexcept
 }
 
 //------------------------------------------------------------------------------
-WrapperImplTypePtr WrapperImplType::toWrapper(NativeTypeScopedPtr native) noexcept
+WrapperImplTypePtr WrapperImplType::toWrapper(
+  NativeTypeScopedPtr native,
+  rtc::Thread *signalingThread
+  ) noexcept
 {
-  return toWrapper(native.get());
+  return toWrapper(native.get(), signalingThread);
 }
 
 //------------------------------------------------------------------------------
@@ -7,8 +7,11 @@
 #include "impl_org_webRtc_pre_include.h"
 #include "rtc_base/scoped_ref_ptr.h"
 #include "api/datachannelinterface.h"
+#include "rtc_base/thread.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include "impl_webrtc_DataChannelSendQueue.h"
+
 namespace wrapper {
   namespace impl {
     namespace org {
@@ -28,11 +31,13 @@ namespace wrapper {
           {
             WebrtcObserver(
               WrapperImplTypePtr wrapper,
-              IMessageQueuePtr queue
-            ) noexcept : outer_(wrapper), queue_(queue) {}
+              IMessageQueuePtr queue,
+              ::webrtc::DataChannelSendQueuePtr sendQueue
+            ) noexcept : outer_(wrapper), queue_(queue), sendQueue_(sendQueue) {}
 
             void OnStateChange() final
             {
+              if (sendQueue_) sendQueue_->drain();
               auto outer = outer_.lock();
               if (!outer) return;
               queue_->postClosure([outer]() { outer->onWebrtcObserverStateChange(); });
@@ -45,6 +50,7 @@ namespace wrapper {
             }
             void OnBufferedAmountChange(uint64_t previous_amount)
             {
+              if (sendQueue_) sendQueue_->drain();
               auto outer = outer_.lock();
               if (!outer) return;
               queue_->postClosure([outer, previous_amount]() { outer->onWebrtcObserverBufferedAmountChange(previous_amount); });
@@ -53,6 +59,7 @@ namespace wrapper {
           private:
             WrapperImplTypeWeakPtr outer_;
             IMessageQueuePtr queue_;
+            ::webrtc::DataChannelSendQueuePtr sendQueue_;
           };
 
           std::atomic_bool closeCalled_ {};
@@ -65,6 +72,8 @@ namespace wrapper {
 
           WebrtcObserverUniPtr observer_;
           NativeTypeScopedPtr native_;
+          rtc::Thread *signalingThread_ {};
+          ::webrtc::DataChannelSendQueuePtr sendQueue_;
           RTCDataChannelWeakPtr thisWeak_;
 
           RTCDataChannel() noexcept;
@@ -79,6 +88,10 @@ namespace wrapper {
           void close() noexcept override;
           void send(String text) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
           void send(SecureByteBlockPtr data) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
+          void send(wrapper::org::webRtc::ByteBufferPtr data) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
+          uint64_t sendMany(shared_ptr< list< wrapper::org::webRtc::ByteBufferPtr > > data) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
+          uint64_t sendGathered(shared_ptr< list< wrapper::org::webRtc::ByteBufferPtr > > parts) noexcept(false) override; // throws wrapper::org::webRtc::RTCErrorPtr
+          PromisePtr sendAsync(wrapper::org::webRtc::ByteBufferPtr data) noexcept override;
 
           // properties RTCDataChannel
           unsigned short get_id() noexcept override;
@@ -95,19 +108,31 @@ namespace wrapper {
           void set_bufferedAmountLowThreshold(uint64_t value) noexcept override;
           String get_binaryType() noexcept override;
           void set_binaryType(String value) noexcept override;
+          wrapper::org::webRtc::RTCDataChannelSendQueueOptionsPtr get_sendQueueOptions() noexcept override;
+          void set_sendQueueOptions(wrapper::org::webRtc::RTCDataChannelSendQueueOptionsPtr value) noexcept override;
+          wrapper::org::webRtc::RTCDataChannelSendQueueStatsPtr get_sendQueueStats() noexcept override;
 
           void wrapper_onObserverCountChanged(size_t count) noexcept override;
 
           void setupObserver() noexcept;
           void teardownObserver() noexcept;
 
+          // queues the messages in order with a single hop to the signaling
+          // thread, stopping at the first message that cannot be queued; the
+          // messages before it stay queued and the error says how many
+          uint64_t sendBatch(const std::vector<::webrtc::DataBuffer> &buffers) noexcept(false); // throws wrapper::org::webRtc::RTCErrorPtr
+
           // WebrtcObserver methods
           void onWebrtcObserverStateChange() noexcept;
           void onWebrtcObserverMessage(const ::webrtc::DataBuffer& buffer) noexcept;
           void onWebrtcObserverBufferedAmountChange(uint64_t previous_amount) noexcept;
 
-          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeType *native) noexcept;
-          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeTypeScopedPtr native) noexcept;
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(
+            NativeType *native,
+            rtc::Thread *signalingThread = nullptr) noexcept;
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(
+            NativeTypeScopedPtr native,
+            rtc::Thread *signalingThread = nullptr) noexcept;
           ZS_NO_DISCARD() static NativeTypeScopedPtr toNative(WrapperTypePtr wrapper) noexcept;
         };
 
@@ -0,0 +1,76 @@
+
+#include "impl_org_webRtc_RTCDataChannelSendQueueOptions.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions::RTCDataChannelSendQueueOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::RTCDataChannelSendQueueOptionsPtr wrapper::org::webRtc::RTCDataChannelSendQueueOptions::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions::~RTCDataChannelSendQueueOptions() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions::wrapper_init_org_webRtc_RTCDataChannelSendQueueOptions() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->enabled = native.enabled_;
+  result->highWatermark = SafeInt<decltype(result->highWatermark)>(native.highWatermark_);
+  result->lowWatermark = SafeInt<decltype(result->lowWatermark)>(native.lowWatermark_);
+  result->maxQueuedBytes = SafeInt<decltype(result->maxQueuedBytes)>(native.maxQueuedBytes_);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->enabled_ = wrapper->enabled;
+  result->highWatermark_ = SafeInt<decltype(result->highWatermark_)>(wrapper->highWatermark);
+  result->lowWatermark_ = SafeInt<decltype(result->lowWatermark_)>(wrapper->lowWatermark);
+  result->maxQueuedBytes_ = SafeInt<decltype(result->maxQueuedBytes_)>(wrapper->maxQueuedBytes);
+  return result;
+}
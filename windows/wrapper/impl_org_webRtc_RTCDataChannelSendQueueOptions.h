@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_RTCDataChannelSendQueueOptions.h"
+
+#include "impl_webrtc_DataChannelSendQueue.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct RTCDataChannelSendQueueOptions : public wrapper::org::webRtc::RTCDataChannelSendQueueOptions
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::RTCDataChannelSendQueueOptions, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueOptions, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::DataChannelSendQueue::Options, NativeType);
+
+          RTCDataChannelSendQueueOptionsWeakPtr thisWeak_;
+
+          RTCDataChannelSendQueueOptions() noexcept;
+          virtual ~RTCDataChannelSendQueueOptions() noexcept;
+
+          void wrapper_init_org_webRtc_RTCDataChannelSendQueueOptions() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -0,0 +1,66 @@
+
+#include "impl_org_webRtc_RTCDataChannelSendQueueStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats::RTCDataChannelSendQueueStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::RTCDataChannelSendQueueStatsPtr wrapper::org::webRtc::RTCDataChannelSendQueueStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats::~RTCDataChannelSendQueueStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats::wrapper_init_org_webRtc_RTCDataChannelSendQueueStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->queuedMessages = SafeInt<decltype(result->queuedMessages)>(native.queuedMessages_);
+  result->queuedBytes = SafeInt<decltype(result->queuedBytes)>(native.queuedBytes_);
+  result->sentMessages = SafeInt<decltype(result->sentMessages)>(native.sentMessages_);
+  result->sentBytes = SafeInt<decltype(result->sentBytes)>(native.sentBytes_);
+  result->failedMessages = SafeInt<decltype(result->failedMessages)>(native.failedMessages_);
+  result->rejectedMessages = SafeInt<decltype(result->rejectedMessages)>(native.rejectedMessages_);
+  result->paused = native.paused_;
+  return result;
+}
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_RTCDataChannelSendQueueStats.h"
+
+#include "impl_webrtc_DataChannelSendQueue.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct RTCDataChannelSendQueueStats : public wrapper::org::webRtc::RTCDataChannelSendQueueStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::RTCDataChannelSendQueueStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::RTCDataChannelSendQueueStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::DataChannelSendQueue::Stats, NativeType);
+
+          RTCDataChannelSendQueueStatsWeakPtr thisWeak_;
+
+          RTCDataChannelSendQueueStats() noexcept;
+          virtual ~RTCDataChannelSendQueueStats() noexcept;
+
+          void wrapper_init_org_webRtc_RTCDataChannelSendQueueStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -293,6 +293,9 @@ void wrapper::impl::org::webRtc::RTCPeerConnection::wrapper_init_org_webRtc_RTCP
   ZS_ASSERT(factory);
   if (!factory) return;
 
+  auto realFactory = factoryImpl->realPeerConnectionFactory();
+  if (realFactory) signalingThread_ = realFactory->signaling_thread();
+
   setupObserver();
   ZS_ASSERT(observer_);
 
@@ -658,7 +661,7 @@ wrapper::org::webRtc::RTCDataChannelPtr wrapper::impl::org::webRtc::RTCPeerConne
   auto nativeInit = UseDataChannelInit::toNative(init);
   if (!nativeInit) return wrapper::org::webRtc::RTCDataChannelPtr();
 
-  return UseDataChannel::toWrapper(native_->CreateDataChannel(label, nativeInit.get()));
+  return UseDataChannel::toWrapper(native_->CreateDataChannel(label, nativeInit.get()), signalingThread_);
 }
 
 //------------------------------------------------------------------------------
@@ -761,7 +764,7 @@ void WrapperImplType::onWebrtcObserverSignalingChange(ZS_MAYBE_USED() NativeType
 //------------------------------------------------------------------------------
 void WrapperImplType::onWebrtcObserverDataChannel(rtc::scoped_refptr<::webrtc::DataChannelInterface> data_channel) noexcept
 {
-  auto event = RTCDataChannelEvent::toWrapper(UseDataChannel::toWrapper(data_channel));
+  auto event = RTCDataChannelEvent::toWrapper(UseDataChannel::toWrapper(data_channel, signalingThread_));
   if (!event) return;
   onDataChannel(event);
 }
@@ -8,6 +8,7 @@
 #include "impl_org_webRtc_pre_include.h"
 #include "rtc_base/scoped_ref_ptr.h"
 #include "api/peerconnectioninterface.h"
+#include "rtc_base/thread.h"
 #include "impl_org_webRtc_post_include.h"
 
 namespace wrapper {
@@ -130,6 +131,7 @@ namespace wrapper {
           std::atomic_bool closeCalled_{};
           WebrtcObserverUniPtr observer_;
           NativeTypeScopedPtr native_;
+          rtc::Thread *signalingThread_ {};
           RTCPeerConnectionWeakPtr thisWeak_;
 
           RTCPeerConnection() noexcept;
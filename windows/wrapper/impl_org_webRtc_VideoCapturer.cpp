@@ -17,7 +17,16 @@
 #include "impl_org_webRtc_WebrtcLib.h"
 #include "impl_org_webRtc_enums.h"
 #include "impl_org_webRtc_VideoCapturerInputSize.h"
+#include "impl_org_webRtc_VideoCapturerSharingStats.h"
+#include "impl_org_webRtc_VideoCapturerBufferPoolStats.h"
+#include "impl_org_webRtc_VideoCapturerCrop.h"
+#include "impl_org_webRtc_VideoCapturerChangeDetection.h"
+#include "impl_org_webRtc_VideoCapturerChangeStats.h"
+#include "impl_org_webRtc_VideoCapturerLoadAdaptation.h"
+#include "impl_org_webRtc_VideoCapturerLoadStats.h"
 #include "impl_webrtc_VideoCapturer.h"
+#include "impl_webrtc_SharedVideoCapturer.h"
+#include "impl_webrtc_VideoFormatCost.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "media/engine/webrtcvideocapturer.h"
@@ -56,6 +65,13 @@ ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoDeviceInfo, UseVideoDevi
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFormat, UseVideoFormat);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerInputSize, UseVideoCapturerInputSize);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerSharingStats, UseVideoCapturerSharingStats);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats, UseVideoCapturerBufferPoolStats);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerCrop, UseVideoCapturerCrop);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeDetection, UseVideoCapturerChangeDetection);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeStats, UseVideoCapturerChangeStats);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation, UseVideoCapturerLoadAdaptation);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerLoadStats, UseVideoCapturerLoadStats);
 
 
 //------------------------------------------------------------------------------
@@ -107,11 +123,30 @@ wrapper::org::webRtc::VideoCapturerPtr wrapper::org::webRtc::VideoCapturer::crea
 
   auto result = make_shared<WrapperImplType>();
   result->thisWeak_ = result;
+  result->fanout_ = dynamic_cast<webrtc::VideoCapturer*>(native.get())->fanout();
+  result->framePool_ = dynamic_cast<webrtc::VideoCapturer*>(native.get())->framePool();
+  result->crop_ = dynamic_cast<webrtc::VideoCapturer*>(native.get())->crop();
+  result->changeDetector_ = dynamic_cast<webrtc::VideoCapturer*>(native.get())->changeDetector();
+  result->loadMonitor_ = dynamic_cast<webrtc::VideoCapturer*>(native.get())->loadMonitor();
   result->native_ = std::move(native);
   result->setupObserver();
   return result;
 }
 
+//------------------------------------------------------------------------------
+PromisePtr wrapper::org::webRtc::VideoCapturer::measureConversionCosts() noexcept
+{
+  auto queue = UseWebrtcLib::videoFrameProcessingQueue();
+  if (!queue) return UseError::toPromise(::webrtc::RTCError(::webrtc::RTCErrorType::INVALID_STATE));
+
+  auto promise = Promise::create(UseWebrtcLib::delegateQueue());
+  queue->postClosure([promise]() {
+    ::webrtc::VideoFormatCost::measure();
+    promise->resolve();
+  });
+  return promise;
+}
+
 static bool alwaysTrue() { return true; }
 
 //------------------------------------------------------------------------------
@@ -196,7 +231,11 @@ wrapper::org::webRtc::VideoFormatPtr wrapper::impl::org::webRtc::VideoCapturer::
   if (!converted) return wrapper::org::webRtc::VideoFormatPtr();
 
   ::cricket::VideoFormat format;
-  if (!native_->GetBestCaptureFormat(*converted, &format)) return wrapper::org::webRtc::VideoFormatPtr();
+
+  // device capturers rank the formats meeting the desired one by conversion cost
+  auto capturer = dynamic_cast<::webrtc::IVideoCapturer *>(native_.get());
+  bool found = (capturer ? capturer->selectCaptureFormat(*converted, format) : native_->GetBestCaptureFormat(*converted, &format));
+  if (!found) return wrapper::org::webRtc::VideoFormatPtr();
 
   return UseVideoFormat::toWrapper(format);
 }
@@ -250,6 +289,41 @@ void wrapper::impl::org::webRtc::VideoCapturer::constrainSupportedFormats(wrappe
   }
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerPtr wrapper::impl::org::webRtc::VideoCapturer::createSharedCapturer(wrapper::org::webRtc::VideoFrameDropPolicy dropPolicy) noexcept
+{
+  ZS_ASSERT(fanout_);
+  if (!fanout_) return WrapperTypePtr();
+
+  ::webrtc::SharedVideoCapturer::CreationProperties props;
+  props.fanout_ = fanout_;
+  props.sinkOptions_.policy_ = UseEnum::toNative(dropPolicy);
+  props.sinkOptions_.queue_ = UseWebrtcLib::videoFrameProcessingQueue();
+
+  std::string id;
+  if (native_) {
+    // the source capturer is still available so mirror its formats
+    id = native_->GetId();
+    props.id_ = id.c_str();
+    auto formats = native_->GetSupportedFormats();
+    if (formats) props.formats_ = *formats;
+  }
+
+  auto native = ::webrtc::SharedVideoCapturer::create(props);
+  if (!native) return WrapperTypePtr();
+
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->fanout_ = fanout_;
+  result->sharedSink_ = native->sink();
+  result->framePool_ = framePool_;
+  result->crop_ = crop_;
+  result->changeDetector_ = changeDetector_;
+  result->native_ = NativeTypeUniPtr(native.release());
+  result->setupObserver();
+  return result;
+}
+
 //------------------------------------------------------------------------------
 String wrapper::impl::org::webRtc::VideoCapturer::get_id() noexcept
 {
@@ -355,6 +429,143 @@ wrapper::org::webRtc::VideoCaptureState wrapper::impl::org::webRtc::VideoCapture
   return UseEnum::toWrapper(native_->capture_state());
 }
 
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerCropPtr wrapper::impl::org::webRtc::VideoCapturer::get_crop() noexcept
+{
+  if (!crop_) return wrapper::org::webRtc::VideoCapturerCropPtr();
+  return UseVideoCapturerCrop::toWrapper(crop_->options());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturer::set_crop(wrapper::org::webRtc::VideoCapturerCropPtr value) noexcept
+{
+  ZS_ASSERT(crop_);
+  if (!crop_) return;
+
+  auto options = UseVideoCapturerCrop::toNative(value);
+  crop_->setOptions(options ? *options : ::webrtc::VideoCaptureCrop::Options{});
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoCapturer::get_parallelConversion() noexcept
+{
+  if (!native_) {
+    ZS_ASSERT_FAIL("Cannot call into VideoCapturer after VideoCapturer has been passed into to a VideoTrackSource.");
+    return false;
+  }
+  auto capturer = dynamic_cast<::webrtc::IVideoCapturer *>(native_.get());
+  if (!capturer) return false;
+  return capturer->parallelConversion();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturer::set_parallelConversion(bool value) noexcept
+{
+  if (!native_) {
+    ZS_ASSERT_FAIL("Cannot call into VideoCapturer after VideoCapturer has been passed into to a VideoTrackSource.");
+    return;
+  }
+
+  // shared capturers receive frames already converted by their source
+  auto capturer = dynamic_cast<::webrtc::IVideoCapturer *>(native_.get());
+  if (!capturer) return;
+  capturer->setParallelConversion(value);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoCapturer::get_deferRotation() noexcept
+{
+  if (!native_) {
+    ZS_ASSERT_FAIL("Cannot call into VideoCapturer after VideoCapturer has been passed into to a VideoTrackSource.");
+    return false;
+  }
+  auto capturer = dynamic_cast<::webrtc::IVideoCapturer *>(native_.get());
+  if (!capturer) return false;
+  return capturer->deferRotation();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturer::set_deferRotation(bool value) noexcept
+{
+  if (!native_) {
+    ZS_ASSERT_FAIL("Cannot call into VideoCapturer after VideoCapturer has been passed into to a VideoTrackSource.");
+    return;
+  }
+
+  // shared capturers receive frames already rotated (or not) by their source
+  auto capturer = dynamic_cast<::webrtc::IVideoCapturer *>(native_.get());
+  if (!capturer) return;
+  capturer->setDeferRotation(value);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerChangeDetectionPtr wrapper::impl::org::webRtc::VideoCapturer::get_changeDetection() noexcept
+{
+  if (!changeDetector_) return wrapper::org::webRtc::VideoCapturerChangeDetectionPtr();
+  return UseVideoCapturerChangeDetection::toWrapper(changeDetector_->options());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturer::set_changeDetection(wrapper::org::webRtc::VideoCapturerChangeDetectionPtr value) noexcept
+{
+  ZS_ASSERT(changeDetector_);
+  if (!changeDetector_) return;
+
+  auto options = UseVideoCapturerChangeDetection::toNative(value);
+  changeDetector_->setOptions(options ? *options : ::webrtc::VideoChangeDetector::Options{});
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerChangeStatsPtr wrapper::impl::org::webRtc::VideoCapturer::get_changeStats() noexcept
+{
+  if (!changeDetector_) return wrapper::org::webRtc::VideoCapturerChangeStatsPtr();
+  return UseVideoCapturerChangeStats::toWrapper(changeDetector_->stats());
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr wrapper::impl::org::webRtc::VideoCapturer::get_loadAdaptation() noexcept
+{
+  if (!loadMonitor_) return wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr();
+  return UseVideoCapturerLoadAdaptation::toWrapper(loadMonitor_->options());
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturer::set_loadAdaptation(wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr value) noexcept
+{
+  // shared capturers follow the format of their source
+  if (!loadMonitor_) return;
+
+  auto options = UseVideoCapturerLoadAdaptation::toNative(value);
+  loadMonitor_->setOptions(options ? *options : ::webrtc::VideoCaptureLoadMonitor::Options{});
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerLoadStatsPtr wrapper::impl::org::webRtc::VideoCapturer::get_loadStats() noexcept
+{
+  if (!loadMonitor_) return wrapper::org::webRtc::VideoCapturerLoadStatsPtr();
+  return UseVideoCapturerLoadStats::toWrapper(loadMonitor_->stats());
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerSharingStatsPtr wrapper::impl::org::webRtc::VideoCapturer::get_sharingStats() noexcept
+{
+  if ((!fanout_) || (!sharedSink_)) return wrapper::org::webRtc::VideoCapturerSharingStatsPtr();
+
+  ::webrtc::VideoFrameFanout::SinkStats stats;
+  if (!fanout_->sinkStats(sharedSink_, stats)) {
+    // not currently attached (stopped); report nothing rather than zeros
+    return wrapper::org::webRtc::VideoCapturerSharingStatsPtr();
+  }
+  return UseVideoCapturerSharingStats::toWrapper(stats);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerBufferPoolStatsPtr wrapper::impl::org::webRtc::VideoCapturer::get_bufferPoolStats() noexcept
+{
+  if (!framePool_) return wrapper::org::webRtc::VideoCapturerBufferPoolStatsPtr();
+  return UseVideoCapturerBufferPoolStats::toWrapper(framePool_->stats());
+}
+
 //------------------------------------------------------------------------------
 void wrapper::impl::org::webRtc::VideoCapturer::wrapper_onObserverCountChanged(size_t count) noexcept
 {
@@ -371,13 +582,14 @@ void wrapper::impl::org::webRtc::VideoCapturer::wrapper_onObserverCountChanged(s
       return;
 
     if (!needObservers) {
-      subscription_->cancel();
+      if (subscription_) subscription_->cancel();
       subscription_.reset();
       return;
     }
 
+    // shared capturers have no device frames of their own to forward
     auto capturer = (dynamic_cast<webrtc::VideoCapturer*>(native_.get()));
-    ZS_ASSERT(capturer);
+    if (!capturer) return;
 
     subscription_ = capturer->subscribe(videoObserver_);
   }
@@ -406,6 +618,12 @@ void WrapperImplType::onWebrtcObserverVideoFrameReceived(UseVideoFrameBufferEven
   onVideoFrame(event);
 }
 
+//------------------------------------------------------------------------------
+void WrapperImplType::onWebrtcObserverCaptureFormatAdapted(wrapper::org::webRtc::VideoFormatPtr format) noexcept
+{
+  onCaptureFormatAdapted(format);
+}
+
 //------------------------------------------------------------------------------
 WrapperImplTypePtr WrapperImplType::toWrapper(NativeTypeUniPtr native) noexcept
 {
@@ -5,6 +5,11 @@
 #include "generated/org_webRtc_VideoCapturer.h"
 
 #include "impl_webrtc_IVideoCapturer.h"
+#include "impl_webrtc_I420FramePool.h"
+#include "impl_webrtc_VideoCaptureCrop.h"
+#include "impl_webrtc_VideoCaptureLoadMonitor.h"
+#include "impl_webrtc_VideoChangeDetector.h"
+#include "impl_webrtc_VideoFrameFanout.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "rtc_base/scoped_ref_ptr.h"
@@ -48,6 +53,13 @@ namespace wrapper {
               if (!outer) return;
               outer->onWebrtcObserverVideoFrameReceived(event);
             }
+
+            void onCaptureFormatAdapted(wrapper::org::webRtc::VideoFormatPtr format) override
+            {
+              auto outer = outer_.lock();
+              if (!outer) return;
+              outer->onWebrtcObserverCaptureFormatAdapted(format);
+            }
 #endif // CPPWINRT_VERSION
 
           private:
@@ -64,6 +76,13 @@ namespace wrapper {
           size_t totalObservers_{};
           webrtc::IVideoCapturerSubscriptionPtr subscription_;
 
+          ::webrtc::VideoFrameFanoutPtr fanout_;                  // survives passing the capturer into a VideoTrackSource
+          ::webrtc::VideoFrameFanout::SinkType *sharedSink_ {};   // only set for shared capturers, used as a stats key
+          ::webrtc::I420FramePoolPtr framePool_;                  // pool of the capturer converting the frames
+          ::webrtc::VideoCaptureCropPtr crop_;                    // crop of the capturer converting the frames
+          ::webrtc::VideoChangeDetectorPtr changeDetector_;       // change detector of the capturer converting the frames
+          ::webrtc::VideoCaptureLoadMonitorPtr loadMonitor_;      // only set for capturers opening the device
+
           VideoCapturer() noexcept;
           virtual ~VideoCapturer() noexcept;
           void wrapper_dispose() noexcept override;
@@ -76,6 +95,7 @@ namespace wrapper {
           wrapper::org::webRtc::VideoFormatPtr getCaptureFormat() noexcept override;
           void stop() noexcept override;
           void constrainSupportedFormats(wrapper::org::webRtc::VideoFormatPtr maxFormat) noexcept override;
+          wrapper::org::webRtc::VideoCapturerPtr createSharedCapturer(wrapper::org::webRtc::VideoFrameDropPolicy dropPolicy) noexcept override;
 
           // properties VideoCapturer
           String get_id() noexcept override;
@@ -88,6 +108,20 @@ namespace wrapper {
           bool get_isScreencast() noexcept override;
           wrapper::org::webRtc::VideoCapturerInputSizePtr get_inputSize() noexcept override;
           wrapper::org::webRtc::VideoCaptureState get_state() noexcept override;
+          wrapper::org::webRtc::VideoCapturerCropPtr get_crop() noexcept override;
+          void set_crop(wrapper::org::webRtc::VideoCapturerCropPtr value) noexcept override;
+          bool get_parallelConversion() noexcept override;
+          void set_parallelConversion(bool value) noexcept override;
+          bool get_deferRotation() noexcept override;
+          void set_deferRotation(bool value) noexcept override;
+          wrapper::org::webRtc::VideoCapturerChangeDetectionPtr get_changeDetection() noexcept override;
+          void set_changeDetection(wrapper::org::webRtc::VideoCapturerChangeDetectionPtr value) noexcept override;
+          wrapper::org::webRtc::VideoCapturerChangeStatsPtr get_changeStats() noexcept override;
+          wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr get_loadAdaptation() noexcept override;
+          void set_loadAdaptation(wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr value) noexcept override;
+          wrapper::org::webRtc::VideoCapturerLoadStatsPtr get_loadStats() noexcept override;
+          wrapper::org::webRtc::VideoCapturerSharingStatsPtr get_sharingStats() noexcept override;
+          wrapper::org::webRtc::VideoCapturerBufferPoolStatsPtr get_bufferPoolStats() noexcept override;
 
           virtual void wrapper_onObserverCountChanged(size_t count) noexcept override;
 
@@ -96,6 +130,7 @@ namespace wrapper {
 
           // WebrtcObserver methods
           void onWebrtcObserverVideoFrameReceived(UseVideoFrameBufferEventPtr event) noexcept;
+          void onWebrtcObserverCaptureFormatAdapted(wrapper::org::webRtc::VideoFormatPtr format) noexcept;
 
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeTypeUniPtr native) noexcept;
           ZS_NO_DISCARD() static NativeTypeUniPtr toNative(WrapperTypePtr wrapper) noexcept;
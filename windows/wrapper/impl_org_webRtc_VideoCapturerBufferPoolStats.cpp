@@ -0,0 +1,63 @@
+
+#include "impl_org_webRtc_VideoCapturerBufferPoolStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats::VideoCapturerBufferPoolStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerBufferPoolStatsPtr wrapper::org::webRtc::VideoCapturerBufferPoolStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats::~VideoCapturerBufferPoolStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats::wrapper_init_org_webRtc_VideoCapturerBufferPoolStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->hits = SafeInt<decltype(result->hits)>(native.hits_);
+  result->misses = SafeInt<decltype(result->misses)>(native.misses_);
+  result->pooledBuffers = SafeInt<decltype(result->pooledBuffers)>(native.pooledBuffers_);
+  result->buffersInUse = SafeInt<decltype(result->buffersInUse)>(native.buffersInUse_);
+  return result;
+}
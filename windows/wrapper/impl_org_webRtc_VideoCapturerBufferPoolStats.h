@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerBufferPoolStats.h"
+
+#include "impl_webrtc_I420FramePool.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerBufferPoolStats : public wrapper::org::webRtc::VideoCapturerBufferPoolStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerBufferPoolStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerBufferPoolStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::I420FramePool::Stats, NativeType);
+
+          VideoCapturerBufferPoolStatsWeakPtr thisWeak_;
+
+          VideoCapturerBufferPoolStats() noexcept;
+          virtual ~VideoCapturerBufferPoolStats() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerBufferPoolStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
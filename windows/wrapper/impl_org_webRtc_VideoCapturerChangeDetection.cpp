@@ -0,0 +1,72 @@
+
+#include "impl_org_webRtc_VideoCapturerChangeDetection.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeDetection::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerChangeDetection::VideoCapturerChangeDetection() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerChangeDetectionPtr wrapper::org::webRtc::VideoCapturerChangeDetection::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoCapturerChangeDetection>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerChangeDetection::~VideoCapturerChangeDetection() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturerChangeDetection::wrapper_init_org_webRtc_VideoCapturerChangeDetection() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->enabled = native.enabled_;
+  result->keepAliveFramerate = native.keepAliveFramerate_;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->enabled_ = wrapper->enabled;
+  result->keepAliveFramerate_ = wrapper->keepAliveFramerate;
+  return result;
+}
@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerChangeDetection.h"
+
+#include "impl_webrtc_VideoChangeDetector.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerChangeDetection : public wrapper::org::webRtc::VideoCapturerChangeDetection
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerChangeDetection, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeDetection, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoChangeDetector::Options, NativeType);
+
+          VideoCapturerChangeDetectionWeakPtr thisWeak_;
+
+          VideoCapturerChangeDetection() noexcept;
+          virtual ~VideoCapturerChangeDetection() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerChangeDetection() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
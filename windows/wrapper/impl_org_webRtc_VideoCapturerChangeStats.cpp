@@ -0,0 +1,66 @@
+
+#include "impl_org_webRtc_VideoCapturerChangeStats.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeStats::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerChangeStats::VideoCapturerChangeStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerChangeStatsPtr wrapper::org::webRtc::VideoCapturerChangeStats::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoCapturerChangeStats>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerChangeStats::~VideoCapturerChangeStats() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturerChangeStats::wrapper_init_org_webRtc_VideoCapturerChangeStats() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->changedFrames = SafeInt<decltype(result->changedFrames)>(native.changed_);
+  result->unchangedFrames = SafeInt<decltype(result->unchangedFrames)>(native.unchanged_);
+  result->keepAliveFrames = SafeInt<decltype(result->keepAliveFrames)>(native.keepAlive_);
+  result->dirtyX = SafeInt<decltype(result->dirtyX)>(native.dirty_.x_);
+  result->dirtyY = SafeInt<decltype(result->dirtyY)>(native.dirty_.y_);
+  result->dirtyWidth = SafeInt<decltype(result->dirtyWidth)>(native.dirty_.width_);
+  result->dirtyHeight = SafeInt<decltype(result->dirtyHeight)>(native.dirty_.height_);
+  return result;
+}
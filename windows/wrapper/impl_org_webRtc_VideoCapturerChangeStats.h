@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerChangeStats.h"
+
+#include "impl_webrtc_VideoChangeDetector.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerChangeStats : public wrapper::org::webRtc::VideoCapturerChangeStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerChangeStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerChangeStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoChangeDetector::Stats, NativeType);
+
+          VideoCapturerChangeStatsWeakPtr thisWeak_;
+
+          VideoCapturerChangeStats() noexcept;
+          virtual ~VideoCapturerChangeStats() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerChangeStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
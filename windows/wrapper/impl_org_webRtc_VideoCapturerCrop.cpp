@@ -0,0 +1,80 @@
+
+#include "impl_org_webRtc_VideoCapturerCrop.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerCrop::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerCrop::VideoCapturerCrop() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerCropPtr wrapper::org::webRtc::VideoCapturerCrop::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoCapturerCrop>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerCrop::~VideoCapturerCrop() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturerCrop::wrapper_init_org_webRtc_VideoCapturerCrop() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->x = SafeInt<decltype(result->x)>(native.rect_.x_);
+  result->y = SafeInt<decltype(result->y)>(native.rect_.y_);
+  result->width = SafeInt<decltype(result->width)>(native.rect_.width_);
+  result->height = SafeInt<decltype(result->height)>(native.rect_.height_);
+  result->aspectRatioWidth = SafeInt<decltype(result->aspectRatioWidth)>(native.aspectRatioWidth_);
+  result->aspectRatioHeight = SafeInt<decltype(result->aspectRatioHeight)>(native.aspectRatioHeight_);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->rect_.x_ = SafeInt<decltype(result->rect_.x_)>(wrapper->x);
+  result->rect_.y_ = SafeInt<decltype(result->rect_.y_)>(wrapper->y);
+  result->rect_.width_ = SafeInt<decltype(result->rect_.width_)>(wrapper->width);
+  result->rect_.height_ = SafeInt<decltype(result->rect_.height_)>(wrapper->height);
+  result->aspectRatioWidth_ = SafeInt<decltype(result->aspectRatioWidth_)>(wrapper->aspectRatioWidth);
+  result->aspectRatioHeight_ = SafeInt<decltype(result->aspectRatioHeight_)>(wrapper->aspectRatioHeight);
+  return result;
+}
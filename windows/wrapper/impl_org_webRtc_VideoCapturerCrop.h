@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerCrop.h"
+
+#include "impl_webrtc_VideoCaptureCrop.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerCrop : public wrapper::org::webRtc::VideoCapturerCrop
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerCrop, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerCrop, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoCaptureCrop::Options, NativeType);
+
+          VideoCapturerCropWeakPtr thisWeak_;
+
+          VideoCapturerCrop() noexcept;
+          virtual ~VideoCapturerCrop() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerCrop() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
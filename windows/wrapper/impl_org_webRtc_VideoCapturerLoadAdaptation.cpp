@@ -0,0 +1,74 @@
+
+#include "impl_org_webRtc_VideoCapturerLoadAdaptation.h"
+
+#include <zsLib/SafeInt.h>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation::VideoCapturerLoadAdaptation() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoCapturerLoadAdaptationPtr wrapper::org::webRtc::VideoCapturerLoadAdaptation::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation::~VideoCapturerLoadAdaptation() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation::wrapper_init_org_webRtc_VideoCapturerLoadAdaptation() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->enabled = native.enabled_;
+  result->overuseThreshold = native.overuseLoad_;
+  result->underuseThreshold = native.underuseLoad_;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  result->enabled_ = wrapper->enabled;
+  result->overuseLoad_ = wrapper->overuseThreshold;
+  result->underuseLoad_ = wrapper->underuseThreshold;
+  return result;
+}
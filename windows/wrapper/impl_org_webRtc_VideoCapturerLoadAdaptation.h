@@ -0,0 +1,35 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerLoadAdaptation.h"
+
+#include "impl_webrtc_VideoCaptureLoadMonitor.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerLoadAdaptation : public wrapper::org::webRtc::VideoCapturerLoadAdaptation
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerLoadAdaptation, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerLoadAdaptation, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoCaptureLoadMonitor::Options, NativeType);
+
+          VideoCapturerLoadAdaptationWeakPtr thisWeak_;
+
+          VideoCapturerLoadAdaptation() noexcept;
+          virtual ~VideoCapturerLoadAdaptation() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerLoadAdaptation() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
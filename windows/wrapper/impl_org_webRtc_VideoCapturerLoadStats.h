@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerLoadStats.h"
+
+#include "impl_webrtc_VideoCaptureLoadMonitor.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerLoadStats : public wrapper::org::webRtc::VideoCapturerLoadStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerLoadStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerLoadStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoCaptureLoadMonitor::Stats, NativeType);
+
+          VideoCapturerLoadStatsWeakPtr thisWeak_;
+
+          VideoCapturerLoadStats() noexcept;
+          virtual ~VideoCapturerLoadStats() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerLoadStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoCapturerSharingStats.h"
+
+#include "impl_webrtc_VideoFrameFanout.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoCapturerSharingStats : public wrapper::org::webRtc::VideoCapturerSharingStats
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoCapturerSharingStats, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoCapturerSharingStats, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::webrtc::VideoFrameFanout::SinkStats, NativeType);
+
+          VideoCapturerSharingStatsWeakPtr thisWeak_;
+
+          VideoCapturerSharingStats() noexcept;
+          virtual ~VideoCapturerSharingStats() noexcept;
+
+          void wrapper_init_org_webRtc_VideoCapturerSharingStats() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
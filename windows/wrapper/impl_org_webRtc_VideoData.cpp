@@ -54,7 +54,34 @@ void wrapper::impl::org::webRtc::VideoData::wrapper_dispose() noexcept
   native_ = NativeTypeScopedRefPtr();
   buffer8bit_ = nullptr;
   buffer16bit_ = nullptr;
+  mutableBuffer8bit_ = nullptr;
   size_ = 0;
+  buffer_.clear();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoData::wrapper_init_org_webRtc_VideoData() noexcept
+{
+  wrapper_dispose();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoData::wrapper_init_org_webRtc_VideoData(size_t size) noexcept
+{
+  wrapper_dispose();
+  if (size < 1)
+    return;
+
+  buffer_.resize(size);
+  mutableBuffer8bit_ = &(buffer_.front());
+  buffer8bit_ = mutableBuffer8bit_;
+  size_ = size;
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoData::get_readOnly() noexcept
+{
+  return (!mutableBuffer8bit_) && ((buffer8bit_) || (buffer16bit_));
 }
 
 //------------------------------------------------------------------------------
@@ -82,6 +109,12 @@ const uint16_t * wrapper::impl::org::webRtc::VideoData::get_data16bit() noexcept
 }
 
 
+//------------------------------------------------------------------------------
+uint8_t * wrapper::impl::org::webRtc::VideoData::get_mutableData8bit() noexcept
+{
+  return mutableBuffer8bit_;
+}
+
 //------------------------------------------------------------------------------
 size_t wrapper::impl::org::webRtc::VideoData::get_size() noexcept
 {
@@ -141,3 +174,28 @@ WrapperImplTypePtr WrapperImplType::toWrapper(
     return {};
   return toWrapper(native.get(), buffer, size);
 }
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(
+  uint8_t *buffer,
+  size_t size) noexcept
+{
+  if (!buffer)
+    return {};
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  result->mutableBuffer8bit_ = buffer;
+  result->buffer8bit_ = buffer;
+  result->size_ = size;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper)
+    return {};
+
+  auto converted = ZS_DYNAMIC_PTR_CAST(WrapperImplType, wrapper);
+  return converted;
+}
@@ -26,18 +26,26 @@ namespace wrapper {
 
           const uint8_t *buffer8bit_ {};
           const uint16_t *buffer16bit_ {};
+          uint8_t *mutableBuffer8bit_ {};
           size_t size_ {};
+          std::vector<uint8_t> buffer_;
 
           VideoData() noexcept;
           virtual ~VideoData() noexcept;
           void wrapper_dispose() noexcept override;
 
 
+          // methods VideoData
+          void wrapper_init_org_webRtc_VideoData() noexcept override;
+          void wrapper_init_org_webRtc_VideoData(size_t size) noexcept override;
+
           // properties VideoData
+          bool get_readOnly() noexcept override;
           bool get_is8BitColorSpace() noexcept override;
           bool get_is16BitColorSpace() noexcept override;
           const uint8_t *get_data8bit() noexcept override;
           const uint16_t *get_data16bit() noexcept override;
+          uint8_t *get_mutableData8bit() noexcept override;
 
           size_t get_size() noexcept override;
 
@@ -61,6 +69,13 @@ namespace wrapper {
             const uint16_t *buffer,
             size_t size) noexcept;
 
+          // wraps writable memory owned by the caller, which must outlive
+          // the wrapper
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(
+            uint8_t *buffer,
+            size_t size) noexcept;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(WrapperTypePtr wrapper) noexcept;
         };
 
       } // webRtc
@@ -5,6 +5,7 @@
 #include "impl_org_webRtc_VideoFrameNativeBuffer.h"
 #include "impl_org_webRtc_VideoData.h"
 #include "impl_org_webRtc_enums.h"
+#include "impl_webrtc_VideoFrameExporter.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "api/video/video_frame_buffer.h"
@@ -40,6 +41,23 @@ ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer, Us
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer, UseVideoFramePlanarYuvaBuffer);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameNativeBuffer, UseVideoFrameNativeBuffer);
 
+namespace
+{
+  //----------------------------------------------------------------------------
+  ::webrtc::VideoFrameExporter::Plane toPlane(
+    wrapper::org::webRtc::VideoDataPtr data,
+    int stride) noexcept
+  {
+    ::webrtc::VideoFrameExporter::Plane result;
+    if (!data)
+      return result;
+    result.data_ = data->get_mutableData8bit();
+    result.stride_ = stride;
+    result.size_ = data->get_size();
+    return result;
+  }
+}
+
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::VideoFrameBuffer::VideoFrameBuffer() noexcept
 {
@@ -76,6 +94,45 @@ wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr wrapper::impl::org::webRtc::V
   return UseVideoFramePlanarYuvBuffer::toWrapper(i420Frame);
 }
 
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameBuffer::convertToNV12(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr uv,
+  int strideUV,
+  bool parallel
+  ) noexcept
+{
+  return convertToNV12(native_.get(), y, strideY, uv, strideUV, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameBuffer::convertToRgb(
+  wrapper::org::webRtc::VideoDataPtr rgb,
+  int stride,
+  wrapper::org::webRtc::VideoFrameRgbFormat format,
+  bool parallel
+  ) noexcept
+{
+  return convertToRgb(native_.get(), rgb, stride, format, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameBuffer::scaleToI420(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr u,
+  int strideU,
+  wrapper::org::webRtc::VideoDataPtr v,
+  int strideV,
+  int width,
+  int height,
+  bool parallel
+  ) noexcept
+{
+  return scaleToI420(native_.get(), y, strideY, u, strideU, v, strideV, width, height, parallel);
+}
+
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoFrameBufferType wrapper::impl::org::webRtc::VideoFrameBuffer::get_type() noexcept
 {
@@ -178,3 +235,51 @@ WrapperImplTypePtr WrapperImplType::toWrapper(NativeTypeScopedRefPtr native) noe
     return {};
   return toWrapper(native.get());
 }
+
+//------------------------------------------------------------------------------
+bool WrapperImplType::convertToNV12(
+  NativeType *native,
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr uv,
+  int strideUV,
+  bool parallel
+  ) noexcept
+{
+  if (!native)
+    return false;
+  return ::webrtc::VideoFrameExporter::toNV12(*native, toPlane(y, strideY), toPlane(uv, strideUV), parallel);
+}
+
+//------------------------------------------------------------------------------
+bool WrapperImplType::convertToRgb(
+  NativeType *native,
+  wrapper::org::webRtc::VideoDataPtr rgb,
+  int stride,
+  wrapper::org::webRtc::VideoFrameRgbFormat format,
+  bool parallel
+  ) noexcept
+{
+  if (!native)
+    return false;
+  return ::webrtc::VideoFrameExporter::toRgb(*native, toPlane(rgb, stride), UseEnum::toNative(format), parallel);
+}
+
+//------------------------------------------------------------------------------
+bool WrapperImplType::scaleToI420(
+  NativeType *native,
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr u,
+  int strideU,
+  wrapper::org::webRtc::VideoDataPtr v,
+  int strideV,
+  int width,
+  int height,
+  bool parallel
+  ) noexcept
+{
+  if (!native)
+    return false;
+  return ::webrtc::VideoFrameExporter::scaleToI420(*native, toPlane(y, strideY), toPlane(u, strideU), toPlane(v, strideV), width, height, parallel);
+}
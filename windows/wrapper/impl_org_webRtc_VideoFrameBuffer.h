@@ -34,6 +34,30 @@ namespace wrapper {
 
           // methods VideoFrameBuffer
           wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr toI420() noexcept override;
+          bool convertToNV12(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr uv,
+            int strideUV,
+            bool parallel
+            ) noexcept override;
+          bool convertToRgb(
+            wrapper::org::webRtc::VideoDataPtr rgb,
+            int stride,
+            wrapper::org::webRtc::VideoFrameRgbFormat format,
+            bool parallel
+            ) noexcept override;
+          bool scaleToI420(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr u,
+            int strideU,
+            wrapper::org::webRtc::VideoDataPtr v,
+            int strideV,
+            int width,
+            int height,
+            bool parallel
+            ) noexcept override;
 
           // properties VideoFrameBuffer
           wrapper::org::webRtc::VideoFrameBufferType get_type() noexcept override;
@@ -41,6 +65,35 @@ namespace wrapper {
           int get_height() noexcept override;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeType *native) noexcept;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeTypeScopedRefPtr native) noexcept;
+
+          // shared by every frame buffer wrapper type
+          ZS_NO_DISCARD() static bool convertToNV12(
+            NativeType *native,
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr uv,
+            int strideUV,
+            bool parallel
+            ) noexcept;
+          ZS_NO_DISCARD() static bool convertToRgb(
+            NativeType *native,
+            wrapper::org::webRtc::VideoDataPtr rgb,
+            int stride,
+            wrapper::org::webRtc::VideoFrameRgbFormat format,
+            bool parallel
+            ) noexcept;
+          ZS_NO_DISCARD() static bool scaleToI420(
+            NativeType *native,
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr u,
+            int strideU,
+            wrapper::org::webRtc::VideoDataPtr v,
+            int strideV,
+            int width,
+            int height,
+            bool parallel
+            ) noexcept;
           wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr get_yuvFrame() noexcept override;
           wrapper::org::webRtc::VideoFramePlanarYuvaBufferPtr get_yuvaFrame() noexcept override;
           wrapper::org::webRtc::VideoFrameNativeBufferPtr get_nativeFrame() noexcept override;
@@ -56,10 +56,20 @@ wrapper::org::webRtc::VideoFrameBufferPtr wrapper::impl::org::webRtc::VideoFrame
 }
 
 //------------------------------------------------------------------------------
-WrapperImplTypePtr WrapperImplType::toWrapper(UseVideoFrameBufferPtr buffer) noexcept
+int wrapper::impl::org::webRtc::VideoFrameBufferEvent::get_rotation() noexcept
+{
+  return rotation_;
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(
+  UseVideoFrameBufferPtr buffer,
+  int rotation
+  ) noexcept
 {
   auto result = make_shared<WrapperImplType>();
   result->thisWeak_ = result;
   result->buffer_ = buffer;
+  result->rotation_ = rotation;
   return result;
 }
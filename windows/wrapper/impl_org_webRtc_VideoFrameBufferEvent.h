@@ -18,6 +18,7 @@ namespace wrapper {
 
           VideoFrameBufferEventWeakPtr thisWeak_;
           UseVideoFrameBufferPtr buffer_;
+          int rotation_ {};
 
           VideoFrameBufferEvent() noexcept;
           virtual ~VideoFrameBufferEvent() noexcept;
@@ -26,8 +27,12 @@ namespace wrapper {
 
           // properties VideoFrameBufferEvent
           wrapper::org::webRtc::VideoFrameBufferPtr get_buffer() noexcept override;
+          int get_rotation() noexcept override;
 
-          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(UseVideoFrameBufferPtr buffer) noexcept;
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(
+            UseVideoFrameBufferPtr buffer,
+            int rotation = 0
+            ) noexcept;
         };
 
       } // webRtc
@@ -8,6 +8,7 @@
 
 #include "impl_org_webRtc_VideoFrameNativeBuffer.h"
 #include "impl_org_webRtc_VideoFramePlanarYuvBuffer.h"
+#include "impl_org_webRtc_VideoFrameBuffer.h"
 #include "impl_org_webRtc_MediaSample.h"
 #include "impl_org_webRtc_enums.h"
 
@@ -42,6 +43,7 @@ ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::MediaSample, UseMediaSample);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer, UseVideoFramePlanarYuvBuffer);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBuffer, UseVideoFrameBuffer);
 
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::VideoFrameNativeBuffer::VideoFrameNativeBuffer() noexcept
@@ -78,6 +80,45 @@ wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr wrapper::impl::org::webRtc::V
   return UseVideoFramePlanarYuvBuffer::toWrapper(i420Frame);
 }
 
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameNativeBuffer::convertToNV12(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr uv,
+  int strideUV,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToNV12(native_.get(), y, strideY, uv, strideUV, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameNativeBuffer::convertToRgb(
+  wrapper::org::webRtc::VideoDataPtr rgb,
+  int stride,
+  wrapper::org::webRtc::VideoFrameRgbFormat format,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToRgb(native_.get(), rgb, stride, format, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFrameNativeBuffer::scaleToI420(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr u,
+  int strideU,
+  wrapper::org::webRtc::VideoDataPtr v,
+  int strideV,
+  int width,
+  int height,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::scaleToI420(native_.get(), y, strideY, u, strideU, v, strideV, width, height, parallel);
+}
+
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoFrameBufferType wrapper::impl::org::webRtc::VideoFrameNativeBuffer::get_type() noexcept
 {
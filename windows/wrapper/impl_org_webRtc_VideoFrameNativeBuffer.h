@@ -32,6 +32,30 @@ namespace wrapper {
 
           // methods VideoFrameBuffer
           wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr toI420() noexcept override;
+          bool convertToNV12(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr uv,
+            int strideUV,
+            bool parallel
+            ) noexcept override;
+          bool convertToRgb(
+            wrapper::org::webRtc::VideoDataPtr rgb,
+            int stride,
+            wrapper::org::webRtc::VideoFrameRgbFormat format,
+            bool parallel
+            ) noexcept override;
+          bool scaleToI420(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr u,
+            int strideU,
+            wrapper::org::webRtc::VideoDataPtr v,
+            int strideV,
+            int width,
+            int height,
+            bool parallel
+            ) noexcept override;
 
           // properties VideoFrameBuffer
           wrapper::org::webRtc::VideoFrameBufferType get_type() noexcept override;
@@ -1,13 +1,17 @@
 
 #include "impl_org_webRtc_VideoFramePlanarYuvBuffer.h"
 #include "impl_org_webRtc_VideoFramePlanarYuvaBuffer.h"
+#include "impl_org_webRtc_VideoFrameBuffer.h"
 #include "impl_org_webRtc_VideoData.h"
+#include "impl_org_webRtc_VideoFramePlanes.h"
 #include "impl_org_webRtc_enums.h"
 
 #include "impl_org_webRtc_pre_include.h"
 #include "api/video/video_frame_buffer.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include <cstring>
+
 using ::zsLib::String;
 using ::zsLib::Optional;
 using ::zsLib::Any;
@@ -33,6 +37,7 @@ ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer, UseVideoFramePlanarYuvaBuffer);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoData, UseVideoData);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBuffer, UseVideoFrameBuffer);
 
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::VideoFramePlanarYuvBuffer() noexcept
@@ -60,11 +65,20 @@ void wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::wrapper_dispose() no
   nativeYuv_ = nullptr;
   nativeYuv8_ = nullptr;
   nativeYuv16_ = nullptr;
+  nativeNV12_ = nullptr;
 
   nativeI420_ = {};
   nativeI420A_ = {};
   nativeI444_ = {};
   nativeI010_ = {};
+
+  zsLib::AutoLock lock(lock_);
+  for (auto &resolved : planeResolved_) {
+    resolved = false;
+  }
+  contiguous_ = {};
+  contiguousResolved_ = false;
+  contiguousPacked_ = false;
 }
 
 //------------------------------------------------------------------------------
@@ -77,6 +91,45 @@ wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr wrapper::impl::org::webRtc::V
   return toWrapper(i420Frame);
 }
 
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::convertToNV12(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr uv,
+  int strideUV,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToNV12(native_, y, strideY, uv, strideUV, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::convertToRgb(
+  wrapper::org::webRtc::VideoDataPtr rgb,
+  int stride,
+  wrapper::org::webRtc::VideoFrameRgbFormat format,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToRgb(native_, rgb, stride, format, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::scaleToI420(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr u,
+  int strideU,
+  wrapper::org::webRtc::VideoDataPtr v,
+  int strideV,
+  int width,
+  int height,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::scaleToI420(native_, y, strideY, u, strideU, v, strideV, width, height, parallel);
+}
+
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoFrameBufferType wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_type() noexcept
 {
@@ -170,50 +223,155 @@ int wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_strideV() noexcep
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_y() noexcept
 {
-  if (nativeYuv8_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv8_->DataY(), nativeYuv_->StrideY() * nativeYuv_->height());
-  } else if (nativeYuv16_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv16_->DataY(), nativeYuv_->StrideY() * nativeYuv_->height());
-  }
-  ZS_ASSERT_FAIL("native pointer is gone");
-  return {};
+  return planeView(UsePlaneLayout::Plane_Y);
 }
 
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_u() noexcept
 {
-  if (nativeYuv8_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv8_->DataU(), nativeYuv_->StrideU() * ((nativeYuv_->height()+1)/2));
+  return planeView(UsePlaneLayout::Plane_U);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_v() noexcept
+{
+  return planeView(UsePlaneLayout::Plane_V);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_hasInterleavedChroma() noexcept
+{
+  return nullptr != nativeNV12_;
+}
+
+//------------------------------------------------------------------------------
+int wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_strideUV() noexcept
+{
+  if (!nativeNV12_)
+    return {};
+  return nativeNV12_->StrideUV();
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_uv() noexcept
+{
+  if (!nativeNV12_)
+    return {};
+  return planeView(UsePlaneLayout::Plane_UV);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoFramePlanesPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_planes() noexcept
+{
+  if (!nativeYuv_)
+    return {};
+
+  // chroma of an NV12 buffer is only described interleaved so reading the
+  // planes never forces it to be split
+  auto planes = wrapper::org::webRtc::VideoFramePlanes::wrapper_create();
+  planes->width = nativeYuv_->width();
+  planes->height = nativeYuv_->height();
+  planes->chromaWidth = nativeYuv_->ChromaWidth();
+  planes->chromaHeight = nativeYuv_->ChromaHeight();
+  planes->y = planeView(UsePlaneLayout::Plane_Y);
+  planes->strideY = nativeYuv_->StrideY();
+  if (nativeNV12_) {
+    planes->uv = planeView(UsePlaneLayout::Plane_UV);
+    planes->strideUV = nativeNV12_->StrideUV();
+  } else {
+    planes->u = planeView(UsePlaneLayout::Plane_U);
+    planes->strideU = nativeYuv_->StrideU();
+    planes->v = planeView(UsePlaneLayout::Plane_V);
+    planes->strideV = nativeYuv_->StrideV();
   }
-  else if (nativeYuv16_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv16_->DataU(), nativeYuv_->StrideU() * ((nativeYuv_->height() + 1) / 2));
+  if (nativeI420A_) {
+    planes->a = planeView(UsePlaneLayout::Plane_A);
+    planes->strideA = nativeI420A_->StrideA();
   }
-  ZS_ASSERT_FAIL("native pointer is gone");
-  return {};
+  return planes;
 }
 
 //------------------------------------------------------------------------------
-wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_v() noexcept
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::get_contiguous() noexcept
 {
-  if (nativeYuv8_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv8_->DataV(), nativeYuv_->StrideV() * ((nativeYuv_->height() + 1) / 2));
+  PlaneSpan span;
+  bool packed {};
+
+  {
+    zsLib::AutoLock lock(lock_);
+    if (!contiguousResolved_) {
+      if (native_) {
+        contiguousPacked_ = !UsePlaneLayout::contiguous(*native_, contiguous_);
+      }
+      contiguousResolved_ = true;
+    }
+    span = contiguous_;
+    packed = contiguousPacked_;
+  }
+
+  if (!packed)
+    return viewOf(span);
+
+  // 16 bit planes are never packed
+  if (nativeYuv16_)
+    return {};
+
+  // each caller gets its own copy, which it may dispose without affecting
+  // any other view of this buffer
+  if (!native_)
+    return {};
+
+  PlaneSpan spans[UsePlaneLayout::kMaxPlanes];
+  const size_t totalSpans = UsePlaneLayout::collect(*native_, spans);
+  size_t totalSize {};
+  for (size_t index = 0; index < totalSpans; ++index) {
+    totalSize += spans[index].byteSize();
   }
-  else if (nativeYuv16_) {
-    ZS_ASSERT(native_);
-    ZS_ASSERT(nativeYuv_);
-    return UseVideoData::toWrapper(native_, nativeYuv16_->DataV(), nativeYuv_->StrideV() * ((nativeYuv_->height() + 1) / 2));
+
+  auto packedData = wrapper::org::webRtc::VideoData::wrapper_create();
+  packedData->wrapper_init_org_webRtc_VideoData(totalSize);
+
+  uint8_t *dest = packedData->get_mutableData8bit();
+  if (!dest)
+    return {};
+
+  for (size_t index = 0; index < totalSpans; ++index) {
+    memcpy(dest, spans[index].bytes(), spans[index].byteSize());
+    dest += spans[index].byteSize();
   }
-  ZS_ASSERT_FAIL("native pointer is gone");
+  return packedData;
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::planeView(UsePlaneLayout::Planes plane) noexcept
+{
+  PlaneSpan span;
+
+  {
+    zsLib::AutoLock lock(lock_);
+    if (!planeResolved_[plane]) {
+      if (native_) {
+        planes_[plane] = UsePlaneLayout::locate(*native_, plane);
+      }
+      planeResolved_[plane] = true;
+    }
+    span = planes_[plane];
+  }
+
+  return viewOf(span);
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer::viewOf(const PlaneSpan &span) noexcept
+{
+  // views are disposable so every caller gets its own; they are small and
+  // keep the native buffer alive on their own
+  if (!native_)
+    return {};
+  if (span.data8bit_)
+    return UseVideoData::toWrapper(native_, span.data8bit_, span.size_);
+  if (span.data16bit_)
+    return UseVideoData::toWrapper(native_, span.data16bit_, span.size_);
   return {};
 }
 
@@ -227,6 +385,7 @@ WrapperImplTypePtr WrapperImplType::toWrapper(NativeI420Type *native) noexcept
   result->native_ = native;
   result->nativeYuv_ = native;
   result->nativeYuv8_ = native;
+  result->nativeNV12_ = dynamic_cast<::webrtc::NV12Buffer *>(native);
   result->nativeI420_ = NativeI420TypeScopedRefPtr(native);
   return result;
 }
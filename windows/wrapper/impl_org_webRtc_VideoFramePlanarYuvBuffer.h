@@ -8,6 +8,9 @@
 #include "rtc_base/scoped_ref_ptr.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include "impl_webrtc_NV12Buffer.h"
+#include "impl_webrtc_VideoFramePlaneLayout.h"
+
 namespace wrapper {
   namespace impl {
     namespace org {
@@ -37,12 +40,27 @@ namespace wrapper {
           NativePlanarYuvBufferType *nativeYuv_{};
           NativePlanarYuv8BufferType *nativeYuv8_{};
           NativePlanarYuv16BufferType *nativeYuv16_{};
+          ::webrtc::NV12Buffer *nativeNV12_{};
 
           NativeI420TypeScopedRefPtr nativeI420_;
           NativeI420ATypeScopedRefPtr nativeI420A_;
           NativeI444TypeScopedRefPtr nativeI444_;
           NativeI010TypeScopedRefPtr nativeI010_;
 
+          typedef ::webrtc::VideoFramePlaneLayout UsePlaneLayout;
+          typedef UsePlaneLayout::Span PlaneSpan;
+
+          // Plane locations are resolved on first access and then reused.
+          // Views are disposable, so every caller gets a view of its own
+          // over them; one consumer disposing its view never empties
+          // another's.
+          zsLib::Lock lock_;
+          PlaneSpan planes_[UsePlaneLayout::Plane_Total];
+          bool planeResolved_[UsePlaneLayout::Plane_Total] {};
+          PlaneSpan contiguous_;
+          bool contiguousResolved_ {};
+          bool contiguousPacked_ {};          // planes are apart and copied per caller
+
           VideoFramePlanarYuvBuffer() noexcept;
           virtual ~VideoFramePlanarYuvBuffer() noexcept;
 
@@ -50,6 +68,30 @@ namespace wrapper {
 
           // methods VideoFrameBuffer
           wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr toI420() noexcept override;
+          bool convertToNV12(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr uv,
+            int strideUV,
+            bool parallel
+            ) noexcept override;
+          bool convertToRgb(
+            wrapper::org::webRtc::VideoDataPtr rgb,
+            int stride,
+            wrapper::org::webRtc::VideoFrameRgbFormat format,
+            bool parallel
+            ) noexcept override;
+          bool scaleToI420(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr u,
+            int strideU,
+            wrapper::org::webRtc::VideoDataPtr v,
+            int strideV,
+            int width,
+            int height,
+            bool parallel
+            ) noexcept override;
 
           // properties VideoFrameBuffer
           wrapper::org::webRtc::VideoFrameBufferType get_type() noexcept override;
@@ -68,6 +110,13 @@ namespace wrapper {
           wrapper::org::webRtc::VideoDataPtr get_y() noexcept override;
           wrapper::org::webRtc::VideoDataPtr get_u() noexcept override;
           wrapper::org::webRtc::VideoDataPtr get_v() noexcept override;
+          bool get_hasInterleavedChroma() noexcept override;
+          int get_strideUV() noexcept override;
+          wrapper::org::webRtc::VideoDataPtr get_uv() noexcept override;
+          wrapper::org::webRtc::VideoFramePlanesPtr get_planes() noexcept override;
+          wrapper::org::webRtc::VideoDataPtr get_contiguous() noexcept override;
+
+          wrapper::org::webRtc::VideoDataPtr planeView(UsePlaneLayout::Planes plane) noexcept;
 
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeI420Type *native) noexcept;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeI420TypeScopedRefPtr native) noexcept;
@@ -80,6 +129,9 @@ namespace wrapper {
 
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeI010Type *native) noexcept;
           ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(NativeI010TypeScopedRefPtr native) noexcept;
+
+        private:
+          wrapper::org::webRtc::VideoDataPtr viewOf(const PlaneSpan &span) noexcept;
         };
 
       } // webRtc
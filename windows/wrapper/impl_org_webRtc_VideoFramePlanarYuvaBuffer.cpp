@@ -1,6 +1,7 @@
 
 #include "impl_org_webRtc_VideoFramePlanarYuvaBuffer.h"
 #include "impl_org_webRtc_VideoFramePlanarYuvBuffer.h"
+#include "impl_org_webRtc_VideoFrameBuffer.h"
 #include "impl_org_webRtc_VideoData.h"
 #include "impl_org_webRtc_enums.h"
 
@@ -33,6 +34,7 @@ ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::IEnum, UseEnum);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanarYuvBuffer, UseVideoFramePlanarYuvBuffer);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoData, UseVideoData);
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBuffer, UseVideoFrameBuffer);
 
 //------------------------------------------------------------------------------
 wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::VideoFramePlanarYuvaBuffer() noexcept
@@ -57,6 +59,9 @@ wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::~VideoFramePlanarYuvaBuf
 void wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::wrapper_dispose() noexcept
 {
   native_ = {};
+  if (yuvBuffer_)
+    yuvBuffer_->wrapper_dispose();
+  yuvBuffer_.reset();
 }
 
 //------------------------------------------------------------------------------
@@ -69,6 +74,45 @@ wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr wrapper::impl::org::webRtc::V
   return UseVideoFramePlanarYuvBuffer::toWrapper(i420Frame);
 }
 
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::convertToNV12(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr uv,
+  int strideUV,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToNV12(native_.get(), y, strideY, uv, strideUV, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::convertToRgb(
+  wrapper::org::webRtc::VideoDataPtr rgb,
+  int stride,
+  wrapper::org::webRtc::VideoFrameRgbFormat format,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::convertToRgb(native_.get(), rgb, stride, format, parallel);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::scaleToI420(
+  wrapper::org::webRtc::VideoDataPtr y,
+  int strideY,
+  wrapper::org::webRtc::VideoDataPtr u,
+  int strideU,
+  wrapper::org::webRtc::VideoDataPtr v,
+  int strideV,
+  int width,
+  int height,
+  bool parallel
+  ) noexcept
+{
+  return UseVideoFrameBuffer::scaleToI420(native_.get(), y, strideY, u, strideU, v, strideV, width, height, parallel);
+}
+
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoFrameBufferType wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_type() noexcept
 {
@@ -156,34 +200,65 @@ int wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_strideV() noexce
   ZS_ASSERT(native_);
   if (!native_)
     return {};
-  return native_->StrideY();
+  return native_->StrideV();
 }
 
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_y() noexcept
 {
-  ZS_ASSERT(native_);
-  if (!native_)
+  if (!yuvBuffer_)
     return {};
-  return UseVideoData::toWrapper(native_.get(), native_->DataY(), native_->StrideY() * native_->height());
+  return yuvBuffer_->planeView(UseVideoFramePlanarYuvBuffer::UsePlaneLayout::Plane_Y);
 }
 
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_u() noexcept
 {
-  ZS_ASSERT(native_);
-  if (!native_)
+  if (!yuvBuffer_)
     return {};
-  return UseVideoData::toWrapper(native_.get(), native_->DataU(), native_->StrideU() * ((native_->height() + 1) / 2));
+  return yuvBuffer_->planeView(UseVideoFramePlanarYuvBuffer::UsePlaneLayout::Plane_U);
 }
 
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_v() noexcept
 {
-  ZS_ASSERT(native_);
-  if (!native_)
+  if (!yuvBuffer_)
     return {};
-  return UseVideoData::toWrapper(native_.get(), native_->DataV(), native_->StrideV() * ((native_->height() + 1) / 2));
+  return yuvBuffer_->planeView(UseVideoFramePlanarYuvBuffer::UsePlaneLayout::Plane_V);
+}
+
+//------------------------------------------------------------------------------
+bool wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_hasInterleavedChroma() noexcept
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+int wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_strideUV() noexcept
+{
+  return {};
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_uv() noexcept
+{
+  return {};
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoFramePlanesPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_planes() noexcept
+{
+  if (!yuvBuffer_)
+    return {};
+  return yuvBuffer_->get_planes();
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_contiguous() noexcept
+{
+  if (!yuvBuffer_)
+    return {};
+  return yuvBuffer_->get_contiguous();
 }
 
 //------------------------------------------------------------------------------
@@ -198,10 +273,9 @@ int wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_strideA() noexce
 //------------------------------------------------------------------------------
 wrapper::org::webRtc::VideoDataPtr wrapper::impl::org::webRtc::VideoFramePlanarYuvaBuffer::get_a() noexcept
 {
-  ZS_ASSERT(native_);
-  if (!native_)
+  if (!yuvBuffer_)
     return {};
-  return UseVideoData::toWrapper(native_.get(), native_->DataA(), native_->StrideA() * ((native_->height() + 1) / 2));
+  return yuvBuffer_->planeView(UseVideoFramePlanarYuvBuffer::UsePlaneLayout::Plane_A);
 }
 
 //------------------------------------------------------------------------------
@@ -212,6 +286,7 @@ WrapperImplTypePtr WrapperImplType::toWrapper(NativeI420AType *native) noexcept
   auto result = make_shared<WrapperImplType>();
   result->thisWeak_ = result;
   result->native_ = NativeI420ATypeScopedRefPtr(native);
+  result->yuvBuffer_ = UseVideoFramePlanarYuvBuffer::toWrapper(native);
   return result;
 }
 
@@ -23,6 +23,7 @@ namespace wrapper {
 
           VideoFramePlanarYuvaBufferWeakPtr thisWeak_;
           NativeI420ATypeScopedRefPtr native_;
+          VideoFramePlanarYuvBufferPtr yuvBuffer_;  // owns the cached plane locations
 
           VideoFramePlanarYuvaBuffer() noexcept;
           virtual ~VideoFramePlanarYuvaBuffer() noexcept;
@@ -31,6 +32,30 @@ namespace wrapper {
 
           // methods VideoFrameBuffer
           wrapper::org::webRtc::VideoFramePlanarYuvBufferPtr toI420() noexcept override;
+          bool convertToNV12(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr uv,
+            int strideUV,
+            bool parallel
+            ) noexcept override;
+          bool convertToRgb(
+            wrapper::org::webRtc::VideoDataPtr rgb,
+            int stride,
+            wrapper::org::webRtc::VideoFrameRgbFormat format,
+            bool parallel
+            ) noexcept override;
+          bool scaleToI420(
+            wrapper::org::webRtc::VideoDataPtr y,
+            int strideY,
+            wrapper::org::webRtc::VideoDataPtr u,
+            int strideU,
+            wrapper::org::webRtc::VideoDataPtr v,
+            int strideV,
+            int width,
+            int height,
+            bool parallel
+            ) noexcept override;
 
           // properties VideoFrameBuffer
           wrapper::org::webRtc::VideoFrameBufferType get_type() noexcept override;
@@ -49,6 +74,11 @@ namespace wrapper {
           wrapper::org::webRtc::VideoDataPtr get_y() noexcept override;
           wrapper::org::webRtc::VideoDataPtr get_u() noexcept override;
           wrapper::org::webRtc::VideoDataPtr get_v() noexcept override;
+          bool get_hasInterleavedChroma() noexcept override;
+          int get_strideUV() noexcept override;
+          wrapper::org::webRtc::VideoDataPtr get_uv() noexcept override;
+          wrapper::org::webRtc::VideoFramePlanesPtr get_planes() noexcept override;
+          wrapper::org::webRtc::VideoDataPtr get_contiguous() noexcept override;
 
           // properties VideoFramePlanarYuvaBuffer
           int get_strideA() noexcept override;
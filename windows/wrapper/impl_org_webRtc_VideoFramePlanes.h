@@ -0,0 +1,28 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoFramePlanes.h"
+
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoFramePlanes : public wrapper::org::webRtc::VideoFramePlanes
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoFramePlanes, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFramePlanes, WrapperImplType);
+          VideoFramePlanesWeakPtr thisWeak_;
+
+          VideoFramePlanes() noexcept;
+          virtual ~VideoFramePlanes() noexcept;
+          void wrapper_init_org_webRtc_VideoFramePlanes() noexcept override;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
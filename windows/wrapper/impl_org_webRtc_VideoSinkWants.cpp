@@ -0,0 +1,90 @@
+
+#include "impl_org_webRtc_VideoSinkWants.h"
+
+#include <zsLib/SafeInt.h>
+
+#include <limits>
+
+using ::zsLib::String;
+using ::zsLib::Optional;
+using ::zsLib::Any;
+using ::zsLib::AnyPtr;
+using ::zsLib::AnyHolder;
+using ::zsLib::Promise;
+using ::zsLib::PromisePtr;
+using ::zsLib::PromiseWithHolder;
+using ::zsLib::PromiseWithHolderPtr;
+using ::zsLib::eventing::SecureByteBlock;
+using ::zsLib::eventing::SecureByteBlockPtr;
+using ::std::shared_ptr;
+using ::std::weak_ptr;
+using ::std::make_shared;
+using ::std::list;
+using ::std::set;
+using ::std::map;
+
+// borrow definitions from class
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoSinkWants::WrapperImplType, WrapperImplType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::WrapperType, WrapperType);
+ZS_DECLARE_TYPEDEF_PTR(WrapperImplType::NativeType, NativeType);
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoSinkWants::VideoSinkWants() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::VideoSinkWantsPtr wrapper::org::webRtc::VideoSinkWants::wrapper_create() noexcept
+{
+  auto pThis = make_shared<wrapper::impl::org::webRtc::VideoSinkWants>();
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//------------------------------------------------------------------------------
+wrapper::impl::org::webRtc::VideoSinkWants::~VideoSinkWants() noexcept
+{
+  thisWeak_.reset();
+}
+
+//------------------------------------------------------------------------------
+void wrapper::impl::org::webRtc::VideoSinkWants::wrapper_init_org_webRtc_VideoSinkWants() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+WrapperImplTypePtr WrapperImplType::toWrapper(const NativeType &native) noexcept
+{
+  auto result = make_shared<WrapperImplType>();
+  result->thisWeak_ = result;
+  if (std::numeric_limits<int>::max() != native.max_pixel_count) {
+    result->maxPixelCount = SafeInt<decltype(result->maxPixelCount)::value_type>(native.max_pixel_count);
+  }
+  if (native.target_pixel_count) {
+    result->targetPixelCount = SafeInt<decltype(result->targetPixelCount)::value_type>(*native.target_pixel_count);
+  }
+  if (std::numeric_limits<int>::max() != native.max_framerate_fps) {
+    result->maxFramerate = SafeInt<decltype(result->maxFramerate)::value_type>(native.max_framerate_fps);
+  }
+  result->rotationApplied = native.rotation_applied;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+NativeTypePtr WrapperImplType::toNative(WrapperTypePtr wrapper) noexcept
+{
+  if (!wrapper) return NativeTypePtr();
+
+  auto result = make_shared<NativeType>();
+  if (wrapper->maxPixelCount.has_value()) {
+    result->max_pixel_count = (int)SafeInt<int>(wrapper->maxPixelCount.value());
+  }
+  if (wrapper->targetPixelCount.has_value()) {
+    result->target_pixel_count = (int)SafeInt<int>(wrapper->targetPixelCount.value());
+  }
+  if (wrapper->maxFramerate.has_value()) {
+    result->max_framerate_fps = (int)SafeInt<int>(wrapper->maxFramerate.value());
+  }
+  result->rotation_applied = wrapper->rotationApplied;
+  return result;
+}
@@ -0,0 +1,37 @@
+
+#pragma once
+
+#include "types.h"
+#include "generated/org_webRtc_VideoSinkWants.h"
+
+#include "impl_org_webRtc_pre_include.h"
+#include "api/videosourceinterface.h"
+#include "impl_org_webRtc_post_include.h"
+
+namespace wrapper {
+  namespace impl {
+    namespace org {
+      namespace webRtc {
+
+        struct VideoSinkWants : public wrapper::org::webRtc::VideoSinkWants
+        {
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::org::webRtc::VideoSinkWants, WrapperType);
+          ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoSinkWants, WrapperImplType);
+          ZS_DECLARE_TYPEDEF_PTR(::rtc::VideoSinkWants, NativeType);
+
+          VideoSinkWantsWeakPtr thisWeak_;
+
+          VideoSinkWants() noexcept;
+          virtual ~VideoSinkWants() noexcept;
+
+          void wrapper_init_org_webRtc_VideoSinkWants() noexcept override;
+
+          ZS_NO_DISCARD() static WrapperImplTypePtr toWrapper(const NativeType &native) noexcept;
+          ZS_NO_DISCARD() static NativeTypePtr toNative(WrapperTypePtr wrapper) noexcept;
+        };
+
+      } // webRtc
+    } // org
+  } // namespace impl
+} // namespace wrapper
+
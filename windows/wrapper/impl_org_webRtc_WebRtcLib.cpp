@@ -17,8 +17,11 @@
 #include "impl_webrtc_IVideoCapturer.h"
 #include "impl_webrtc_IVideoCaptureMediaSink.h"
 #include "impl_webrtc_IAudioDeviceWasapi.h"
+#include "impl_webrtc_VideoFrameTrace.h"
+#include "impl_webrtc_VideoLatencyProbe.h"
 
 #include <zsLib/IMessageQueueThread.h>
+#include <zsLib/SafeInt.h>
 
 #include "impl_org_webRtc_pre_include.h"
 #include "rtc_base/event_tracer.h"
@@ -172,6 +175,7 @@ void WrapperImplType::actual_setup(wrapper::org::webRtc::WebRtcLibConfigurationP
   wrapper::org::webRtc::EventQueuePtr audioCaptureFrameProcessingQueue = configuration ? configuration->audioCaptureFrameProcessingQueue : nullptr;
   wrapper::org::webRtc::EventQueuePtr audioRenderFrameProcessingQueue = configuration ? configuration->audioRenderFrameProcessingQueue : nullptr;
   wrapper::org::webRtc::EventQueuePtr videoFrameProcessingQueue = configuration ? configuration->videoFrameProcessingQueue : nullptr;
+  uint64_t videoFrameTraceInterval = configuration ? configuration->videoFrameTraceInterval : ::webrtc::VideoFrameTrace::kDefaultInterval;
 
   // Setup for WinWUP...
 
@@ -210,6 +214,8 @@ void WrapperImplType::actual_setup(wrapper::org::webRtc::WebRtcLibConfigurationP
     videoFrameProcessingQueue_ = nativeQueue ? nativeQueue : actual_delegateQueue();
   }
 
+  ::webrtc::VideoFrameTrace::setInterval(SafeInt<size_t>(videoFrameTraceInterval));
+
   rtc::tracing::SetupInternalTracer();
 
   if (setupComplete_.exchange(true)) {
@@ -319,13 +325,15 @@ void WrapperImplType::actual_set_ntpServerTime(::zsLib::Milliseconds value) noex
 {
   if (!actual_checkSetup()) return;
 
+  // Remember how far off the engine's clock is so engine timestamps can be
+  // reported on the server's clock instead.
+  const int64_t offsetMs = ::webrtc::VideoLatencyProbe::ntpOffsetMs(value.count());
+
   {
     zsLib::AutoLock lock(lock_);
     ntpServerTime_ = value;
   }
-
-#pragma ZS_BUILD_NOTE("TODO","(mosa) set the NTP time from the server inside webrtc engine here")
-
+  ntpOffsetMs_ = offsetMs;
 }
 
 //------------------------------------------------------------------------------
@@ -364,6 +372,12 @@ zsLib::IMessageQueuePtr WrapperImplType::actual_videoFrameProcessingQueue() noex
   return videoFrameProcessingQueue_;
 }
 
+//------------------------------------------------------------------------------
+::zsLib::Milliseconds WrapperImplType::actual_ntpOffset() noexcept
+{
+  return ::zsLib::Milliseconds(ntpOffsetMs_.load());
+}
+
 //------------------------------------------------------------------------------
 void WrapperImplType::notifySingletonCleanup() noexcept
 {
@@ -408,6 +422,7 @@ WrapperImplTypePtr WrapperImplType::singleton() noexcept
 
       ::zsLib::Milliseconds actual_get_ntpServerTime() noexcept final { return zsLib::Milliseconds(); }
       void actual_set_ntpServerTime(::zsLib::Milliseconds) noexcept final {}
+      ::zsLib::Milliseconds actual_ntpOffset() noexcept final { return zsLib::Milliseconds(); }
 
       bool actual_checkSetup(bool) noexcept final { return false; }
 
@@ -476,3 +491,10 @@ zsLib::IMessageQueuePtr WrapperImplType::videoFrameProcessingQueue() noexcept
   auto singleton = WrapperImplType::singleton();
   return singleton->actual_videoFrameProcessingQueue();
 }
+
+//------------------------------------------------------------------------------
+::zsLib::Milliseconds WrapperImplType::ntpOffset() noexcept
+{
+  auto singleton = WrapperImplType::singleton();
+  return singleton->actual_ntpOffset();
+}
@@ -36,6 +36,7 @@ namespace wrapper {
           std::atomic_bool isTracing_ {};
           zsLib::Lock lock_;
           ::zsLib::Milliseconds ntpServerTime_;
+          std::atomic<int64_t> ntpOffsetMs_ {};
           ::zsLib::IMessageQueuePtr audioCaptureFrameProcessingQueue_;
           ::zsLib::IMessageQueuePtr audioRenderFrameProcessingQueue_;
           ::zsLib::IMessageQueuePtr videoFrameProcessingQueue_;
@@ -64,6 +65,7 @@ namespace wrapper {
           virtual zsLib::IMessageQueuePtr actual_audioCaptureFrameProcessingQueue() noexcept;
           virtual zsLib::IMessageQueuePtr actual_audioRenderFrameProcessingQueue() noexcept;
           virtual zsLib::IMessageQueuePtr actual_videoFrameProcessingQueue() noexcept;
+          virtual ::zsLib::Milliseconds actual_ntpOffset() noexcept;
 
           //-------------------------------------------------------------------
           //
@@ -80,6 +82,11 @@ namespace wrapper {
           static zsLib::IMessageQueuePtr audioCaptureFrameProcessingQueue() noexcept;
           static zsLib::IMessageQueuePtr audioRenderFrameProcessingQueue() noexcept;
           static zsLib::IMessageQueuePtr videoFrameProcessingQueue() noexcept;
+
+          // Difference between the NTP server time and the engine's NTP
+          // clock, zero until the server time is set. Adding it to an engine
+          // NTP timestamp gives the same moment on the server's clock.
+          static ::zsLib::Milliseconds ntpOffset() noexcept;
         };
 
       } // webRtc
@@ -994,6 +994,82 @@ wrapper::org::webRtc::VideoCaptureState UseEnum::toWrapper(::cricket::CaptureSta
   return ::cricket::CaptureState::CS_STOPPED;
 }
 
+//-----------------------------------------------------------------------------
+wrapper::org::webRtc::VideoFrameDropPolicy UseEnum::toWrapper(::webrtc::VideoFrameFanout::DropPolicy value) noexcept
+{
+  switch (value)
+  {
+    case ::webrtc::VideoFrameFanout::DropPolicy_None:         return wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_none;
+    case ::webrtc::VideoFrameFanout::DropPolicy_DropIfBusy:   return wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_dropIfBusy;
+    case ::webrtc::VideoFrameFanout::DropPolicy_LatestOnly:   return wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_latestOnly;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_none;
+}
+
+//-----------------------------------------------------------------------------
+::webrtc::VideoFrameFanout::DropPolicy UseEnum::toNative(wrapper::org::webRtc::VideoFrameDropPolicy value) noexcept
+{
+  switch (value)
+  {
+    case wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_none:         return ::webrtc::VideoFrameFanout::DropPolicy_None;
+    case wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_dropIfBusy:   return ::webrtc::VideoFrameFanout::DropPolicy_DropIfBusy;
+    case wrapper::org::webRtc::VideoFrameDropPolicy::VideoFrameDropPolicy_latestOnly:   return ::webrtc::VideoFrameFanout::DropPolicy_LatestOnly;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return ::webrtc::VideoFrameFanout::DropPolicy_None;
+}
+
+//-----------------------------------------------------------------------------
+wrapper::org::webRtc::VideoRenderLatencyMode UseEnum::toWrapper(::webrtc::RenderFrameQueueTypes::LatencyMode value) noexcept
+{
+  switch (value)
+  {
+    case ::webrtc::RenderFrameQueueTypes::LatencyMode_Smooth:       return wrapper::org::webRtc::VideoRenderLatencyMode::VideoRenderLatencyMode_smooth;
+    case ::webrtc::RenderFrameQueueTypes::LatencyMode_LatestFrame:  return wrapper::org::webRtc::VideoRenderLatencyMode::VideoRenderLatencyMode_latestFrame;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return wrapper::org::webRtc::VideoRenderLatencyMode::VideoRenderLatencyMode_smooth;
+}
+
+//-----------------------------------------------------------------------------
+::webrtc::RenderFrameQueueTypes::LatencyMode UseEnum::toNative(wrapper::org::webRtc::VideoRenderLatencyMode value) noexcept
+{
+  switch (value)
+  {
+    case wrapper::org::webRtc::VideoRenderLatencyMode::VideoRenderLatencyMode_smooth:       return ::webrtc::RenderFrameQueueTypes::LatencyMode_Smooth;
+    case wrapper::org::webRtc::VideoRenderLatencyMode::VideoRenderLatencyMode_latestFrame:  return ::webrtc::RenderFrameQueueTypes::LatencyMode_LatestFrame;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return ::webrtc::RenderFrameQueueTypes::LatencyMode_Smooth;
+}
+
+//-----------------------------------------------------------------------------
+wrapper::org::webRtc::VideoRenderKeyFramePolicy UseEnum::toWrapper(::webrtc::RenderFrameQueueTypes::KeyFramePolicy value) noexcept
+{
+  switch (value)
+  {
+    case ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_SkipToLatestKeyFrame:  return wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_skipToLatestKeyFrame;
+    case ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_WaitForKeyFrame:       return wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_waitForKeyFrame;
+    case ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_None:                  return wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_none;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_skipToLatestKeyFrame;
+}
+
+//-----------------------------------------------------------------------------
+::webrtc::RenderFrameQueueTypes::KeyFramePolicy UseEnum::toNative(wrapper::org::webRtc::VideoRenderKeyFramePolicy value) noexcept
+{
+  switch (value)
+  {
+    case wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_skipToLatestKeyFrame:  return ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_SkipToLatestKeyFrame;
+    case wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_waitForKeyFrame:       return ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_WaitForKeyFrame;
+    case wrapper::org::webRtc::VideoRenderKeyFramePolicy::VideoRenderKeyFramePolicy_none:                  return ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_None;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return ::webrtc::RenderFrameQueueTypes::KeyFramePolicy_SkipToLatestKeyFrame;
+}
+
 //-----------------------------------------------------------------------------
 wrapper::org::webRtc::RTCStatsOutputLevel UseEnum::toWrapper(::webrtc::PeerConnectionInterface::StatsOutputLevel value) noexcept
 {
@@ -1379,3 +1455,31 @@ wrapper::org::webRtc::VideoFrameBufferType UseEnum::toWrapper(::webrtc::VideoFra
   ZS_ASSERT_FAIL("unknown type");
   return wrapper::org::webRtc::VideoFrameBufferType::VideoFrameBufferType_Native;
 }
+
+//-----------------------------------------------------------------------------
+wrapper::org::webRtc::VideoFrameRgbFormat UseEnum::toWrapper(::webrtc::VideoFrameExporter::RgbFormat value) noexcept
+{
+  switch (value)
+  {
+    case ::webrtc::VideoFrameExporter::RgbFormat_BGRA:  return wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_bgra;
+    case ::webrtc::VideoFrameExporter::RgbFormat_RGBA:  return wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_rgba;
+    case ::webrtc::VideoFrameExporter::RgbFormat_ARGB:  return wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_argb;
+    case ::webrtc::VideoFrameExporter::RgbFormat_ABGR:  return wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_abgr;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_bgra;
+}
+
+//-----------------------------------------------------------------------------
+::webrtc::VideoFrameExporter::RgbFormat UseEnum::toNative(wrapper::org::webRtc::VideoFrameRgbFormat value) noexcept
+{
+  switch (value)
+  {
+    case wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_bgra:  return ::webrtc::VideoFrameExporter::RgbFormat_BGRA;
+    case wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_rgba:  return ::webrtc::VideoFrameExporter::RgbFormat_RGBA;
+    case wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_argb:  return ::webrtc::VideoFrameExporter::RgbFormat_ARGB;
+    case wrapper::org::webRtc::VideoFrameRgbFormat::VideoFrameRgbFormat_abgr:  return ::webrtc::VideoFrameExporter::RgbFormat_ABGR;
+  }
+  ZS_ASSERT_FAIL("unknown type");
+  return ::webrtc::VideoFrameExporter::RgbFormat_BGRA;
+}
@@ -14,6 +14,10 @@
 #include "api/video//video_frame_buffer.h"
 #include "impl_org_webRtc_post_include.h"
 
+#include "impl_webrtc_VideoFrameFanout.h"
+#include "impl_webrtc_RenderFrameQueue.h"
+#include "impl_webrtc_VideoFrameExporter.h"
+
 
 namespace webRtc
 {
@@ -136,6 +140,15 @@ namespace wrapper {
           ZS_NO_DISCARD() static wrapper::org::webRtc::VideoCaptureState toWrapper(::cricket::CaptureState value) noexcept;
           ZS_NO_DISCARD() static ::cricket::CaptureState toNative(wrapper::org::webRtc::VideoCaptureState value) noexcept;
 
+          ZS_NO_DISCARD() static wrapper::org::webRtc::VideoFrameDropPolicy toWrapper(::webrtc::VideoFrameFanout::DropPolicy value) noexcept;
+          ZS_NO_DISCARD() static ::webrtc::VideoFrameFanout::DropPolicy toNative(wrapper::org::webRtc::VideoFrameDropPolicy value) noexcept;
+
+          ZS_NO_DISCARD() static wrapper::org::webRtc::VideoRenderLatencyMode toWrapper(::webrtc::RenderFrameQueueTypes::LatencyMode value) noexcept;
+          ZS_NO_DISCARD() static ::webrtc::RenderFrameQueueTypes::LatencyMode toNative(wrapper::org::webRtc::VideoRenderLatencyMode value) noexcept;
+
+          ZS_NO_DISCARD() static wrapper::org::webRtc::VideoRenderKeyFramePolicy toWrapper(::webrtc::RenderFrameQueueTypes::KeyFramePolicy value) noexcept;
+          ZS_NO_DISCARD() static ::webrtc::RenderFrameQueueTypes::KeyFramePolicy toNative(wrapper::org::webRtc::VideoRenderKeyFramePolicy value) noexcept;
+
           ZS_NO_DISCARD() static wrapper::org::webRtc::RTCStatsOutputLevel toWrapper(::webrtc::PeerConnectionInterface::StatsOutputLevel value) noexcept;
           ZS_NO_DISCARD() static ::webrtc::PeerConnectionInterface::StatsOutputLevel toNative(wrapper::org::webRtc::RTCStatsOutputLevel value) noexcept;
 
@@ -173,6 +186,9 @@ namespace wrapper {
           ZS_NO_DISCARD() static ::webrtc::AudioProcessing::RuntimeSetting::Type toNative(wrapper::org::webRtc::RuntimeSetting value) noexcept;
 
           ZS_NO_DISCARD() static wrapper::org::webRtc::VideoFrameBufferType toWrapper(::webrtc::VideoFrameBuffer::Type value) noexcept;
+
+          ZS_NO_DISCARD() static wrapper::org::webRtc::VideoFrameRgbFormat toWrapper(::webrtc::VideoFrameExporter::RgbFormat value) noexcept;
+          ZS_NO_DISCARD() static ::webrtc::VideoFrameExporter::RgbFormat toNative(wrapper::org::webRtc::VideoFrameRgbFormat value) noexcept;
 #if 0
 
           enum MediaType {
@@ -0,0 +1,26 @@
+
+#include "impl_webrtc_DataChannelPayload.h"
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+DataBuffer DataChannelPayload::fromText(const std::string &text) noexcept
+{
+  return DataBuffer(text);
+}
+
+//-----------------------------------------------------------------------------
+DataBuffer DataChannelPayload::fromBytes(
+                                         const uint8_t *data,
+                                         size_t size
+                                         ) noexcept
+{
+  if ((!data) || (0 == size)) return DataBuffer(rtc::CopyOnWriteBuffer(), true);
+  return DataBuffer(rtc::CopyOnWriteBuffer(data, size), true);
+}
+
+//-----------------------------------------------------------------------------
+DataBuffer DataChannelPayload::fromBuffer(const rtc::CopyOnWriteBuffer &buffer) noexcept
+{
+  return DataBuffer(buffer, true);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/datachannelinterface.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <string>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Builds the messages the data channel wrapper sends. Each is built once,
+  // straight from what the caller passed in, and handed to the channel as
+  // is: the proxy passes it to the signaling thread by reference and a
+  // message queued while SCTP is busy shares the same reference counted
+  // buffer.
+  class DataChannelPayload
+  {
+  public:
+    // Copies the text or bytes once; the buffer owns its storage.
+    static DataBuffer fromText(const std::string &text) noexcept;
+    static DataBuffer fromBytes(const uint8_t *data, size_t size) noexcept;
+
+    // Shares the caller's buffer without copying. Writing to the caller's
+    // buffer afterwards detaches a copy for the caller rather than changing
+    // the message.
+    static DataBuffer fromBuffer(const rtc::CopyOnWriteBuffer &buffer) noexcept;
+  };
+
+} // namespace webrtc
@@ -0,0 +1,229 @@
+
+#include "impl_webrtc_DataChannelSendQueue.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/location.h"
+#include "rtc_base/messagequeue.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <memory>
+
+using namespace webrtc;
+
+namespace
+{
+  const uint32_t kMessageDrain = 1;
+
+  typedef rtc::TypedMessageData<DataChannelSendQueueWeakPtr> DrainData;
+}
+
+//-----------------------------------------------------------------------------
+// Runs the drains posted to the signaling thread. It outlives every queue,
+// so a drain still pending when its queue goes away finds nothing to do
+// instead of a destroyed handler.
+class DataChannelSendQueue::DrainHandler : public rtc::MessageHandler
+{
+public:
+  static DrainHandler &singleton() noexcept
+  {
+    static DrainHandler *handler = new DrainHandler();
+    return *handler;
+  }
+
+  void OnMessage(rtc::Message *message) override
+  {
+    if (kMessageDrain != message->message_id) return;
+
+    std::unique_ptr<DrainData> data(static_cast<DrainData *>(message->pdata));
+    message->pdata = nullptr;
+
+    auto queue = data->data().lock();
+    if (!queue) return;
+
+    queue->drainScheduled_ = false;
+    queue->drain();
+  }
+};
+
+//-----------------------------------------------------------------------------
+DataChannelSendQueue::DataChannelSendQueue(
+                                           const make_private &,
+                                           rtc::scoped_refptr<DataChannelInterface> channel,
+                                           rtc::Thread *signalingThread
+                                           ) noexcept :
+  channel_(channel),
+  signalingThread_(signalingThread)
+{
+}
+
+//-----------------------------------------------------------------------------
+DataChannelSendQueue::~DataChannelSendQueue() noexcept
+{
+  clear();
+}
+
+//-----------------------------------------------------------------------------
+DataChannelSendQueuePtr DataChannelSendQueue::create(
+                                                     rtc::scoped_refptr<DataChannelInterface> channel,
+                                                     rtc::Thread *signalingThread
+                                                     ) noexcept
+{
+  auto pThis = std::make_shared<DataChannelSendQueue>(make_private{}, channel, signalingThread);
+  pThis->thisWeak_ = pThis;
+  return pThis;
+}
+
+//-----------------------------------------------------------------------------
+void DataChannelSendQueue::setOptions(const Options &options) noexcept
+{
+  {
+    rtc::CritScope cs(&cs_);
+    options_ = options;
+    if (options_.lowWatermark_ > options_.highWatermark_)
+      options_.lowWatermark_ = options_.highWatermark_;
+    if (!options_.enabled_)
+      stats_.paused_ = false;
+  }
+
+  // new watermarks may release messages already waiting
+  scheduleDrain();
+}
+
+//-----------------------------------------------------------------------------
+DataChannelSendQueue::Options DataChannelSendQueue::options() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return options_;
+}
+
+//-----------------------------------------------------------------------------
+DataChannelSendQueue::Stats DataChannelSendQueue::stats() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return stats_;
+}
+
+//-----------------------------------------------------------------------------
+bool DataChannelSendQueue::send(
+                                DataBuffer &&buffer,
+                                Callback callback
+                                ) noexcept
+{
+  {
+    rtc::CritScope cs(&cs_);
+    if (stats_.queuedBytes_ + buffer.size() > options_.maxQueuedBytes_) {
+      ++stats_.rejectedMessages_;
+      return false;
+    }
+
+    stats_.queuedBytes_ += buffer.size();
+    ++stats_.queuedMessages_;
+
+    Entry entry;
+    entry.buffer_ = std::move(buffer);
+    entry.callback_ = std::move(callback);
+    queue_.push_back(std::move(entry));
+  }
+
+  scheduleDrain();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void DataChannelSendQueue::drain() noexcept
+{
+  // only one drain runs at a time; a request arriving meanwhile, including
+  // one made by the channel from inside Send(), makes it run once more
+  if (drainRequests_++ > 0) return;
+
+  while (true) {
+    drainQueued();
+
+    int expected = 1;
+    if (drainRequests_.compare_exchange_strong(expected, 0)) break;
+    drainRequests_ = 1;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void DataChannelSendQueue::clear() noexcept
+{
+  std::deque<Entry> failed;
+
+  {
+    rtc::CritScope cs(&cs_);
+    failed.swap(queue_);
+    stats_.failedMessages_ += failed.size();
+    stats_.queuedMessages_ = 0;
+    stats_.queuedBytes_ = 0;
+  }
+
+  for (auto &entry : failed) {
+    if (entry.callback_) entry.callback_(false);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void DataChannelSendQueue::scheduleDrain() noexcept
+{
+  if (!signalingThread_) {
+    drain();
+    return;
+  }
+
+  // sends made before the posted drain runs are handed over together
+  if (drainScheduled_.exchange(true)) return;
+  signalingThread_->Post(RTC_FROM_HERE, &DrainHandler::singleton(), kMessageDrain, new DrainData(thisWeak_));
+}
+
+//-----------------------------------------------------------------------------
+void DataChannelSendQueue::drainQueued() noexcept
+{
+  while (true) {
+    // the channel is never called with the lock held since, through the
+    // proxy, that can block on the signaling thread
+    auto state = channel_->state();
+    if ((DataChannelInterface::kClosing == state) ||
+        (DataChannelInterface::kClosed == state)) {
+      clear();
+      return;
+    }
+    if (DataChannelInterface::kOpen != state) return;
+
+    const uint64_t bufferedAmount = channel_->buffered_amount();
+
+    Entry entry;
+
+    {
+      rtc::CritScope cs(&cs_);
+      if (queue_.empty()) return;
+
+      if (options_.enabled_) {
+        if ((stats_.paused_) &&
+            (bufferedAmount > options_.lowWatermark_))
+          return;
+        stats_.paused_ = (bufferedAmount >= options_.highWatermark_);
+        if (stats_.paused_) return;
+      }
+
+      entry = std::move(queue_.front());
+      queue_.pop_front();
+      stats_.queuedBytes_ -= entry.buffer_.size();
+      --stats_.queuedMessages_;
+    }
+
+    const bool handedOff = channel_->Send(entry.buffer_);
+
+    {
+      rtc::CritScope cs(&cs_);
+      if (handedOff) {
+        ++stats_.sentMessages_;
+        stats_.sentBytes_ += entry.buffer_.size();
+      } else {
+        ++stats_.failedMessages_;
+      }
+    }
+
+    if (entry.callback_) entry.callback_(handedOff);
+  }
+}
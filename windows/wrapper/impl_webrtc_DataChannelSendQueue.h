@@ -0,0 +1,126 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/datachannelinterface.h"
+#include "rtc_base/criticalsection.h"
+#include "rtc_base/messagehandler.h"
+#include "rtc_base/thread.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(DataChannelSendQueue);
+
+  //---------------------------------------------------------------------------
+  // Holds messages for a data channel and hands them to it only while its
+  // buffered amount is below a high watermark. Once the high watermark is
+  // reached nothing more is handed over until the buffered amount has
+  // fallen to the low watermark, so the channel's own queue stays short
+  // and bursts of application messages wait here, within a byte budget,
+  // instead of growing it without bound.
+  //
+  // Messages are handed over on the signaling thread: send() schedules a
+  // drain there and the channel observer drains again whenever the
+  // buffered amount or the state changes. A scheduled drain only holds a
+  // weak reference, so the queue may be released while one is pending.
+  // When the queue is disabled the
+  // watermarks do not apply and messages are handed over as soon as the
+  // channel is open; the byte budget always applies.
+  class DataChannelSendQueue
+  {
+  private:
+    struct make_private {};
+
+  public:
+    // called with true once the message is handed to the channel, or with
+    // false when the channel refused it or closed first
+    typedef std::function<void(bool handedOff)> Callback;
+
+    struct Options
+    {
+      bool enabled_ {};
+      size_t highWatermark_ {1024 * 1024};
+      size_t lowWatermark_ {256 * 1024};
+      size_t maxQueuedBytes_ {16 * 1024 * 1024};
+    };
+
+    struct Stats
+    {
+      size_t queuedMessages_ {};
+      size_t queuedBytes_ {};
+      uint64_t sentMessages_ {};
+      uint64_t sentBytes_ {};
+      uint64_t failedMessages_ {};
+      uint64_t rejectedMessages_ {};    // over the byte budget
+      bool paused_ {};                  // waiting for the low watermark
+    };
+
+  public:
+    DataChannelSendQueue(
+                         const make_private &,
+                         rtc::scoped_refptr<DataChannelInterface> channel,
+                         rtc::Thread *signalingThread
+                         ) noexcept;
+    ~DataChannelSendQueue() noexcept;
+
+    // The channel is normally the proxy; without a signaling thread every
+    // drain runs on the calling thread through it.
+    static DataChannelSendQueuePtr create(
+                                          rtc::scoped_refptr<DataChannelInterface> channel,
+                                          rtc::Thread *signalingThread
+                                          ) noexcept;
+
+    void setOptions(const Options &options) noexcept;
+    Options options() const noexcept;
+    Stats stats() const noexcept;
+
+    // Queues the message behind any already waiting. Returns false without
+    // calling back when the message would take the queue over its budget.
+    bool send(
+              DataBuffer &&buffer,
+              Callback callback
+              ) noexcept;
+
+    // Hands queued messages to the channel while the watermarks allow it.
+    // Called on the signaling thread from the channel observer; calls made
+    // by the channel while a message is being handed over return at once
+    // and are picked up by the drain already running.
+    void drain() noexcept;
+
+    // Fails every queued message, e.g. once the channel is closing.
+    void clear() noexcept;
+
+  private:
+    class DrainHandler;
+
+    struct Entry
+    {
+      DataBuffer buffer_ {rtc::CopyOnWriteBuffer(), true};
+      Callback callback_;
+    };
+
+    void scheduleDrain() noexcept;
+    void drainQueued() noexcept;
+
+  private:
+    DataChannelSendQueueWeakPtr thisWeak_;
+
+    rtc::scoped_refptr<DataChannelInterface> channel_;
+    rtc::Thread *signalingThread_ {};
+
+    mutable rtc::CriticalSection cs_;
+    Options options_;
+    Stats stats_;
+    std::deque<Entry> queue_;
+
+    std::atomic<bool> drainScheduled_ {};
+    std::atomic<int> drainRequests_ {};
+  };
+
+} // namespace webrtc
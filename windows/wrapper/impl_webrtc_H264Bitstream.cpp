@@ -0,0 +1,319 @@
+
+#include "impl_webrtc_H264Bitstream.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace webrtc;
+
+namespace
+{
+  // An SPS is normally a few dozen bytes; only this much is unescaped.
+  const size_t kMaxSpsLength = 256;
+
+  // Largest picture dimension accepted, in macroblocks.
+  const uint32_t kMaxMacroblocks = 1024;
+
+  //---------------------------------------------------------------------------
+  // Reads an RBSP (emulation prevention bytes already removed). Reading past
+  // the end yields zero bits and marks the reader as failed.
+  class BitReader
+  {
+  public:
+    BitReader(const uint8_t *data, size_t length) noexcept :
+      data_(data),
+      totalBits_(length * 8)
+    {}
+
+    bool failed() const noexcept { return failed_; }
+
+    uint32_t bit() noexcept
+    {
+      if (pos_ >= totalBits_) {
+        failed_ = true;
+        return 0;
+      }
+      uint32_t value = (data_[pos_ >> 3] >> (7 - (pos_ & 7))) & 1;
+      ++pos_;
+      return value;
+    }
+
+    uint32_t bits(int count) noexcept
+    {
+      uint32_t result = 0;
+      while (count-- > 0) result = (result << 1) | bit();
+      return result;
+    }
+
+    // unsigned Exp-Golomb
+    uint32_t ue() noexcept
+    {
+      int zeros = 0;
+      while (0 == bit()) {
+        if ((failed_) || (++zeros > 31)) {
+          failed_ = true;
+          return 0;
+        }
+      }
+      if (0 == zeros) return 0;
+      return ((1u << zeros) - 1) + bits(zeros);
+    }
+
+    // signed Exp-Golomb
+    int32_t se() noexcept
+    {
+      uint32_t value = ue();
+      return (0 != (value & 1)) ? static_cast<int32_t>((value + 1) / 2) : -static_cast<int32_t>(value / 2);
+    }
+
+  private:
+    const uint8_t *data_ {};
+    size_t totalBits_ {};
+    size_t pos_ {};
+    bool failed_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  size_t unescape(const uint8_t *src, size_t length, uint8_t *dest, size_t destLength) noexcept
+  {
+    size_t written = 0;
+    size_t zeros = 0;
+    for (size_t index = 0; (index < length) && (written < destLength); ++index) {
+      uint8_t value = src[index];
+      if ((zeros >= 2) && (0x03 == value)) {
+        // emulation_prevention_three_byte
+        zeros = 0;
+        continue;
+      }
+      zeros = (0 == value ? zeros + 1 : 0);
+      dest[written++] = value;
+    }
+    return written;
+  }
+
+  //---------------------------------------------------------------------------
+  void skipScalingList(BitReader &reader, int size) noexcept
+  {
+    int lastScale = 8;
+    int nextScale = 8;
+    for (int index = 0; (index < size) && (!reader.failed()); ++index) {
+      if (0 != nextScale) {
+        int delta = reader.se();
+        nextScale = (lastScale + delta + 256) % 256;
+      }
+      lastScale = (0 == nextScale ? lastScale : nextScale);
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  bool hasChromaFormat(int profileIdc) noexcept
+  {
+    switch (profileIdc) {
+      case 44:
+      case 83:
+      case 86:
+      case 100:
+      case 110:
+      case 118:
+      case 122:
+      case 128:
+      case 134:
+      case 135:
+      case 138:
+      case 139:
+      case 244:   return true;
+    }
+    return false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+size_t H264Bitstream::findStartCode(
+                                    const uint8_t *data,
+                                    size_t length,
+                                    size_t offset,
+                                    size_t &outPrefixLength
+                                    ) noexcept
+{
+  outPrefixLength = 0;
+  if ((!data) || (length < 3) || (offset > length - 3)) return length;
+
+  // look for the 0x01 ending a start code and then check the zeros before
+  // it; 0x01 occurs far less often than 0x00 in slice data
+  size_t pos = offset + 2;
+  while (pos < length) {
+    auto found = static_cast<const uint8_t *>(memchr(data + pos, 0x01, length - pos));
+    if (!found) break;
+
+    pos = static_cast<size_t>(found - data);
+    if ((0 == data[pos - 1]) && (0 == data[pos - 2])) {
+      if ((pos >= offset + 3) && (0 == data[pos - 3])) {
+        outPrefixLength = 4;
+        return pos - 3;
+      }
+      outPrefixLength = 3;
+      return pos - 2;
+    }
+    ++pos;
+  }
+  return length;
+}
+
+//-----------------------------------------------------------------------------
+bool H264Bitstream::nextNalUnit(
+                                const uint8_t *data,
+                                size_t length,
+                                size_t &ioOffset,
+                                NalUnit &outUnit
+                                ) noexcept
+{
+  size_t prefixLength {};
+  size_t start = findStartCode(data, length, ioOffset, prefixLength);
+  if (start + prefixLength >= length) {
+    ioOffset = length;
+    return false;
+  }
+  start += prefixLength;
+
+  size_t nextPrefixLength {};
+  size_t end = findStartCode(data, length, start, nextPrefixLength);
+
+  outUnit.type_ = nalUnitType(data[start]);
+  outUnit.data_ = data + start;
+  outUnit.length_ = end - start;
+
+  ioOffset = end;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool H264Bitstream::parseSps(
+                             const uint8_t *nal,
+                             size_t length,
+                             SpsInfo &outInfo
+                             ) noexcept
+{
+  if ((!nal) || (length < 2)) return false;
+  if (NalUnitType_SPS != nalUnitType(nal[0])) return false;
+
+  uint8_t rbsp[kMaxSpsLength];
+  size_t rbspLength = unescape(nal + 1, length - 1, rbsp, sizeof(rbsp));
+
+  BitReader reader(rbsp, rbspLength);
+
+  SpsInfo info;
+  info.profileIdc_ = static_cast<int>(reader.bits(8));
+  info.constraintFlags_ = static_cast<int>(reader.bits(8) >> 2);
+  info.levelIdc_ = static_cast<int>(reader.bits(8));
+  reader.ue();                                          // seq_parameter_set_id
+
+  uint32_t chromaFormatIdc = 1;
+  uint32_t separateColourPlane = 0;
+  if (hasChromaFormat(info.profileIdc_)) {
+    chromaFormatIdc = reader.ue();
+    if (chromaFormatIdc > 3) return false;
+    if (3 == chromaFormatIdc) separateColourPlane = reader.bit();
+    reader.ue();                                        // bit_depth_luma_minus8
+    reader.ue();                                        // bit_depth_chroma_minus8
+    reader.bit();                                       // qpprime_y_zero_transform_bypass_flag
+    if (0 != reader.bit()) {                            // seq_scaling_matrix_present_flag
+      int lists = (3 != chromaFormatIdc ? 8 : 12);
+      for (int index = 0; (index < lists) && (!reader.failed()); ++index) {
+        if (0 != reader.bit()) skipScalingList(reader, index < 6 ? 16 : 64);
+      }
+    }
+  }
+
+  reader.ue();                                          // log2_max_frame_num_minus4
+  uint32_t picOrderCntType = reader.ue();
+  if (0 == picOrderCntType) {
+    reader.ue();                                        // log2_max_pic_order_cnt_lsb_minus4
+  } else if (1 == picOrderCntType) {
+    reader.bit();                                       // delta_pic_order_always_zero_flag
+    reader.se();                                        // offset_for_non_ref_pic
+    reader.se();                                        // offset_for_top_to_bottom_field
+    uint32_t cycle = reader.ue();
+    if (cycle > 255) return false;
+    for (uint32_t index = 0; (index < cycle) && (!reader.failed()); ++index) {
+      reader.se();                                      // offset_for_ref_frame
+    }
+  } else if (2 != picOrderCntType) {
+    return false;
+  }
+
+  reader.ue();                                          // max_num_ref_frames
+  reader.bit();                                         // gaps_in_frame_num_value_allowed_flag
+  uint32_t widthInMbs = reader.ue() + 1;
+  uint32_t heightInMapUnits = reader.ue() + 1;
+  uint32_t frameMbsOnly = reader.bit();
+  if (0 == frameMbsOnly) reader.bit();                  // mb_adaptive_frame_field_flag
+  reader.bit();                                         // direct_8x8_inference_flag
+
+  uint32_t cropLeft {}, cropRight {}, cropTop {}, cropBottom {};
+  if (0 != reader.bit()) {                              // frame_cropping_flag
+    cropLeft = reader.ue();
+    cropRight = reader.ue();
+    cropTop = reader.ue();
+    cropBottom = reader.ue();
+  }
+
+  if (reader.failed()) return false;
+  if ((widthInMbs > kMaxMacroblocks) || (heightInMapUnits > kMaxMacroblocks)) return false;
+
+  int64_t width = static_cast<int64_t>(widthInMbs) * 16;
+  int64_t height = static_cast<int64_t>(heightInMapUnits) * 16 * (2 - frameMbsOnly);
+
+  int64_t cropUnitX = 1;
+  int64_t cropUnitY = 2 - frameMbsOnly;
+  if ((0 == separateColourPlane) && (0 != chromaFormatIdc)) {
+    cropUnitX = (3 == chromaFormatIdc ? 1 : 2);
+    cropUnitY *= (1 == chromaFormatIdc ? 2 : 1);
+  }
+
+  width -= (static_cast<int64_t>(cropLeft) + cropRight) * cropUnitX;
+  height -= (static_cast<int64_t>(cropTop) + cropBottom) * cropUnitY;
+  if ((width <= 0) || (height <= 0)) return false;
+
+  info.width_ = static_cast<int>(width);
+  info.height_ = static_cast<int>(height);
+
+  outInfo = info;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+H264Bitstream::Info H264Bitstream::inspect(
+                                           const uint8_t *data,
+                                           size_t length
+                                           ) noexcept
+{
+  Info result;
+
+  size_t prefixLength {};
+  size_t start = findStartCode(data, length, 0, prefixLength);
+
+  while (start + prefixLength < length) {
+    start += prefixLength;
+
+    auto type = nalUnitType(data[start]);
+    if (isSlice(type)) {
+      // every slice of a picture shares its type; the slice data is never scanned
+      result.isIDR_ = (NalUnitType_IDR == type);
+      break;
+    }
+
+    size_t end = findStartCode(data, length, start, prefixLength);
+
+    if (NalUnitType_SPS == type) {
+      SpsInfo sps;
+      if (parseSps(data + start, end - start, sps)) {
+        result.hasSps_ = true;
+        result.sps_ = sps;
+      }
+    }
+
+    start = end;
+  }
+
+  return result;
+}
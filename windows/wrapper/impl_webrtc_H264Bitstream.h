@@ -0,0 +1,94 @@
+#pragma once
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Inspects H.264 Annex B byte streams without decoding them. Start codes
+  // are located with memchr, which the C runtime vectorizes, instead of a
+  // byte at a time loop, and inspection stops at the first slice so the bulk
+  // of a sample (the slice data) is never read.
+  //
+  // Every function is bounds checked against the supplied length and
+  // tolerates truncated or malformed input.
+  class H264Bitstream
+  {
+  public:
+    enum NalUnitType
+    {
+      NalUnitType_Unspecified = 0,
+      NalUnitType_Slice = 1,
+      NalUnitType_SliceDataPartitionA = 2,
+      NalUnitType_SliceDataPartitionB = 3,
+      NalUnitType_SliceDataPartitionC = 4,
+      NalUnitType_IDR = 5,
+      NalUnitType_SEI = 6,
+      NalUnitType_SPS = 7,
+      NalUnitType_PPS = 8,
+      NalUnitType_AUD = 9,
+      NalUnitType_EndOfSequence = 10,
+      NalUnitType_EndOfStream = 11,
+      NalUnitType_Filler = 12,
+    };
+
+    struct NalUnit
+    {
+      NalUnitType type_ {NalUnitType_Unspecified};
+      const uint8_t *data_ {};          // starts at the NAL header byte
+      size_t length_ {};                // up to the next start code
+    };
+
+    struct SpsInfo
+    {
+      int profileIdc_ {};
+      int constraintFlags_ {};          // constraint_set0_flag..constraint_set5_flag
+      int levelIdc_ {};
+      int width_ {};                    // after frame cropping
+      int height_ {};
+    };
+
+    struct Info
+    {
+      bool isIDR_ {};
+      bool hasSps_ {};
+      SpsInfo sps_;                     // valid if hasSps_
+    };
+
+  public:
+    // Returns the offset of the next start code at or after offset, or length
+    // if there is none. prefixLength receives 3 or 4.
+    static size_t findStartCode(
+                                const uint8_t *data,
+                                size_t length,
+                                size_t offset,
+                                size_t &outPrefixLength
+                                ) noexcept;
+
+    // Iterates the NAL units of a byte stream; ioOffset starts at 0 and is
+    // advanced past each unit returned.
+    static bool nextNalUnit(
+                            const uint8_t *data,
+                            size_t length,
+                            size_t &ioOffset,
+                            NalUnit &outUnit
+                            ) noexcept;
+
+    static NalUnitType nalUnitType(uint8_t header) noexcept { return static_cast<NalUnitType>(header & 0x1F); }
+    static bool isSlice(NalUnitType type) noexcept { return (type >= NalUnitType_Slice) && (type <= NalUnitType_IDR); }
+
+    // Parses a sequence parameter set NAL unit (including its header byte).
+    static bool parseSps(
+                         const uint8_t *nal,
+                         size_t length,
+                         SpsInfo &outInfo
+                         ) noexcept;
+
+    // Reads the NAL units preceding the first slice of an access unit.
+    static Info inspect(
+                        const uint8_t *data,
+                        size_t length
+                        ) noexcept;
+  };
+
+} // namespace webrtc
@@ -0,0 +1,172 @@
+
+#include "impl_webrtc_I420FramePool.h"
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+I420FramePool::I420FramePool(const make_private &, size_t maxBuffers) noexcept :
+  maxBuffers_(maxBuffers)
+{
+}
+
+//-----------------------------------------------------------------------------
+I420FramePool::~I420FramePool() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+I420FramePoolPtr I420FramePool::create(size_t maxBuffers) noexcept
+{
+  return std::make_shared<I420FramePool>(make_private{}, maxBuffers);
+}
+
+//-----------------------------------------------------------------------------
+void I420FramePool::configure(int width, int height) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  for (auto iter = buffers_.begin(); iter != buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    auto &buffer = *current;
+    if ((buffer->width() == width) && (buffer->height() == height)) continue;
+    if (!buffer->HasOneRef()) continue;
+    buffers_.erase(current);
+  }
+
+  for (auto iter = nv12Buffers_.begin(); iter != nv12Buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    auto &buffer = *current;
+    if ((buffer->width() == width) && (buffer->height() == height)) continue;
+    if (!buffer->HasOneRef()) continue;
+    nv12Buffers_.erase(current);
+  }
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<I420Buffer> I420FramePool::createBuffer(
+                                                           int width,
+                                                           int height,
+                                                           int strideY,
+                                                           int strideU,
+                                                           int strideV
+                                                           ) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  for (auto iter = buffers_.begin(); iter != buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    auto &buffer = *current;
+    if (!buffer->HasOneRef()) continue;       // still referenced by a frame
+
+    if (matches(*buffer, width, height, strideY, strideU, strideV)) {
+      ++hits_;
+      return rtc::scoped_refptr<I420Buffer>(buffer.get());
+    }
+
+    // an idle buffer of a stale size is of no further use
+    buffers_.erase(current);
+  }
+
+  ++misses_;
+
+  rtc::scoped_refptr<PooledBuffer> buffer(new PooledBuffer(width, height, strideY, strideU, strideV));
+  if (buffers_.size() < maxBuffers_)
+    buffers_.push_back(buffer);
+
+  return rtc::scoped_refptr<I420Buffer>(buffer.get());
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<NV12Buffer> I420FramePool::createNV12Buffer(
+                                                               int width,
+                                                               int height
+                                                               ) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  for (auto iter = nv12Buffers_.begin(); iter != nv12Buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    auto &buffer = *current;
+    if (!buffer->HasOneRef()) continue;       // still referenced by a frame
+
+    if ((buffer->width() == width) && (buffer->height() == height)) {
+      ++hits_;
+      return rtc::scoped_refptr<NV12Buffer>(buffer.get());
+    }
+
+    nv12Buffers_.erase(current);
+  }
+
+  ++misses_;
+
+  rtc::scoped_refptr<PooledNV12Buffer> buffer(new PooledNV12Buffer(width, height));
+  if (nv12Buffers_.size() < maxBuffers_)
+    nv12Buffers_.push_back(buffer);
+
+  return rtc::scoped_refptr<NV12Buffer>(buffer.get());
+}
+
+//-----------------------------------------------------------------------------
+void I420FramePool::release() noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  for (auto iter = buffers_.begin(); iter != buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    if (!(*current)->HasOneRef()) continue;
+    buffers_.erase(current);
+  }
+
+  for (auto iter = nv12Buffers_.begin(); iter != nv12Buffers_.end(); ) {
+    auto current = iter;
+    ++iter;
+
+    if (!(*current)->HasOneRef()) continue;
+    nv12Buffers_.erase(current);
+  }
+}
+
+//-----------------------------------------------------------------------------
+I420FramePool::Stats I420FramePool::stats() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  Stats result;
+  result.hits_ = hits_;
+  result.misses_ = misses_;
+  result.pooledBuffers_ = buffers_.size() + nv12Buffers_.size();
+  for (auto &buffer : buffers_) {
+    if (!buffer->HasOneRef()) ++result.buffersInUse_;
+  }
+  for (auto &buffer : nv12Buffers_) {
+    if (!buffer->HasOneRef()) ++result.buffersInUse_;
+  }
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+bool I420FramePool::matches(
+                            const PooledBuffer &buffer,
+                            int width,
+                            int height,
+                            int strideY,
+                            int strideU,
+                            int strideV
+                            ) noexcept
+{
+  return (buffer.width() == width) &&
+         (buffer.height() == height) &&
+         (buffer.StrideY() == strideY) &&
+         (buffer.StrideU() == strideU) &&
+         (buffer.StrideV() == strideV);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "rtc_base/criticalsection.h"
+#include "rtc_base/refcountedobject.h"
+#include "rtc_base/scoped_ref_ptr.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include "impl_webrtc_NV12Buffer.h"
+
+#include <zsLib/types.h>
+
+#include <list>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(I420FramePool);
+
+  //---------------------------------------------------------------------------
+  // Recycles I420 buffers for a frame producer in the same manner as
+  // webrtc::I420BufferPool. A buffer returns to the pool once every frame
+  // referencing it has been released. Unlike webrtc::I420BufferPool the pool
+  // never fails a request; when all pooled buffers are in use a one-off
+  // buffer is allocated and counted as a miss. NV12 buffers, which present
+  // themselves as I420, are pooled alongside.
+  class I420FramePool
+  {
+  private:
+    struct make_private {};
+    typedef rtc::RefCountedObject<I420Buffer> PooledBuffer;
+    typedef rtc::RefCountedObject<NV12Buffer> PooledNV12Buffer;
+    typedef std::list< rtc::scoped_refptr<PooledBuffer> > BufferList;
+    typedef std::list< rtc::scoped_refptr<PooledNV12Buffer> > NV12BufferList;
+
+  public:
+    struct Stats
+    {
+      uint64_t hits_ {};            // requests served by a recycled buffer
+      uint64_t misses_ {};          // requests that needed a fresh allocation
+      size_t pooledBuffers_ {};     // buffers owned by the pool
+      size_t buffersInUse_ {};      // pooled buffers currently referenced by frames
+    };
+
+    static const size_t kDefaultMaxBuffers = 8;
+
+  public:
+    I420FramePool(const make_private &, size_t maxBuffers) noexcept;
+    ~I420FramePool() noexcept;
+
+    static I420FramePoolPtr create(size_t maxBuffers = kDefaultMaxBuffers) noexcept;
+
+    // Prepares the pool for frames of the given size, discarding idle buffers
+    // of any other size. Called when the capture format changes.
+    void configure(int width, int height) noexcept;
+
+    rtc::scoped_refptr<I420Buffer> createBuffer(
+                                                int width,
+                                                int height,
+                                                int strideY,
+                                                int strideU,
+                                                int strideV
+                                                ) noexcept;
+
+    rtc::scoped_refptr<NV12Buffer> createNV12Buffer(
+                                                    int width,
+                                                    int height
+                                                    ) noexcept;
+
+    // Drops every buffer not currently referenced by a frame.
+    void release() noexcept;
+
+    Stats stats() const noexcept;
+
+  private:
+    static bool matches(
+                        const PooledBuffer &buffer,
+                        int width,
+                        int height,
+                        int strideY,
+                        int strideU,
+                        int strideV
+                        ) noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    const size_t maxBuffers_ {};
+    BufferList buffers_;
+    NV12BufferList nv12Buffers_;
+    uint64_t hits_ {};
+    uint64_t misses_ {};
+  };
+
+} // namespace webrtc
@@ -9,6 +9,10 @@
 
 #ifdef CPPWINRT_VERSION
 
+#include "impl_webrtc_RenderFrameQueue.h"
+#include "impl_webrtc_VideoFrameTrace.h"
+#include "impl_webrtc_VideoLatencyProbe.h"
+
 #include <wrapper/impl_org_webRtc_pre_include.h>
 #include "api/mediastreaminterface.h"
 #include <wrapper/impl_org_webRtc_post_include.h>
@@ -49,6 +53,9 @@ namespace webrtc
 
       const char *id_{};
       float frameRateChangeTolerance_ {0.1f};
+
+      RenderFrameQueueTypes::Options queueOptions_;
+      VideoLatencyProbePtr latencyProbe_;     // optional, told when frames are handed to the renderer
     };
 
     static IMediaStreamSourcePtr create(const CreationProperties &info) noexcept;
@@ -62,7 +69,12 @@ namespace webrtc
     virtual uint32_t height() const noexcept = 0;
     virtual int rotation() const noexcept = 0;
 
-    virtual void notifyFrame(const webrtc::VideoFrame &frame) noexcept = 0;
+    virtual RenderFrameQueueTypes::Stats queueStats() const noexcept = 0;
+
+    virtual void notifyFrame(
+                             const webrtc::VideoFrame &frame,
+                             VideoFrameTrace::FrameId traceId
+                             ) noexcept = 0;
   };
   
   interaction IMediaStreamSourceDelegate
@@ -26,7 +26,14 @@
 
 #include <wrapper/generated/types.h>
 
+#include "impl_webrtc_I420FramePool.h"
+#include "impl_webrtc_VideoCaptureCrop.h"
+#include "impl_webrtc_VideoCaptureLoadMonitor.h"
+#include "impl_webrtc_VideoChangeDetector.h"
+#include "impl_webrtc_VideoFrameFanout.h"
+
 #include <wrapper/impl_org_webRtc_pre_include.h>
+#include "media/base/videocommon.h"
 #include <wrapper/impl_org_webRtc_post_include.h>
 
 #include <zsLib/types.h>
@@ -69,11 +76,47 @@ namespace webrtc
     virtual IVideoCapturerSubscriptionPtr subscribe(IVideoCapturerDelegatePtr delegate) = 0;
 
     virtual std::string id() const noexcept = 0;
+
+    // Every frame converted by the capturer is also offered to the sinks of
+    // this fanout, including shared capturers created from it.
+    virtual VideoFrameFanoutPtr fanout() const noexcept = 0;
+
+    // Pool recycling the I420 buffers the capturer converts frames into.
+    virtual I420FramePoolPtr framePool() const noexcept = 0;
+
+    // Region of the captured frame that is converted and emitted.
+    virtual VideoCaptureCropPtr crop() const noexcept = 0;
+
+    // Drops captured frames identical to the previous one before they are
+    // converted.
+    virtual VideoChangeDetectorPtr changeDetector() const noexcept = 0;
+
+    // Steps the capture format down when converting and delivering frames
+    // takes too much of the frame interval, and back up once load allows.
+    virtual VideoCaptureLoadMonitorPtr loadMonitor() const noexcept = 0;
+
+    // Picks the supported format meeting the desired size and rate that is
+    // cheapest to convert, or the closest format when none meets it.
+    virtual bool selectCaptureFormat(
+      const cricket::VideoFormat &desired,
+      cricket::VideoFormat &outBest) noexcept = 0;
+
+    // Splits the conversion (and rotation) of large captured frames into
+    // bands of rows converted on the VideoWorkerPool.
+    virtual bool parallelConversion() const noexcept = 0;
+    virtual void setParallelConversion(bool enabled) noexcept = 0;
+
+    // Never rotates captured pixels; frames are always emitted unrotated
+    // and tagged with their rotation, even to sinks asking for rotation to
+    // be applied.
+    virtual bool deferRotation() const noexcept = 0;
+    virtual void setDeferRotation(bool enabled) noexcept = 0;
   };
   
   interaction IVideoCapturerDelegate
   {
     virtual void onVideoFrameReceived(wrapper::org::webRtc::VideoFrameBufferEventPtr event) = 0;
+    virtual void onCaptureFormatAdapted(wrapper::org::webRtc::VideoFormatPtr format) = 0;
   };
 
   interaction IVideoCapturerSubscription
@@ -88,11 +131,13 @@ namespace webrtc
 ZS_DECLARE_PROXY_BEGIN(webrtc::IVideoCapturerDelegate)
 ZS_DECLARE_PROXY_TYPEDEF(webrtc::IVideoCapturerPtr, IVideoCapturerPtr)
 ZS_DECLARE_PROXY_METHOD(onVideoFrameReceived, wrapper::org::webRtc::VideoFrameBufferEventPtr)
+ZS_DECLARE_PROXY_METHOD(onCaptureFormatAdapted, wrapper::org::webRtc::VideoFormatPtr)
 ZS_DECLARE_PROXY_END()
 
 ZS_DECLARE_PROXY_SUBSCRIPTIONS_BEGIN(webrtc::IVideoCapturerDelegate, webrtc::IVideoCapturerSubscription)
 ZS_DECLARE_PROXY_SUBSCRIPTIONS_TYPEDEF(webrtc::IVideoCapturerPtr, IVideoCapturerPtr)
 ZS_DECLARE_PROXY_SUBSCRIPTIONS_METHOD(onVideoFrameReceived, wrapper::org::webRtc::VideoFrameBufferEventPtr)
+ZS_DECLARE_PROXY_SUBSCRIPTIONS_METHOD(onCaptureFormatAdapted, wrapper::org::webRtc::VideoFormatPtr)
 ZS_DECLARE_PROXY_SUBSCRIPTIONS_END()
 
 #endif //CPPWINRT_VERSION
@@ -6,6 +6,8 @@
 #endif //_WIN32
 
 #include "impl_webrtc_MediaStreamSource.h"
+#include "impl_webrtc_NV12Buffer.h"
+#include "impl_webrtc_H264Bitstream.h"
 
 #ifdef CPPWINRT_VERSION
 
@@ -16,6 +18,8 @@
 #include "third_party/winuwp_h264/native_handle_buffer.h"
 #include "media/base/videocommon.h"
 #include "libyuv/convert.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
 #include "rtc_base/logging.h"
 #include <wrapper/impl_org_webRtc_post_include.h>
 
@@ -34,43 +38,23 @@ using zsLib::Milliseconds;
 using zsLib::AutoRecursiveLock;
 
 //-----------------------------------------------------------------------------
-static bool isSampleIDR(IMFSample* sample)
+static H264Bitstream::Info inspectSample(IMFSample* sample)
 {
   ZS_ASSERT(nullptr != sample);
 
   winrt::com_ptr<IMFMediaBuffer> pBuffer;
-  sample->GetBufferByIndex(0, pBuffer.put());
+  if (FAILED(sample->GetBufferByIndex(0, pBuffer.put()))) return H264Bitstream::Info{};
+
   BYTE* pBytes{};
   DWORD maxLength{};
   DWORD curLength{};
-  if (FAILED(pBuffer->Lock(&pBytes, &maxLength, &curLength))) return false;
-
-  bool found{};
-
-  // Search for the beginnings of nal units.
-  for (DWORD i = 0; i < curLength - 5; ++i)
-  {
-    BYTE* ptr = pBytes + i;
+  if (FAILED(pBuffer->Lock(&pBytes, &maxLength, &curLength))) return H264Bitstream::Info{};
 
-    if ((0x00 != ptr[0]) || (0x00 != ptr[1])) continue;
+  // only the NAL units ahead of the first slice are read
+  auto result = H264Bitstream::inspect(pBytes, curLength);
 
-    int prefixLengthFound = 0;
-
-    if ((0x00 == ptr[2]) && (0x01 == ptr[3]))
-      prefixLengthFound = 4;
-    else if (0x01 == ptr[2])
-      prefixLengthFound = 3;
-    else continue;
-
-    if (0x05 != (ptr[prefixLengthFound] & 0x1f)) continue;
-
-    // Found IDR NAL unit
-    pBuffer->Unlock();
-    found = true;
-    break;
-  }
   pBuffer->Unlock();
-  return found;
+  return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -102,6 +86,14 @@ void MediaStreamSource::init(const CreationProperties &props) noexcept
   id_ = String(props.id_);
   frameRateChangeTolerance_ = props.frameRateChangeTolerance_;
 
+  auto queueOptions = props.queueOptions_;
+  if (VideoFrameType::VideoFrameType_I420 == frameType_) {
+    // every raw frame stands alone so there is never a key frame to wait for
+    queueOptions.keyFramePolicy_ = RenderFrameQueueTypes::KeyFramePolicy_None;
+  }
+  queue_ = std::make_unique<SampleDataQueue>(queueOptions);
+  latencyProbe_ = props.latencyProbe_;
+
   if (props.delegate_) {
     defaultSubscription_ = subscriptions_.subscribe(props.delegate_, zsLib::IMessageQueueThread::singletonUsingCurrentGUIThreadsMessageQueue());
   }
@@ -189,7 +181,10 @@ int MediaStreamSource::rotation() const noexcept
 }
 
 //-----------------------------------------------------------------------------
-void MediaStreamSource::notifyFrame(const webrtc::VideoFrame &frame) noexcept
+void MediaStreamSource::notifyFrame(
+                                    const webrtc::VideoFrame &frame,
+                                    VideoFrameTrace::FrameId traceId
+                                    ) noexcept
 {
   auto dataPtr = std::make_unique<SampleData>();
   auto &data = *dataPtr;
@@ -198,6 +193,8 @@ void MediaStreamSource::notifyFrame(const webrtc::VideoFrame &frame) noexcept
   data.height_ = frame.height();
   data.rotation_ = frame.rotation();
   data.renderTime_ = static_cast<decltype(data.renderTime_)>(frame.render_time_ms()) * decltype(data.renderTime_)(10000); // 1000 * 10 => 100s nanosecond
+  data.captureNtpMs_ = frame.ntp_time_ms();
+  data.traceId_ = traceId;
 
   switch (frameType_) {
     case VideoFrameType::VideoFrameType_I420:
@@ -216,7 +213,20 @@ void MediaStreamSource::notifyFrame(const webrtc::VideoFrame &frame) noexcept
 
       data.sample_.copy_from(tmpSample);
 
-      if (isSampleIDR(tmpSample)) {
+      auto info = inspectSample(tmpSample);
+
+      // the coded size is authoritative, the size of the frame wrapping the
+      // sample may lag a resolution change
+      if (info.hasSps_) {
+        spsWidth_ = static_cast<DimensionType>(info.sps_.width_);
+        spsHeight_ = static_cast<DimensionType>(info.sps_.height_);
+      }
+      if ((0 != spsWidth_) && (0 != spsHeight_)) {
+        data.width_ = spsWidth_;
+        data.height_ = spsHeight_;
+      }
+
+      if (info.isIDR_) {
         data.isIDR_ = true;
 
         winrt::com_ptr<IMFAttributes> sampleAttributes;
@@ -229,6 +239,8 @@ void MediaStreamSource::notifyFrame(const webrtc::VideoFrame &frame) noexcept
     }
   }
 
+  // recorded ahead of the push as the consumer owns the data from then on
+  VideoFrameTrace::record(traceId, VideoFrameTrace::Stage_RenderQueued);
   putInQueue(std::move(dataPtr));
 
   notifyStartCompleteIfReady();
@@ -237,74 +249,20 @@ void MediaStreamSource::notifyFrame(const webrtc::VideoFrame &frame) noexcept
 //-----------------------------------------------------------------------------
 void MediaStreamSource::putInQueue(SampleDataUniPtr sample) noexcept
 {
-  {
-    AutoRecursiveLock lock(lock_);
+  bool isIDR = sample->isIDR_;
+  if (!queue_->push(std::move(sample), isIDR)) return;
 
-    if (sample->isIDR_) {
-      ++totalIDRFramesInQueue_;
-      putIDRIntoQueue_ = true;
-    } else {
-      // reject sample if it's not an IDR and no IDR frames have ever been put in
-      if (!putIDRIntoQueue_) return;
-    }
-    queue_.push(std::move(sample));
+  // pairs with the fence in handleSampleRequested() so either this sees the
+  // parked request or the request's recheck sees the frame
+  std::atomic_thread_fence(std::memory_order_seq_cst);
 
-    // if a deferral is installed then flush only after the deferral is resolved
-    if (!requestingSampleDeferral_) {
-      flushQueueOfExcessiveIDRs();
-    }
-  }
+  // the lock is only taken to answer a request parked while the queue was
+  // empty; otherwise the request thread pulls the frame when it asks
+  if (!requestParked_.load(std::memory_order_relaxed)) return;
 
   pendingRequestRespondToRequestedFrame();
 }
 
-//-----------------------------------------------------------------------------
-void MediaStreamSource::flushQueueOfExcessiveIDRs() noexcept
-{
-  // WARNING: MUST ALREADY BE IN A LOCK
-
-  // no need to pop if there is only one IDR frame in the queue
-  if (totalIDRFramesInQueue_ < 2) return;
-
-  // cannot flush more than 2 frames as a "look ahead" frame is needed to calculates the sample duration
-  if (queue_.size() < 3) return;
-
-  // do not pop if the front sample is not an IDR
-  if (!queue_.front()->isIDR_) return;
-
-  size_t totalEndOfQueueIDRs = (queue_.back()->isIDR_ ? 1 : 0);
-
-  // never allow more than one IDR frame in the queue at a time
-  bool popping{};
-  while (((totalIDRFramesInQueue_ - totalEndOfQueueIDRs) > 1) && (queue_.size() > 2)) {
-    popping = true;
-    popFromQueue();
-  }
-
-  if (popping) {
-    // pop until the next IDR is found
-    do {
-      {
-        auto &frontSample = queue_.front();
-        if (frontSample->isIDR_) break;
-      }
-      popFromQueue();
-    } while (true);
-  }
-}
-
-//-----------------------------------------------------------------------------
-void MediaStreamSource::popFromQueue() noexcept
-{
-  {
-    auto &sample = queue_.front();
-    if (sample->isIDR_) {
-      --totalIDRFramesInQueue_;
-    }
-  }
-  queue_.pop();
-}
-
 //-----------------------------------------------------------------------------
 void MediaStreamSource::pendingRequestRespondToRequestedFrame() noexcept
 {
@@ -317,6 +275,7 @@ void MediaStreamSource::pendingRequestRespondToRequestedFrame() noexcept
     requestingSampleDeferral_ = nullptr;
     request = requestSample_;
     requestSample_ = nullptr;
+    requestParked_ = false;
   }
 
   if (!deferral) return;
@@ -325,6 +284,7 @@ void MediaStreamSource::pendingRequestRespondToRequestedFrame() noexcept
     AutoRecursiveLock lock(lock_);
     requestingSampleDeferral_ = deferral;
     requestSample_ = request;
+    requestParked_ = true;
     return;
   }
   deferral.Complete();
@@ -347,6 +307,11 @@ bool MediaStreamSource::respondToRequest(const winrt::Windows::Media::Core::Medi
   auto result = imfRequest->SetSample(data->sample_.get());
   ZS_ASSERT(SUCCEEDED(result));
 
+  if ((SUCCEEDED(result)) && (latencyProbe_))
+    latencyProbe_->onFrameRendered(data->captureNtpMs_, VideoLatencyProbe::currentNtpMs());
+  if (SUCCEEDED(result))
+    VideoFrameTrace::endFrame(data->traceId_, VideoFrameTrace::Stage_RenderResponded);
+
   return SUCCEEDED(result);
 }
 
@@ -360,21 +325,27 @@ MediaStreamSource::SampleDataUniPtr MediaStreamSource::dequeue() noexcept
   bool rotationChange{};
 
   {
+    // the lock serializes the request thread with a producer answering a
+    // parked request
     AutoRecursiveLock lock(lock_);
 
-    // must be at least 2 frames in the queue to be able to dequeue any single frame
-    if (queue_.size() < 2) return result;
-
-    result = std::move(queue_.front());
-    queue_.pop();
+    result = queue_->pop();
+    if (!result) return result;
 
     auto &sample = *result;
-    auto &lookAheadSample = *(queue_.front());
+    VideoFrameTrace::record(sample.traceId_, VideoFrameTrace::Stage_RenderDequeued);
 
     if (0 == firstRenderTime_) firstRenderTime_ = sample.renderTime_; // zero base the sample time
     sample.renderTime_ -= firstRenderTime_;
     sample.renderTime_ += 45;
 
+    // frames are handed out as soon as they arrive so the duration is
+    // measured from the previous frame rather than a look ahead frame
+    LONGLONG duration = (LONGLONG)((1.0 / 30) * 1000 * 1000 * 10);
+    if ((0 != lastRenderTime_) && (sample.renderTime_ > lastRenderTime_))
+      duration = sample.renderTime_ - lastRenderTime_;
+    lastRenderTime_ = sample.renderTime_;
+
     switch (frameType_) {
       case VideoFrameType::VideoFrameType_I420:
       {
@@ -384,6 +355,7 @@ MediaStreamSource::SampleDataUniPtr MediaStreamSource::dequeue() noexcept
           result.reset();
           return result;
         }
+        VideoFrameTrace::record(sample.traceId_, VideoFrameTrace::Stage_RenderSampleMade);
 
         winrt::com_ptr<IMFAttributes> sampleAttributes;
         sampleAttributes = sample.sample_.as< IMFAttributes>();
@@ -391,14 +363,13 @@ MediaStreamSource::SampleDataUniPtr MediaStreamSource::dequeue() noexcept
           sampleAttributes->SetUINT32(MFSampleExtension_CleanPoint, TRUE);
           sampleAttributes->SetUINT32(MFSampleExtension_Discontinuity, TRUE);
         }
-        LONGLONG duration = (LONGLONG)((1.0 / 30) * 1000 * 1000 * 10);
-        sample.sample_->SetSampleDuration(duration);
+        sample.sample_->SetSampleDuration((LONGLONG)((1.0 / 30) * 1000 * 1000 * 10));
         break;
       }
       case VideoFrameType::VideoFrameType_H264:
       {
         sample.renderTime_ = 0;
-        sample.sample_->SetSampleDuration(lookAheadSample.renderTime_ - sample.renderTime_);
+        sample.sample_->SetSampleDuration(duration);
         break;
       }
     }
@@ -427,8 +398,6 @@ MediaStreamSource::SampleDataUniPtr MediaStreamSource::dequeue() noexcept
       props.Width(sample.width_);
       props.Height(sample.height_);
     }
-
-    flushQueueOfExcessiveIDRs();
   }
 
   if (frameRateChange) fireFrameRateChanged();
@@ -479,31 +448,50 @@ bool MediaStreamSource::makeI420Sample(SampleData &sample)
     return false;
   }
 
-  try {
-
-#pragma ZS_BUILD_NOTE("FIX","(mosa) check if the frame is the correct type before just converting to this frame type")
-
-    // Convert to NV12
-    rtc::scoped_refptr<webrtc::PlanarYuv8Buffer> frameBuffer = static_cast<webrtc::PlanarYuv8Buffer*>(sample.frame_->video_frame_buffer().get());
+  bool result = true;
 
+  try {
     uint8_t* uvDest = destRawData + (pitch * sample.frame_->height());
-    libyuv::I420ToNV12(
-      frameBuffer->DataY(), frameBuffer->StrideY(),
-      frameBuffer->DataU(), frameBuffer->StrideU(),
-      frameBuffer->DataV(), frameBuffer->StrideV(),
-      reinterpret_cast<uint8_t*>(destRawData),
-      pitch,
-      uvDest,
-      pitch,
-      static_cast<int>(sample.frame_->width()),
-      static_cast<int>(sample.frame_->height())
-    );
+
+    auto nativeBuffer = sample.frame_->video_frame_buffer();
+
+    // Frames captured as NV12 are copied as is
+    auto nv12Buffer = dynamic_cast<webrtc::NV12Buffer*>(nativeBuffer.get());
+    if (nv12Buffer) {
+      libyuv::CopyPlane(
+        nv12Buffer->DataY(), nv12Buffer->StrideY(),
+        reinterpret_cast<uint8_t*>(destRawData), pitch,
+        nv12Buffer->width(), nv12Buffer->height());
+      libyuv::CopyPlane(
+        nv12Buffer->DataUV(), nv12Buffer->StrideUV(),
+        uvDest, pitch,
+        2 * nv12Buffer->ChromaWidth(), nv12Buffer->ChromaHeight());
+    } else {
+      // Convert to NV12
+      rtc::scoped_refptr<webrtc::I420BufferInterface> frameBuffer = nativeBuffer->ToI420();
+      if (!frameBuffer) {
+        RTC_LOG(LS_ERROR) << "Frame cannot be rendered as it cannot be converted to I420";
+        result = false;
+      } else {
+        libyuv::I420ToNV12(
+          frameBuffer->DataY(), frameBuffer->StrideY(),
+          frameBuffer->DataU(), frameBuffer->StrideU(),
+          frameBuffer->DataV(), frameBuffer->StrideV(),
+          reinterpret_cast<uint8_t*>(destRawData),
+          pitch,
+          uvDest,
+          pitch,
+          static_cast<int>(sample.frame_->width()),
+          static_cast<int>(sample.frame_->height())
+        );
+      }
+    }
   } catch (...) {
     RTC_LOG(LS_ERROR) << "Exception caught in MediaStreamSource::ConvertFrame()";
   }
   imageBuffer->Unlock2D();
 
-  return true;
+  return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -558,16 +546,18 @@ void MediaStreamSource::fireFrameRateChanged() noexcept
 void MediaStreamSource::notifyStartCompleteIfReady() noexcept
 {
   if (!started_) return;
+  if (!startPending_) return;   // already completed, no lock needed per frame
 
   decltype(startingDeferral_) startingDeferral {nullptr};
   decltype(startingArgs_) startingArgs {nullptr};
 
+  if (!queue_->receivedKeyFrame()) return; // not ready
+
   {
     AutoRecursiveLock lock(lock_);
-    if (totalIDRFramesInQueue_ < 1) return; // not ready
-
     startingDeferral = startingDeferral_;
     startingDeferral_ = nullptr;
+    startPending_ = false;
 
     startingArgs = startingArgs_;
     startingArgs_ = nullptr;
@@ -634,6 +624,7 @@ void MediaStreamSource::handleStarting(const winrt::Windows::Media::Core::MediaS
     AutoRecursiveLock lock(lock_);
     startingDeferral_ = args.Request().GetDeferral();
     startingArgs_ = args;
+    startPending_ = true;
     started_ = true;
   }
 
@@ -651,9 +642,12 @@ void MediaStreamSource::handleSampleRequested(const winrt::Windows::Media::Core:
     AutoRecursiveLock lock(lock_);
     requestSample_ = request;
     requestingSampleDeferral_ = requestSample_.GetDeferral();
+    requestParked_ = true;
   }
 
-  // possible race condition where frame was inserted while deferral was installed
+  // possible race condition where frame was inserted while deferral was
+  // installed; pairs with the fence in putInQueue()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
   pendingRequestRespondToRequestedFrame();
 }
 
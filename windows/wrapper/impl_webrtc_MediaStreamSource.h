@@ -32,7 +32,7 @@ namespace webrtc
 
     ZS_DECLARE_STRUCT_PTR(SampleData);
 
-    typedef std::queue< SampleDataUniPtr > SampleDataQueue;
+    typedef RenderFrameQueue<SampleData> SampleDataQueue;
 
     struct SampleData
     {
@@ -43,6 +43,8 @@ namespace webrtc
       RotationType rotation_ {};
       RenderTime renderTime_ {};
       bool isIDR_ {};
+      int64_t captureNtpMs_ {};
+      VideoFrameTrace::FrameId traceId_ {};
     };
 
   private:
@@ -64,12 +66,15 @@ namespace webrtc
     uint32_t height() const noexcept override;
     int rotation() const noexcept override;
 
-    void notifyFrame(const webrtc::VideoFrame &frame) noexcept override;
+    RenderFrameQueueTypes::Stats queueStats() const noexcept override { return queue_->stats(); }
+
+    void notifyFrame(
+                     const webrtc::VideoFrame &frame,
+                     VideoFrameTrace::FrameId traceId
+                     ) noexcept override;
 
   private:
     void putInQueue(SampleDataUniPtr sample) noexcept;
-    void flushQueueOfExcessiveIDRs() noexcept;
-    void popFromQueue() noexcept;
 
     void pendingRequestRespondToRequestedFrame() noexcept;
     bool respondToRequest(const winrt::Windows::Media::Core::MediaStreamSourceSampleRequest &request) noexcept;
@@ -103,6 +108,7 @@ namespace webrtc
     winrt::Windows::Media::Core::VideoStreamDescriptor descriptor_ {nullptr};
 
     std::atomic_bool started_ {};
+    std::atomic_bool startPending_ {};      // a starting deferral waits for a key frame
     std::atomic_bool stopping_ {};
     std::atomic_bool stopped_ {};
     winrt::event_token startingToken_ {};
@@ -112,11 +118,10 @@ namespace webrtc
     winrt::event_token requestingSampleToken_ {};
     winrt::Windows::Media::Core::MediaStreamSourceSampleRequest requestSample_ {nullptr};
     winrt::Windows::Media::Core::MediaStreamSourceSampleRequestDeferral requestingSampleDeferral_ {nullptr};
+    std::atomic_bool requestParked_ {};     // a sample request waits for a frame
 
     winrt::event_token stoppingToken_ {};
 
-    bool putIDRIntoQueue_{};
-
     size_t totalFrameCounted_ {};
 
     std::atomic_bool firedResolutionChange_{};
@@ -132,9 +137,13 @@ namespace webrtc
     zsLib::Time lastTimeChecked_ {};
 
     RenderTime firstRenderTime_ {};
+    RenderTime lastRenderTime_ {};
+
+    DimensionType spsWidth_ {};     // only touched by notifyFrame()
+    DimensionType spsHeight_ {};
 
-    SampleDataQueue queue_;
-    size_t totalIDRFramesInQueue_ {};
+    std::unique_ptr<SampleDataQueue> queue_;   // lock free, notifyFrame() produces and dequeue() consumes
+    VideoLatencyProbePtr latencyProbe_;
   };
 
 }
@@ -0,0 +1,80 @@
+
+#include "impl_webrtc_NV12Buffer.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/planar_functions.h"
+#include "rtc_base/refcountedobject.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+NV12Buffer::NV12Buffer(int width, int height) noexcept :
+  width_(width),
+  height_(height),
+  strideY_(width),
+  strideUV_(2 * ((width + 1) / 2)),
+  data_((static_cast<size_t>(width) * height) + (static_cast<size_t>(2 * ((width + 1) / 2)) * ((height + 1) / 2)))
+{
+}
+
+//-----------------------------------------------------------------------------
+NV12Buffer::~NV12Buffer()
+{
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<NV12Buffer> NV12Buffer::create(int width, int height) noexcept
+{
+  ZS_ASSERT((width > 0) && (height > 0));
+  return rtc::scoped_refptr<NV12Buffer>(new rtc::RefCountedObject<NV12Buffer>(width, height));
+}
+
+//-----------------------------------------------------------------------------
+const uint8_t *NV12Buffer::DataU() const
+{
+  splitChroma();
+  return planarChroma_.data();
+}
+
+//-----------------------------------------------------------------------------
+const uint8_t *NV12Buffer::DataV() const
+{
+  splitChroma();
+  return planarChroma_.data() + (static_cast<size_t>(StrideU()) * ChromaHeight());
+}
+
+//-----------------------------------------------------------------------------
+uint8_t *NV12Buffer::MutableDataY() noexcept
+{
+  split_ = false;
+  return data_.data();
+}
+
+//-----------------------------------------------------------------------------
+uint8_t *NV12Buffer::MutableDataUV() noexcept
+{
+  split_ = false;
+  return data_.data() + (strideY_ * height_);
+}
+
+//-----------------------------------------------------------------------------
+void NV12Buffer::splitChroma() const noexcept
+{
+  if (split_) return;
+
+  rtc::CritScope cs(&splitCs_);
+  if (split_) return;
+
+  const size_t planeSize = static_cast<size_t>(StrideU()) * ChromaHeight();
+  if (planarChroma_.size() < planeSize * 2)
+    planarChroma_.resize(planeSize * 2);
+
+  libyuv::SplitUVPlane(
+    DataUV(), strideUV_,
+    planarChroma_.data(), StrideU(),
+    planarChroma_.data() + planeSize, StrideV(),
+    ChromaWidth(), ChromaHeight());
+
+  split_ = true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/criticalsection.h"
+#include "rtc_base/scoped_ref_ptr.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <atomic>
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // A frame buffer holding NV12 (a Y plane followed by an interleaved UV
+  // plane), the layout most capture devices and the media foundation
+  // renderer use natively.
+  //
+  // This version of webrtc has no NV12 buffer type, so the buffer presents
+  // itself as I420. The Y plane is shared as is; the separate U and V planes
+  // are only produced the first time they are requested, so consumers that
+  // understand NV12 (such as the local preview) never pay for a conversion
+  // and consumers that need I420 (such as software encoders) only pay for
+  // splitting the chroma.
+  class NV12Buffer : public I420BufferInterface
+  {
+  public:
+    static rtc::scoped_refptr<NV12Buffer> create(int width, int height) noexcept;
+
+    // VideoFrameBuffer
+    int width() const override { return width_; }
+    int height() const override { return height_; }
+
+    // PlanarYuvBuffer
+    int StrideY() const override { return strideY_; }
+    int StrideU() const override { return (width_ + 1) / 2; }
+    int StrideV() const override { return (width_ + 1) / 2; }
+
+    // PlanarYuv8Buffer
+    const uint8_t *DataY() const override { return data_.data(); }
+    const uint8_t *DataU() const override;
+    const uint8_t *DataV() const override;
+
+    int StrideUV() const noexcept { return strideUV_; }
+    const uint8_t *DataUV() const noexcept { return data_.data() + (strideY_ * height_); }
+
+    // Writing through the mutable accessors discards any I420 chroma
+    // previously split out of the buffer.
+    uint8_t *MutableDataY() noexcept;
+    uint8_t *MutableDataUV() noexcept;
+
+  protected:
+    NV12Buffer(int width, int height) noexcept;
+    ~NV12Buffer() override;
+
+  private:
+    void splitChroma() const noexcept;
+
+  private:
+    const int width_ {};
+    const int height_ {};
+    const int strideY_ {};
+    const int strideUV_ {};
+
+    std::vector<uint8_t> data_;
+
+    mutable rtc::CriticalSection splitCs_;
+    mutable std::atomic_bool split_ {};
+    mutable std::vector<uint8_t> planarChroma_;   // U then V, produced on demand
+  };
+
+} // namespace webrtc
@@ -0,0 +1,398 @@
+
+#include "impl_webrtc_PushAudioSource.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "common_audio/include/audio_util.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/refcountedobject.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace webrtc;
+
+namespace
+{
+  //---------------------------------------------------------------------------
+  // One thread paces every push source in the process so the number of
+  // sources is not bounded by the number of threads.
+  class PushAudioSourcePacer
+  {
+    typedef std::chrono::steady_clock Clock;
+
+  public:
+    static PushAudioSourcePacer &singleton() noexcept
+    {
+      static PushAudioSourcePacer pacer;
+      return pacer;
+    }
+
+    ~PushAudioSourcePacer()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+      }
+      wake_.notify_all();
+      if (thread_.joinable())
+        thread_.join();
+
+      // released with the lock free since a source's destructor removes it
+      SourceMap sources;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sources.swap(sources_);
+      }
+    }
+
+    // The pacer holds a reference to every source it paces so a source can
+    // never be destroyed while it is being delivered.
+    void add(PushAudioSource *source) noexcept
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sources_[source] = rtc::scoped_refptr<PushAudioSource>(source);
+        if (!thread_.joinable())
+          thread_ = std::thread([this]() { run(); });
+      }
+      wake_.notify_all();
+    }
+
+    // Blocks until any in-progress delivery to the source has completed,
+    // after which it will not be touched again by the pacing thread. A sink
+    // removed from inside its own OnData is already on the pacing thread and
+    // does not wait for itself.
+    void remove(PushAudioSource *source) noexcept
+    {
+      // declared ahead of the lock so it is released after it; dropping the
+      // pacer's reference may destroy the source, which removes itself again
+      rtc::scoped_refptr<PushAudioSource> released;
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto found = sources_.find(source);
+      if (sources_.end() != found) {
+        released = found->second;
+        sources_.erase(found);
+      }
+      if (std::this_thread::get_id() == thread_.get_id()) return;
+      delivered_.wait(lock, [this, source]() { return delivering_ != source; });
+    }
+
+  private:
+    void run() noexcept
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto next = Clock::now();
+
+      while (!shutdown_) {
+        if (sources_.empty()) {
+          wake_.wait(lock);
+          next = Clock::now();
+          continue;
+        }
+
+        auto now = Clock::now();
+        if (now < next) {
+          wake_.wait_until(lock, next);
+          continue;
+        }
+
+        // deliver without the lock so adding or removing other sources never
+        // waits on a source's sinks; a source removed meanwhile is skipped
+        due_.clear();
+        for (auto &entry : sources_) {
+          due_.push_back(entry.first);
+        }
+
+        for (auto source : due_) {
+          auto found = sources_.find(source);
+          if (sources_.end() == found) continue;
+
+          // a sink may drop the last outside reference from inside OnData;
+          // this one keeps the source alive until the delivery has returned
+          // and is released with the lock free
+          rtc::scoped_refptr<PushAudioSource> delivering(found->second);
+          delivering_ = source;
+          lock.unlock();
+          source->deliverFrame();
+          delivering = nullptr;
+          lock.lock();
+          delivering_ = nullptr;
+          delivered_.notify_all();
+        }
+
+        next += std::chrono::milliseconds(10);
+
+        // after a long stall resume from now rather than bursting out the
+        // backlog of missed frames
+        if (now - next > std::chrono::milliseconds(100))
+          next = now;
+      }
+    }
+
+  private:
+    typedef std::map< PushAudioSource *, rtc::scoped_refptr<PushAudioSource> > SourceMap;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable delivered_;
+    SourceMap sources_;
+    std::vector<PushAudioSource *> due_;        // only touched on the pacing thread
+    PushAudioSource *delivering_ {};
+    std::thread thread_;
+    bool shutdown_ {};
+  };
+}
+
+//-----------------------------------------------------------------------------
+PushAudioSource::PushAudioSource(const CreationProperties &props) noexcept :
+  sampleRateHz_(props.sampleRateHz_),
+  channels_(props.channels_),
+  frameSamplesPerChannel_(static_cast<size_t>(props.sampleRateHz_ / 100)),
+  maxQueuedFrames_(std::max<size_t>(props.maxQueuedFrames_, 1)),
+  prebufferFrames_(std::min(std::max<size_t>(props.prebufferFrames_, 1), std::max<size_t>(props.maxQueuedFrames_, 1)))
+{
+  queue_.resize(maxQueuedFrames_ * frameSamples());
+  outFrame_.resize(frameSamples());
+}
+
+//-----------------------------------------------------------------------------
+PushAudioSource::~PushAudioSource()
+{
+  PushAudioSourcePacer::singleton().remove(this);
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<PushAudioSource> PushAudioSource::create(const CreationProperties &props) noexcept
+{
+  if ((props.sampleRateHz_ < 8000) ||
+      (0 != (props.sampleRateHz_ % 100)) ||
+      (props.channels_ < 1) ||
+      (props.channels_ > 2)) {
+    RTC_LOG(LS_ERROR) << "Push audio source output format not supported, rate: " << props.sampleRateHz_ << ", channels: " << props.channels_;
+    return rtc::scoped_refptr<PushAudioSource>();
+  }
+
+  return rtc::scoped_refptr<PushAudioSource>(new rtc::RefCountedObject<PushAudioSource>(props));
+}
+
+//-----------------------------------------------------------------------------
+bool PushAudioSource::pushAudio(
+                                const int16_t *interleaved,
+                                size_t samplesPerChannel,
+                                int sampleRateHz,
+                                size_t channels
+                                ) noexcept
+{
+  rtc::CritScope cs(&queueCs_);
+
+  // the resampler only consumes whole 10ms blocks of the input rate
+  if ((!interleaved) ||
+      (channels < 1) ||
+      (sampleRateHz < 8000) ||
+      (0 != (sampleRateHz % 100))) {
+    ++stats_.rejectedPushes_;
+    RTC_LOG(LS_ERROR) << "Pushed audio format not supported, rate: " << sampleRateHz << ", channels: " << channels;
+    return false;
+  }
+
+  if (sampleRateHz != inputRateHz_) {
+    if (0 != resampler_.InitializeIfNeeded(sampleRateHz, sampleRateHz_, channels_)) {
+      ++stats_.rejectedPushes_;
+      RTC_LOG(LS_ERROR) << "Push audio source cannot resample from " << sampleRateHz << " to " << sampleRateHz_;
+      return false;
+    }
+    inputRateHz_ = sampleRateHz;
+    stagingLength_ = 0; // a partial block at the old rate cannot be resampled
+    staging_.resize(static_cast<size_t>(inputRateHz_ / 100) * channels_);
+  }
+
+  stats_.pushedSamples_ += samplesPerChannel;
+
+  const size_t blockSamplesPerChannel = static_cast<size_t>(inputRateHz_ / 100);
+  const size_t blockLength = blockSamplesPerChannel * channels_;
+
+  while (samplesPerChannel > 0) {
+    if ((0 == stagingLength_) &&
+        (channels == channels_) &&
+        (samplesPerChannel >= blockSamplesPerChannel)) {
+      // resample directly out of the caller's memory
+      resampleIntoQueue(interleaved, blockLength);
+      interleaved += blockLength;
+      samplesPerChannel -= blockSamplesPerChannel;
+      continue;
+    }
+
+    size_t staged = stagingLength_ / channels_;
+    size_t take = std::min(blockSamplesPerChannel - staged, samplesPerChannel);
+    remixInto(interleaved, channels, take, staging_.data() + stagingLength_);
+    stagingLength_ += take * channels_;
+    interleaved += take * channels;
+    samplesPerChannel -= take;
+
+    if (stagingLength_ == blockLength) {
+      resampleIntoQueue(staging_.data(), blockLength);
+      stagingLength_ = 0;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool PushAudioSource::pushAudio(
+                                const float *interleaved,
+                                size_t samplesPerChannel,
+                                int sampleRateHz,
+                                size_t channels
+                                ) noexcept
+{
+  rtc::CritScope cs(&queueCs_);
+
+  if ((!interleaved) || (channels < 1)) {
+    ++stats_.rejectedPushes_;
+    return false;
+  }
+
+  size_t length = samplesPerChannel * channels;
+  if (converted_.size() < length)
+    converted_.resize(length);
+
+  FloatToS16(interleaved, length, converted_.data());
+  return pushAudio(converted_.data(), samplesPerChannel, sampleRateHz, channels);
+}
+
+//-----------------------------------------------------------------------------
+PushAudioSource::Stats PushAudioSource::stats() const noexcept
+{
+  rtc::CritScope cs(&queueCs_);
+  Stats result = stats_;
+  result.queuedFrames_ = queuedFrames_;
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+void PushAudioSource::AddSink(AudioTrackSinkInterface *sink)
+{
+  if (!sink) return;
+
+  {
+    rtc::CritScope cs(&sinkCs_);
+    if (sinks_.end() != std::find(sinks_.begin(), sinks_.end(), sink)) return;
+    sinks_.push_back(sink);
+    if (sinks_.size() > 1) return;
+  }
+
+  PushAudioSourcePacer::singleton().add(this);
+}
+
+//-----------------------------------------------------------------------------
+void PushAudioSource::RemoveSink(AudioTrackSinkInterface *sink)
+{
+  {
+    rtc::CritScope cs(&sinkCs_);
+    auto found = std::find(sinks_.begin(), sinks_.end(), sink);
+    if (sinks_.end() == found) return;
+    sinks_.erase(found);
+    if (sinks_.size() > 0) return;
+  }
+
+  PushAudioSourcePacer::singleton().remove(this);
+}
+
+//-----------------------------------------------------------------------------
+void PushAudioSource::deliverFrame() noexcept
+{
+  const size_t length = frameSamples();
+
+  {
+    rtc::CritScope cs(&queueCs_);
+
+    if ((buffering_) && (queuedFrames_ >= prebufferFrames_))
+      buffering_ = false;
+
+    if ((!buffering_) && (queuedFrames_ > 0)) {
+      memcpy(outFrame_.data(), queue_.data() + (queueHead_ * length), length * sizeof(int16_t));
+      queueHead_ = (queueHead_ + 1) % maxQueuedFrames_;
+      --queuedFrames_;
+      ++stats_.deliveredFrames_;
+    } else {
+      if (!buffering_) {
+        // starved after playout started; rebuild the prebuffer before resuming
+        buffering_ = true;
+        ++stats_.underruns_;
+      }
+      memset(outFrame_.data(), 0, length * sizeof(int16_t));
+      ++stats_.silentFrames_;
+    }
+  }
+
+  // a sink may add or remove sinks from inside OnData, so walk a copy and
+  // skip any sink removed since the copy was taken
+  rtc::CritScope cs(&sinkCs_);
+  deliverSinks_ = sinks_;
+  for (auto sink : deliverSinks_) {
+    if (sinks_.end() == std::find(sinks_.begin(), sinks_.end(), sink)) continue;
+    sink->OnData(outFrame_.data(), 16, sampleRateHz_, channels_, frameSamplesPerChannel_);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void PushAudioSource::resampleIntoQueue(const int16_t *input, size_t inputLength) noexcept
+{
+  const size_t length = frameSamples();
+
+  if (queuedFrames_ == maxQueuedFrames_) {
+    // keep latency bounded by discarding the oldest frame
+    queueHead_ = (queueHead_ + 1) % maxQueuedFrames_;
+    --queuedFrames_;
+    ++stats_.overflows_;
+  }
+
+  size_t tail = (queueHead_ + queuedFrames_) % maxQueuedFrames_;
+  int16_t *dest = queue_.data() + (tail * length);
+
+  int result = resampler_.Resample(input, inputLength, dest, length);
+  if (static_cast<size_t>(result) != length) {
+    RTC_LOG(LS_ERROR) << "Push audio source resample failed, result: " << result;
+    return;
+  }
+  ++queuedFrames_;
+}
+
+//-----------------------------------------------------------------------------
+void PushAudioSource::remixInto(
+                                const int16_t *input,
+                                size_t inputChannels,
+                                size_t samplesPerChannel,
+                                int16_t *output
+                                ) const noexcept
+{
+  if (inputChannels == channels_) {
+    memcpy(output, input, samplesPerChannel * inputChannels * sizeof(int16_t));
+    return;
+  }
+
+  if (1 == channels_) {
+    // down mix by averaging all input channels
+    for (size_t index = 0; index < samplesPerChannel; ++index, input += inputChannels) {
+      int32_t sum = 0;
+      for (size_t channel = 0; channel < inputChannels; ++channel) {
+        sum += input[channel];
+      }
+      output[index] = static_cast<int16_t>(sum / static_cast<int32_t>(inputChannels));
+    }
+    return;
+  }
+
+  // stereo output: duplicate mono input, otherwise keep the front pair
+  for (size_t index = 0; index < samplesPerChannel; ++index, input += inputChannels, output += 2) {
+    output[0] = input[0];
+    output[1] = (1 == inputChannels ? input[0] : input[1]);
+  }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/mediastreaminterface.h"
+#include "api/notifier.h"
+#include "common_audio/resampler/include/push_resampler.h"
+#include "rtc_base/criticalsection.h"
+#include "rtc_base/scoped_ref_ptr.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // An audio source fed by the application rather than by the audio device
+  // module. Blocks of interleaved PCM of any rate and channel count are pushed
+  // in, converted to the source's fixed output format and re-chunked into
+  // 10ms frames held in a bounded jitter queue. A single shared pacing thread
+  // drains one frame every 10ms per source and delivers it to the attached
+  // track sinks, substituting silence (and counting an underrun) whenever the
+  // queue runs dry.
+  //
+  // NOTE: audio captured by the factory's audio device is also delivered to
+  // every sending audio stream, so factories hosting push sources should be
+  // created with audio capturing disabled.
+  class PushAudioSource : public Notifier<AudioSourceInterface>
+  {
+  public:
+    struct CreationProperties
+    {
+      int sampleRateHz_ {48000};
+      size_t channels_ {1};             // output channels, 1 or 2
+      size_t maxQueuedFrames_ {20};     // 10ms frames held before dropping the oldest
+      size_t prebufferFrames_ {2};      // 10ms frames required before (re)starting playout
+    };
+
+    struct Stats
+    {
+      size_t queuedFrames_ {};
+      uint64_t pushedSamples_ {};       // per channel, at the pushed rate
+      uint64_t deliveredFrames_ {};     // 10ms frames of real audio delivered
+      uint64_t silentFrames_ {};        // 10ms frames of silence delivered
+      uint64_t underruns_ {};           // times playout starved after audio started
+      uint64_t overflows_ {};           // 10ms frames dropped because the queue was full
+      uint64_t rejectedPushes_ {};      // pushes with an unsupported format
+    };
+
+    static rtc::scoped_refptr<PushAudioSource> create(const CreationProperties &props) noexcept;
+
+    bool pushAudio(
+                   const int16_t *interleaved,
+                   size_t samplesPerChannel,
+                   int sampleRateHz,
+                   size_t channels
+                   ) noexcept;
+    bool pushAudio(
+                   const float *interleaved,
+                   size_t samplesPerChannel,
+                   int sampleRateHz,
+                   size_t channels
+                   ) noexcept;
+
+    Stats stats() const noexcept;
+    int sampleRateHz() const noexcept { return sampleRateHz_; }
+    size_t channels() const noexcept { return channels_; }
+
+    // MediaSourceInterface
+    SourceState state() const override { return kLive; }
+    bool remote() const override { return false; }
+
+    // AudioSourceInterface
+    void AddSink(AudioTrackSinkInterface *sink) override;
+    void RemoveSink(AudioTrackSinkInterface *sink) override;
+
+    // called from the shared pacing thread every 10ms
+    void deliverFrame() noexcept;
+
+  protected:
+    explicit PushAudioSource(const CreationProperties &props) noexcept;
+    ~PushAudioSource() override;
+
+  private:
+    size_t frameSamples() const noexcept { return frameSamplesPerChannel_ * channels_; }
+    void resampleIntoQueue(const int16_t *input, size_t inputLength) noexcept;
+    void remixInto(
+                   const int16_t *input,
+                   size_t inputChannels,
+                   size_t samplesPerChannel,
+                   int16_t *output
+                   ) const noexcept;
+
+  private:
+    const int sampleRateHz_ {};
+    const size_t channels_ {};
+    const size_t frameSamplesPerChannel_ {};
+    const size_t maxQueuedFrames_ {};
+    const size_t prebufferFrames_ {};
+
+    mutable rtc::CriticalSection queueCs_;
+    PushResampler<int16_t> resampler_;
+    int inputRateHz_ {};
+    std::vector<int16_t> staging_;      // partial 10ms of remixed input at the input rate
+    size_t stagingLength_ {};
+    std::vector<int16_t> converted_;    // float to int16 scratch
+    std::vector<int16_t> queue_;        // ring of maxQueuedFrames_ output frames
+    size_t queueHead_ {};
+    size_t queuedFrames_ {};
+    bool buffering_ {true};
+    Stats stats_;
+
+    rtc::CriticalSection sinkCs_;
+    std::vector<AudioTrackSinkInterface *> sinks_;
+    std::vector<AudioTrackSinkInterface *> deliverSinks_;   // only touched on the pacing thread
+    std::vector<int16_t> outFrame_;     // only touched on the pacing thread
+  };
+
+} // namespace webrtc
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <zsLib/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  struct RenderFrameQueueTypes
+  {
+    enum LatencyMode
+    {
+      LatencyMode_First,
+
+      LatencyMode_Smooth = LatencyMode_First,   // up to smoothFrames_ frames are held in order
+      LatencyMode_LatestFrame,                  // only the newest frame is held
+
+      LatencyMode_Last = LatencyMode_LatestFrame,
+    };
+
+    // How frames that depend on earlier frames (encoded delta frames) are
+    // treated when frames have to be dropped.
+    enum KeyFramePolicy
+    {
+      KeyFramePolicy_First,
+
+      KeyFramePolicy_SkipToLatestKeyFrame = KeyFramePolicy_First, // as WaitForKeyFrame, and a newly queued key frame discards the frames ahead of it
+      KeyFramePolicy_WaitForKeyFrame,                             // after a drop delta frames are discarded until the next key frame
+      KeyFramePolicy_None,                                        // drops never wait for a key frame
+
+      KeyFramePolicy_Last = KeyFramePolicy_None,
+    };
+
+    struct Options
+    {
+      LatencyMode latencyMode_ {LatencyMode_Smooth};
+      size_t smoothFrames_ {3};
+      KeyFramePolicy keyFramePolicy_ {KeyFramePolicy_SkipToLatestKeyFrame};
+    };
+
+    struct Stats
+    {
+      size_t depth_ {};                       // frames currently held
+      uint64_t pushed_ {};                    // frames offered by the producer
+      uint64_t delivered_ {};                 // frames taken by the consumer
+      uint64_t replaced_ {};                  // LatencyMode_LatestFrame frames superseded before delivery
+      uint64_t overflowed_ {};                // frames dropped because the queue was full
+      uint64_t awaitingKeyFrame_ {};          // delta frames dropped while waiting for a key frame
+      uint64_t skipped_ {};                   // frames discarded ahead of a newer key frame
+    };
+  };
+
+  //---------------------------------------------------------------------------
+  // A bounded single producer / single consumer queue handing frames from the
+  // thread producing them to the thread rendering them without any locking.
+  // push() must only ever be called by one thread at a time, and likewise
+  // pop(); the two may run concurrently.
+  //
+  // In LatencyMode_Smooth frames are held in a ring of smoothFrames_ slots
+  // and frames arriving while the ring is full are dropped. In
+  // LatencyMode_LatestFrame a single slot is exchanged atomically so a newer
+  // frame always replaces an undelivered one. Frames are available to the
+  // consumer as soon as they are pushed.
+  template <typename T>
+  class RenderFrameQueue : public RenderFrameQueueTypes
+  {
+  public:
+    typedef std::unique_ptr<T> ValueUniPtr;
+
+  private:
+    struct Slot
+    {
+      ValueUniPtr value_;
+      uint64_t sequence_ {};
+    };
+
+  public:
+    explicit RenderFrameQueue(const Options &options) noexcept :
+      options_(options),
+      slots_(std::max<size_t>(options.smoothFrames_, 1) + 1)
+    {
+    }
+
+    ~RenderFrameQueue() noexcept
+    {
+      delete mailbox_.exchange(nullptr);
+    }
+
+    RenderFrameQueue(const RenderFrameQueue &) = delete;
+    RenderFrameQueue &operator=(const RenderFrameQueue &) = delete;
+
+    //-------------------------------------------------------------------------
+    // Producer side. Returns false if the frame was dropped.
+    bool push(ValueUniPtr value, bool isKeyFrame) noexcept
+    {
+      if (!value) return false;
+
+      ++pushed_;
+
+      if (isKeyFrame) {
+        awaitingKeyFrame_ = false;
+      } else if (awaitingKeyFrame_) {
+        // a delta frame cannot be rendered without the frames preceding it
+        ++droppedAwaitingKeyFrame_;
+        return false;
+      }
+
+      const uint64_t sequence = ++sequence_;
+      const bool waitAfterDrop = (KeyFramePolicy_None != options_.keyFramePolicy_);
+
+      if (LatencyMode_LatestFrame == options_.latencyMode_) {
+        if ((!isKeyFrame) &&
+            (waitAfterDrop) &&
+            (nullptr != mailbox_.load(std::memory_order_acquire))) {
+          // the undelivered frame is needed to decode this one, so keep it
+          // and resume at the next key frame instead
+          ++overflowed_;
+          awaitingKeyFrame_ = true;
+          return false;
+        }
+
+        T *replaced = mailbox_.exchange(value.release(), std::memory_order_acq_rel);
+        if (replaced) {
+          delete replaced;
+          ++replaced_;
+        }
+      } else {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t next = (tail + 1) % slots_.size();
+        if (next == head_.load(std::memory_order_acquire)) {
+          ++overflowed_;
+          if (waitAfterDrop) awaitingKeyFrame_ = true;
+          return false;
+        }
+
+        slots_[tail].value_ = std::move(value);
+        slots_[tail].sequence_ = sequence;
+        tail_.store(next, std::memory_order_release);
+
+        if ((isKeyFrame) && (KeyFramePolicy_SkipToLatestKeyFrame == options_.keyFramePolicy_))
+          skipBefore_.store(sequence, std::memory_order_release);
+      }
+
+      if (isKeyFrame) receivedKeyFrame_ = true;
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Consumer side. Returns an empty pointer if no frame is available.
+    ValueUniPtr pop() noexcept
+    {
+      if (LatencyMode_LatestFrame == options_.latencyMode_) {
+        ValueUniPtr value(mailbox_.exchange(nullptr, std::memory_order_acq_rel));
+        if (value) ++delivered_;
+        return value;
+      }
+
+      while (true) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return ValueUniPtr();
+
+        auto &slot = slots_[head];
+        ValueUniPtr value = std::move(slot.value_);
+        const uint64_t sequence = slot.sequence_;
+        head_.store((head + 1) % slots_.size(), std::memory_order_release);
+
+        if (sequence < skipBefore_.load(std::memory_order_acquire)) {
+          ++skipped_;
+          continue;
+        }
+
+        ++delivered_;
+        return value;
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    // True once a key frame has been accepted, i.e. rendering can begin.
+    bool receivedKeyFrame() const noexcept { return receivedKeyFrame_; }
+
+    const Options &options() const noexcept { return options_; }
+
+    //-------------------------------------------------------------------------
+    // Safe from any thread; values are a consistent enough snapshot for
+    // reporting.
+    Stats stats() const noexcept
+    {
+      Stats result;
+      if (LatencyMode_LatestFrame == options_.latencyMode_) {
+        result.depth_ = (nullptr != mailbox_.load(std::memory_order_acquire) ? 1 : 0);
+      } else {
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        result.depth_ = (tail + slots_.size() - head) % slots_.size();
+      }
+      result.pushed_ = pushed_;
+      result.delivered_ = delivered_;
+      result.replaced_ = replaced_;
+      result.overflowed_ = overflowed_;
+      result.awaitingKeyFrame_ = droppedAwaitingKeyFrame_;
+      result.skipped_ = skipped_;
+      return result;
+    }
+
+  private:
+    const Options options_;
+
+    // ring used in LatencyMode_Smooth; one slot is always left empty
+    std::vector<Slot> slots_;
+    std::atomic<size_t> head_ {};             // written by the consumer
+    std::atomic<size_t> tail_ {};             // written by the producer
+    std::atomic<uint64_t> skipBefore_ {};     // written by the producer
+
+    // single slot used in LatencyMode_LatestFrame
+    std::atomic<T *> mailbox_ {};
+
+    // producer only
+    uint64_t sequence_ {};
+    bool awaitingKeyFrame_ {true};
+
+    std::atomic_bool receivedKeyFrame_ {};
+
+    std::atomic<uint64_t> pushed_ {};
+    std::atomic<uint64_t> delivered_ {};
+    std::atomic<uint64_t> replaced_ {};
+    std::atomic<uint64_t> overflowed_ {};
+    std::atomic<uint64_t> droppedAwaitingKeyFrame_ {};
+    std::atomic<uint64_t> skipped_ {};
+  };
+
+} // namespace webrtc
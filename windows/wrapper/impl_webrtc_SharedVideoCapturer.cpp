@@ -0,0 +1,103 @@
+
+#include "impl_webrtc_SharedVideoCapturer.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "media/base/videocommon.h"
+#include "rtc_base/logging.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+SharedVideoCapturer::SharedVideoCapturer(const make_private &) noexcept :
+  sink_(*this)
+{
+}
+
+//-----------------------------------------------------------------------------
+SharedVideoCapturer::~SharedVideoCapturer()
+{
+  if (fanout_)
+    fanout_->removeSink(&sink_);
+}
+
+//-----------------------------------------------------------------------------
+SharedVideoCapturerUniPtr SharedVideoCapturer::create(const CreationProperties &props) noexcept
+{
+  ZS_ASSERT(props.fanout_);
+  if (!props.fanout_) return SharedVideoCapturerUniPtr();
+
+  auto result = std::make_unique<SharedVideoCapturer>(make_private{});
+  result->init(props);
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+void SharedVideoCapturer::init(const CreationProperties &props) noexcept
+{
+  fanout_ = props.fanout_;
+  sinkOptions_ = props.sinkOptions_;
+
+  if (props.id_)
+    SetId(props.id_);
+
+  std::vector<cricket::VideoFormat> formats = props.formats_;
+  if (formats.empty()) {
+    // the frames arrive at whatever size the source captures; these only
+    // satisfy the track source's format negotiation
+    formats.push_back(cricket::VideoFormat(1920, 1080, cricket::VideoFormat::FpsToInterval(30), cricket::FOURCC_I420));
+    formats.push_back(cricket::VideoFormat(1280, 720, cricket::VideoFormat::FpsToInterval(30), cricket::FOURCC_I420));
+    formats.push_back(cricket::VideoFormat(640, 480, cricket::VideoFormat::FpsToInterval(30), cricket::FOURCC_I420));
+    formats.push_back(cricket::VideoFormat(320, 240, cricket::VideoFormat::FpsToInterval(30), cricket::FOURCC_I420));
+  }
+  SetSupportedFormats(formats);
+}
+
+//-----------------------------------------------------------------------------
+cricket::CaptureState SharedVideoCapturer::Start(const cricket::VideoFormat &captureFormat)
+{
+  if (running_.exchange(true))
+    return cricket::CS_RUNNING;
+
+  SetCaptureFormat(&captureFormat);
+  fanout_->addSink(&sink_, sinkOptions_);
+  SetCaptureState(cricket::CS_RUNNING);
+  return cricket::CS_RUNNING;
+}
+
+//-----------------------------------------------------------------------------
+void SharedVideoCapturer::Stop()
+{
+  if (!running_.exchange(false))
+    return;
+
+  fanout_->removeSink(&sink_);
+  SetCaptureFormat(nullptr);
+  SetCaptureState(cricket::CS_STOPPED);
+}
+
+//-----------------------------------------------------------------------------
+bool SharedVideoCapturer::IsRunning()
+{
+  return running_;
+}
+
+//-----------------------------------------------------------------------------
+bool SharedVideoCapturer::GetPreferredFourccs(std::vector<uint32_t> *fourccs)
+{
+  if (!fourccs) return false;
+
+  fourccs->clear();
+  fourccs->push_back(cricket::FOURCC_I420);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void SharedVideoCapturer::onSharedFrame(const VideoFrame &frame) noexcept
+{
+  if (!running_) return;
+
+  // the buffer is shared with every other consumer of the fanout; the
+  // adapter and broadcaster only ever read from it
+  OnFrame(frame, frame.width(), frame.height());
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "impl_webrtc_VideoFrameFanout.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "media/base/videocapturer.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(SharedVideoCapturer);
+
+  //---------------------------------------------------------------------------
+  // A capturer that does not own a device. It attaches to the fanout of
+  // another capturer while running and re-publishes the frames that capturer
+  // has already converted, which lets several VideoTrackSources share a
+  // single camera with one conversion per frame. Each shared capturer keeps
+  // its own video adapter and therefore its own output format.
+  class SharedVideoCapturer : public cricket::VideoCapturer
+  {
+  private:
+    struct make_private {};
+
+    struct FrameSink : public VideoFrameFanout::SinkType
+    {
+      FrameSink(SharedVideoCapturer &outer) noexcept : outer_(outer) {}
+      void OnFrame(const VideoFrame &frame) override { outer_.onSharedFrame(frame); }
+
+    private:
+      SharedVideoCapturer &outer_;
+    };
+
+  public:
+    struct CreationProperties
+    {
+      VideoFrameFanoutPtr fanout_;
+      VideoFrameFanout::SinkOptions sinkOptions_;
+      const char *id_ {};
+      std::vector<cricket::VideoFormat> formats_;   // defaults to common I420 formats when empty
+    };
+
+    SharedVideoCapturer(const make_private &) noexcept;
+    ~SharedVideoCapturer() override;
+
+    static SharedVideoCapturerUniPtr create(const CreationProperties &props) noexcept;
+
+    VideoFrameFanoutPtr fanout() const noexcept { return fanout_; }
+    VideoFrameFanout::SinkType *sink() noexcept { return &sink_; }
+
+    // Overrides from cricket::VideoCapturer
+    cricket::CaptureState Start(const cricket::VideoFormat &captureFormat) override;
+    void Stop() override;
+    bool IsRunning() override;
+    bool IsScreencast() const override { return false; }
+    bool GetPreferredFourccs(std::vector<uint32_t> *fourccs) override;
+
+  private:
+    void init(const CreationProperties &props) noexcept;
+    void onSharedFrame(const VideoFrame &frame) noexcept;
+
+  private:
+    VideoFrameFanoutPtr fanout_;
+    VideoFrameFanout::SinkOptions sinkOptions_;
+    FrameSink sink_;
+    std::atomic<bool> running_ {};
+  };
+
+} // namespace webrtc
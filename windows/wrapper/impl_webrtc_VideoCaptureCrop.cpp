@@ -0,0 +1,89 @@
+
+#include "impl_webrtc_VideoCaptureCrop.h"
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+VideoCaptureCrop::VideoCaptureCrop(const make_private &) noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureCrop::~VideoCaptureCrop() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureCropPtr VideoCaptureCrop::create() noexcept
+{
+  return std::make_shared<VideoCaptureCrop>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoCaptureCrop::setOptions(const Options &options) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  options_ = options;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureCrop::Options VideoCaptureCrop::options() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return options_;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureCrop::Rect VideoCaptureCrop::resolve(int width, int height) const noexcept
+{
+  Options options = this->options();
+
+  Rect result;
+  result.width_ = width;
+  result.height_ = height;
+
+  if ((width < 2) || (height < 2)) return result;
+
+  if ((options.rect_.width_ > 0) && (options.rect_.height_ > 0)) {
+    int left = std::max(options.rect_.x_, 0);
+    int top = std::max(options.rect_.y_, 0);
+    int right = std::min(options.rect_.x_ + options.rect_.width_, width);
+    int bottom = std::min(options.rect_.y_ + options.rect_.height_, height);
+    if ((right > left) && (bottom > top)) {
+      result.x_ = left;
+      result.y_ = top;
+      result.width_ = right - left;
+      result.height_ = bottom - top;
+    }
+  }
+
+  if ((options.aspectRatioWidth_ > 0) && (options.aspectRatioHeight_ > 0)) {
+    int64_t scaledWidth = static_cast<int64_t>(result.height_) * options.aspectRatioWidth_;
+    int64_t scaledHeight = static_cast<int64_t>(result.width_) * options.aspectRatioHeight_;
+    if (scaledWidth < scaledHeight) {
+      // too wide, trim the sides
+      int trimmed = static_cast<int>(scaledWidth / options.aspectRatioHeight_);
+      if (trimmed > 0) {
+        result.x_ += (result.width_ - trimmed) / 2;
+        result.width_ = trimmed;
+      }
+    } else if (scaledHeight < scaledWidth) {
+      // too tall, trim the top and bottom
+      int trimmed = static_cast<int>(scaledHeight / options.aspectRatioWidth_);
+      if (trimmed > 0) {
+        result.y_ += (result.height_ - trimmed) / 2;
+        result.height_ = trimmed;
+      }
+    }
+  }
+
+  // 4:2:0 chroma is subsampled by two in each direction
+  if (0 != (result.x_ % 2)) { --result.x_; }
+  if (0 != (result.y_ % 2)) { --result.y_; }
+  if ((result.width_ > 1) && (0 != (result.width_ % 2))) { --result.width_; }
+  if ((result.height_ > 1) && (0 != (result.height_ % 2))) { --result.height_; }
+
+  return result;
+}
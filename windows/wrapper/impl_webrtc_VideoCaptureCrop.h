@@ -0,0 +1,56 @@
+#pragma once
+
+#include "impl_webrtc_VideoFrameConverter.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/criticalsection.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoCaptureCrop);
+
+  //---------------------------------------------------------------------------
+  // The region of the captured frame a capturer converts and emits. Only the
+  // selected pixels are read by the colour conversion, so cropping reduces
+  // conversion work in proportion to the area removed.
+  //
+  // The crop is shared between the capturer and its wrapper so it can still
+  // be changed after the capturer has been handed to a VideoTrackSource.
+  class VideoCaptureCrop
+  {
+  private:
+    struct make_private {};
+
+  public:
+    typedef VideoFrameConverter::Rect Rect;
+
+    struct Options
+    {
+      Rect rect_;                       // in source pixels, an empty rect selects the whole frame
+      int aspectRatioWidth_ {};         // when both are set the region is further
+      int aspectRatioHeight_ {};        // trimmed (centered) to this aspect ratio
+    };
+
+  public:
+    VideoCaptureCrop(const make_private &) noexcept;
+    ~VideoCaptureCrop() noexcept;
+
+    static VideoCaptureCropPtr create() noexcept;
+
+    void setOptions(const Options &options) noexcept;
+    Options options() const noexcept;
+
+    // Resolves the options against a frame of the given size. The result is
+    // always inside the frame, non-empty and, so chroma planes stay aligned,
+    // has an even origin and size whenever the frame permits.
+    Rect resolve(int width, int height) const noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    Options options_;
+  };
+
+} // namespace webrtc
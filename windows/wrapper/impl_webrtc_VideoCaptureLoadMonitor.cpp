@@ -0,0 +1,115 @@
+
+#include "impl_webrtc_VideoCaptureLoadMonitor.h"
+
+using namespace webrtc;
+
+namespace
+{
+  // weight of the newest frame in the smoothed load, roughly averaging over
+  // the last second at 30fps
+  const float kSmoothing = 0.05f;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitor::VideoCaptureLoadMonitor(const make_private &) noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitor::~VideoCaptureLoadMonitor() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitorPtr VideoCaptureLoadMonitor::create() noexcept
+{
+  return std::make_shared<VideoCaptureLoadMonitor>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoCaptureLoadMonitor::setOptions(const Options &options) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  if (options.enabled_ != options_.enabled_)
+    resetPending_ = true;
+  options_ = options;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitor::Options VideoCaptureLoadMonitor::options() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return options_;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitor::Stats VideoCaptureLoadMonitor::stats() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return stats_;
+}
+
+//-----------------------------------------------------------------------------
+void VideoCaptureLoadMonitor::reset() noexcept
+{
+  rtc::CritScope cs(&cs_);
+  resetPending_ = true;
+}
+
+//-----------------------------------------------------------------------------
+VideoCaptureLoadMonitor::Decision VideoCaptureLoadMonitor::onFrame(
+                                                                   int64_t processingUs,
+                                                                   int64_t intervalUs,
+                                                                   int64_t nowUs
+                                                                   ) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  if (resetPending_) {
+    resetPending_ = false;
+    stats_.load_ = 0;
+    settleUntilUs_ = nowUs + (kSettleMs * 1000);
+    overuseSinceUs_ = 0;
+    underuseSinceUs_ = 0;
+  }
+
+  if ((!options_.enabled_) || (intervalUs <= 0)) return Decision_None;
+
+  // the first frames after a (re)start pay for device and pool warm up
+  if (nowUs < settleUntilUs_) return Decision_None;
+
+  const float load = static_cast<float>(processingUs) / static_cast<float>(intervalUs);
+  stats_.load_ = (0 == stats_.load_ ? load : stats_.load_ + ((load - stats_.load_) * kSmoothing));
+
+  if (stats_.load_ > options_.overuseLoad_) {
+    underuseSinceUs_ = 0;
+    if (0 == overuseSinceUs_) overuseSinceUs_ = nowUs;
+    if (nowUs - overuseSinceUs_ < (static_cast<int64_t>(options_.overuseMs_) * 1000)) return Decision_None;
+    overuseSinceUs_ = 0;
+    return Decision_StepDown;
+  }
+
+  overuseSinceUs_ = 0;
+
+  if (stats_.load_ < options_.underuseLoad_) {
+    if (0 == underuseSinceUs_) underuseSinceUs_ = nowUs;
+    if (nowUs - underuseSinceUs_ < (static_cast<int64_t>(options_.underuseMs_) * 1000)) return Decision_None;
+    underuseSinceUs_ = 0;
+    return Decision_StepUp;
+  }
+
+  underuseSinceUs_ = 0;
+  return Decision_None;
+}
+
+//-----------------------------------------------------------------------------
+void VideoCaptureLoadMonitor::onStepped(Decision decision) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  switch (decision) {
+    case Decision_StepDown: ++stats_.stepsDown_; break;
+    case Decision_StepUp:   ++stats_.stepsUp_; break;
+    case Decision_None:     return;
+  }
+  resetPending_ = true;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/criticalsection.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoCaptureLoadMonitor);
+
+  //---------------------------------------------------------------------------
+  // Decides when a capturer should step its capture format down or up based
+  // on how much of each frame interval is spent converting and delivering
+  // the frame. When the machine cannot keep up, frames back up and are
+  // dropped at random further down the pipeline; capturing fewer pixels
+  // degrades the stream smoothly instead.
+  //
+  // The load is the time spent per frame divided by the frame interval,
+  // smoothed over recent frames. A step down is only requested once the
+  // load has stayed above the overuse threshold for overuseMs_, and a step
+  // up once it has stayed below the underuse threshold for the (much
+  // longer) underuseMs_, so the format does not oscillate. Measurements are
+  // ignored for a moment after every step while the device restarts.
+  //
+  // onFrame() must only be called from the capturing thread; options and
+  // statistics may be accessed from any thread.
+  class VideoCaptureLoadMonitor
+  {
+  private:
+    struct make_private {};
+
+  public:
+    enum Decision
+    {
+      Decision_None,
+      Decision_StepDown,
+      Decision_StepUp,
+    };
+
+    struct Options
+    {
+      bool enabled_ {};
+      float overuseLoad_ {0.85f};       // fraction of the frame interval
+      float underuseLoad_ {0.45f};
+      int overuseMs_ {2000};
+      int underuseMs_ {10000};
+    };
+
+    struct Stats
+    {
+      float load_ {};                   // smoothed fraction of the frame interval spent per frame
+      uint64_t stepsDown_ {};
+      uint64_t stepsUp_ {};
+    };
+
+    static const int kSettleMs = 1000;
+
+  public:
+    VideoCaptureLoadMonitor(const make_private &) noexcept;
+    ~VideoCaptureLoadMonitor() noexcept;
+
+    static VideoCaptureLoadMonitorPtr create() noexcept;
+
+    void setOptions(const Options &options) noexcept;
+    Options options() const noexcept;
+    Stats stats() const noexcept;
+
+    // Forgets the measured load, e.g. when capture (re)starts.
+    void reset() noexcept;
+
+    // Records the time spent on one frame and returns the step the capture
+    // format should take, if any.
+    Decision onFrame(
+                     int64_t processingUs,
+                     int64_t intervalUs,
+                     int64_t nowUs
+                     ) noexcept;
+
+    // Records a step that was taken after being decided by onFrame().
+    void onStepped(Decision decision) noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    Options options_;
+    Stats stats_;
+    bool resetPending_ {true};
+
+    // capturing thread only
+    int64_t settleUntilUs_ {};
+    int64_t overuseSinceUs_ {};
+    int64_t underuseSinceUs_ {};
+  };
+
+} // namespace webrtc
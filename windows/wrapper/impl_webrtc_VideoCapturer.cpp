@@ -5,6 +5,7 @@
 #endif //_WIN32
 
 #include "impl_webrtc_VideoCapturer.h"
+#include "impl_org_webRtc_VideoFormat.h"
 #include "impl_org_webRtc_VideoFrameBufferEvent.h"
 #include "impl_org_webRtc_VideoFrameNativeBuffer.h"
 
@@ -31,12 +32,15 @@
 #include "impl_org_webRtc_WebrtcLib.h"
 #include "impl_webrtc_MRCAudioEffectDefinition.h"
 #include "impl_webrtc_MRCVideoEffectDefinition.h"
+#include "impl_webrtc_VideoFormatCost.h"
+#include "impl_webrtc_VideoFrameConverter.h"
 
 #include <wrapper/impl_org_webRtc_pre_include.h>
 #include "media/base/videocommon.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/Win32.h"
-#include "libyuv/planar_functions.h"
+#include "rtc_base/timeutils.h"
+#include "system_wrappers/include/clock.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "api/video/i420_buffer.h"
 #include <wrapper/impl_org_webRtc_post_include.h>
@@ -81,6 +85,7 @@ using namespace cricket;
 
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::WebRtcLib, UseWebrtcLib);
 
+ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFormat, UseVideoFormat);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameNativeBuffer, UseVideoFrameNativeBuffer);
 ZS_DECLARE_TYPEDEF_PTR(wrapper::impl::org::webRtc::VideoFrameBufferEvent, UseVideoFrameBufferEvent);
 
@@ -231,6 +236,10 @@ namespace webrtc
 
     void StopCapture();
 
+    // Waits for a stop in progress to complete, after which the capture
+    // may be started again.
+    bool WaitForStop(int timeout_ms);
+
     bool CaptureStarted() { return capture_started_; }
 
     VideoFormat GetFrameInfo() { return frame_info_; }
@@ -256,9 +265,6 @@ namespace webrtc
       return false;
     }
 
-  private:
-    void RemovePaddingPixels(uint8_t* video_frame, size_t& video_frame_length);
-
   private:
     winrt::agile_ref<winrt::Windows::Media::Capture::MediaCapture> media_capture_;
     winrt::hstring device_id_;
@@ -534,6 +540,11 @@ namespace webrtc
       return;
     }
 
+    // The event resets when waited on; consume any earlier signal so it is
+    // only signalled again by the completion below, once the sink and media
+    // capture have been torn down.
+    _stopped->Wait(0);
+
     Concurrency::create_task([this]() {
       return media_capture_.get().StopRecordAsync().get();
       }).then([this](Concurrency::task<void> async_info) {
@@ -553,6 +564,17 @@ namespace webrtc
     });
   }
 
+  //-----------------------------------------------------------------------------
+  bool CaptureDevice::WaitForStop(int timeout_ms) {
+    if (_stopped->Wait(timeout_ms) == kEventTimeout) {
+      return false;
+    }
+
+    // the event resets when waited on; the device remains stopped
+    _stopped->Set();
+    return true;
+  }
+
   //-----------------------------------------------------------------------------
   void CaptureDevice::OnCaptureFailed(
     winrt::Windows::Media::Capture::MediaCapture const& /*sender*/,
@@ -573,6 +595,9 @@ namespace webrtc
     if (!capture_device_listener_)
       return;
 
+    const VideoFrameTrace::FrameId trace_id = VideoFrameTrace::beginFrame();
+    VideoFrameTrace::record(trace_id, VideoFrameTrace::Stage_CaptureSample);
+
     winrt::com_ptr<IMFMediaBuffer> spMediaBuffer;
     HRESULT hr = sample->GetBufferByIndex(0, spMediaBuffer.put());
     LONGLONG hnsSampleTime = 0;
@@ -589,22 +614,22 @@ namespace webrtc
     if (SUCCEEDED(hr)) {
       uint8_t* video_frame;
       size_t video_frame_length;
-      int64_t capture_time;
+      int64_t capture_time_us;
       video_frame = pbBuffer;
       video_frame_length = cbCurrentLength;
-      // conversion from 100-nanosecond to millisecond units
-      capture_time = hnsSampleTime / 10000;
-
-      RemovePaddingPixels(video_frame, video_frame_length);
+      // conversion from 100-nanosecond to microsecond units
+      capture_time_us = hnsSampleTime / 10;
 
       RTC_LOG(LS_VERBOSE) <<
         "Video Capture - Media sample received - video frame length: " <<
-        video_frame_length << ", capture time : " << capture_time;
+        video_frame_length << ", capture time : " << (capture_time_us / 1000);
 
       capture_device_listener_->OnIncomingFrame(
         video_frame,
         video_frame_length,
         frame_info_,
+        capture_time_us,
+        trace_id,
         sample);
 
       hr = spMediaBuffer->Unlock();
@@ -704,114 +729,6 @@ namespace webrtc
     return media_capture_;
   }
 
-  //-----------------------------------------------------------------------------
-  void CaptureDevice::RemovePaddingPixels(uint8_t* video_frame,
-    size_t& video_frame_length) {
-
-    int padded_row_num = 16 - frame_info_.height % 16;
-    int padded_col_num = 16 - frame_info_.width % 16;
-    if (padded_row_num == 16)
-      padded_row_num = 0;
-    if (padded_col_num == 16)
-      padded_col_num = 0;
-
-    if (frame_info_.fourcc == FOURCC_YV12 &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 3 / 2) {
-      uint8_t* src_video_y = video_frame;
-      uint8_t* src_video_v = src_video_y +
-        (frame_info_.width + padded_col_num) *
-        (frame_info_.height + padded_row_num);
-      uint8_t* src_video_u = src_video_v +
-        (frame_info_.width + padded_col_num) *
-        (frame_info_.height + padded_row_num) / 4;
-      uint8_t* dst_video_y = src_video_y;
-      uint8_t* dst_video_v = dst_video_y +
-        frame_info_.width * frame_info_.height;
-      uint8_t* dst_video_u = dst_video_v +
-        frame_info_.width * frame_info_.height / 4;
-      video_frame_length = frame_info_.width * frame_info_.height * 3 / 2;
-      libyuv::CopyPlane(src_video_y, frame_info_.width + padded_col_num,
-        dst_video_y, frame_info_.width,
-        frame_info_.width, frame_info_.height);
-      libyuv::CopyPlane(src_video_v, (frame_info_.width + padded_col_num) / 2,
-        dst_video_v, frame_info_.width / 2,
-        frame_info_.width / 2, frame_info_.height / 2);
-      libyuv::CopyPlane(src_video_u, (frame_info_.width + padded_col_num) / 2,
-        dst_video_u, frame_info_.width / 2,
-        frame_info_.width / 2, frame_info_.height / 2);
-    } else if (frame_info_.fourcc == FOURCC_YUY2 &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 2) {
-      uint8_t* src_video = video_frame;
-      uint8_t* dst_video = src_video;
-      video_frame_length = frame_info_.width * frame_info_.height * 2;
-      libyuv::CopyPlane(src_video, 2 * (frame_info_.width + padded_col_num),
-        dst_video, 2 * frame_info_.width,
-        2 * frame_info_.width, frame_info_.height);
-    } else if (frame_info_.fourcc == FOURCC_IYUV &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 3 / 2) {
-      uint8_t* src_video_y = video_frame;
-      uint8_t* src_video_u = src_video_y +
-        (frame_info_.width + padded_col_num) *
-        (frame_info_.height + padded_row_num);
-      uint8_t* src_video_v = src_video_u +
-        (frame_info_.width + padded_col_num) *
-        (frame_info_.height + padded_row_num) / 4;
-      uint8_t* dst_video_y = src_video_y;
-      uint8_t* dst_video_u = dst_video_y +
-        frame_info_.width * frame_info_.height;
-      uint8_t* dst_video_v = dst_video_u +
-        frame_info_.width * frame_info_.height / 4;
-      video_frame_length = frame_info_.width * frame_info_.height * 3 / 2;
-      libyuv::CopyPlane(src_video_y, frame_info_.width + padded_col_num,
-        dst_video_y, frame_info_.width,
-        frame_info_.width, frame_info_.height);
-      libyuv::CopyPlane(src_video_u, (frame_info_.width + padded_col_num) / 2,
-        dst_video_u, frame_info_.width / 2,
-        frame_info_.width / 2, frame_info_.height / 2);
-      libyuv::CopyPlane(src_video_v, (frame_info_.width + padded_col_num) / 2,
-        dst_video_v, frame_info_.width / 2,
-        frame_info_.width / 2, frame_info_.height / 2);
-    } else if (frame_info_.fourcc == FOURCC_24BG &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 3) {
-      uint8_t* src_video = video_frame;
-      uint8_t* dst_video = src_video;
-      video_frame_length = frame_info_.width * frame_info_.height * 3;
-      libyuv::CopyPlane(src_video, 3 * (frame_info_.width + padded_col_num),
-        dst_video, 3 * frame_info_.width,
-        3 * frame_info_.width, frame_info_.height);
-    } else if (frame_info_.fourcc == FOURCC_ARGB &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 4) {
-      uint8_t* src_video = video_frame;
-      uint8_t* dst_video = src_video;
-      video_frame_length = frame_info_.width * frame_info_.height * 4;
-      libyuv::CopyPlane(src_video, 4 * (frame_info_.width + padded_col_num),
-        dst_video, 4 * frame_info_.width,
-        4 * frame_info_.width, frame_info_.height);
-    } else if (frame_info_.fourcc == FOURCC_NV12 &&
-      (int32_t)video_frame_length >
-      frame_info_.width * frame_info_.height * 3 / 2) {
-      uint8_t* src_video_y = video_frame;
-      uint8_t* src_video_uv = src_video_y +
-        (frame_info_.width + padded_col_num) *
-        (frame_info_.height + padded_row_num);
-      uint8_t* dst_video_y = src_video_y;
-      uint8_t* dst_video_uv = dst_video_y +
-        frame_info_.width * frame_info_.height;
-      video_frame_length = frame_info_.width * frame_info_.height * 3 / 2;
-      libyuv::CopyPlane(src_video_y, frame_info_.width + padded_col_num,
-        dst_video_y, frame_info_.width,
-        frame_info_.width, frame_info_.height);
-      libyuv::CopyPlane(src_video_uv, frame_info_.width + padded_col_num,
-        dst_video_uv, frame_info_.width,
-        frame_info_.width, frame_info_.height / 2);
-    }
-  }
-
   //-----------------------------------------------------------------------------
   VideoCapturer::VideoCapturer(const make_private &) :
     device_(nullptr),
@@ -819,8 +736,16 @@ namespace webrtc
     display_orientation_(nullptr),
     video_encoding_properties_(nullptr),
     media_encoding_profile_(nullptr),
-    subscriptions_(decltype(subscriptions_)::create())
+    subscriptions_(decltype(subscriptions_)::create()),
+    fanout_(VideoFrameFanout::create()),
+    framePool_(I420FramePool::create()),
+    crop_(VideoCaptureCrop::create()),
+    changeDetector_(VideoChangeDetector::create()),
+    loadMonitor_(VideoCaptureLoadMonitor::create()),
+    adaptationGuard_(std::make_shared<AdaptationGuard>()),
+    timestampAligner_(new rtc::TimestampAligner())
   {
+    adaptationGuard_->capturer_ = this;
     RTC_LOG(LS_INFO) << "Using local detection for orientation source";
     display_orientation_ = std::make_shared<DisplayOrientation>(this);
   }
@@ -828,6 +753,10 @@ namespace webrtc
   //-----------------------------------------------------------------------------
   VideoCapturer::~VideoCapturer()
   {
+    {
+      std::lock_guard<std::mutex> lock(adaptationGuard_->mutex_);
+      adaptationGuard_->capturer_ = nullptr;
+    }
     if (deviceUniqueId_ != nullptr)
       delete[] deviceUniqueId_;
     if (device_ != nullptr)
@@ -939,11 +868,29 @@ namespace webrtc
 
     rtc::CritScope cs(&apiCs_);
 
+    // restarts queued by load adaptation for a previous start are ignored
+    ++startGeneration_;
+    requestedFormat_ = capture_format;
+
+    if (!startDevice(capture_format))
+      return CS_FAILED;
+
+    loadMonitor_->reset();
+    SetCaptureState(CS_RUNNING);
+
+    return CS_RUNNING;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool VideoCapturer::startDevice(const VideoFormat& capture_format) {
+
+    rtc::CritScope cs(&apiCs_);
+
     winrt::hstring subtype = CaptureDevice::GetVideoSubtype(capture_format.fourcc);
     if (subtype.empty()) {
       RTC_LOG(LS_ERROR) <<
         "The specified raw video format is not supported on this platform.";
-      return CS_FAILED;
+      return false;
     }
     if (_wcsicmp(subtype.c_str(),
       MediaEncodingSubtypes::Mjpg().c_str()) == 0) {
@@ -1011,14 +958,15 @@ namespace webrtc
     } catch (winrt::hresult_error const& e) {
       RTC_LOG(LS_ERROR) << "Failed to start capture. "
         << rtc::ToUtf8(e.message().c_str());
-      return CS_FAILED;
+      return false;
     }
 
+    auto region = crop_->resolve(capture_format.width, abs(capture_format.height));
+    framePool_->configure(region.width_, region.height_);
+    changeDetector_->reset();
+    timestampAligner_.reset(new rtc::TimestampAligner());
     SetCaptureFormat(&capture_format);
-
-    SetCaptureState(CS_RUNNING);
-
-    return CS_RUNNING;
+    return true;
   }
 
   //-----------------------------------------------------------------------------
@@ -1035,6 +983,7 @@ namespace webrtc
     }
     SetCaptureFormat(nullptr);
     SetCaptureState(CS_STOPPED);
+    framePool_->release();
   }
 
   //-----------------------------------------------------------------------------
@@ -1054,103 +1003,158 @@ namespace webrtc
       return false;
     }
 
-    fourccs->clear();
-    fourccs->push_back(FOURCC_I420);
-    fourccs->push_back(FOURCC_YV12);
-    fourccs->push_back(FOURCC_YUY2);
-    fourccs->push_back(FOURCC_UYVY);
-    fourccs->push_back(FOURCC_NV12);
-    fourccs->push_back(FOURCC_NV21);
-    fourccs->push_back(FOURCC_MJPG);
-    fourccs->push_back(FOURCC_ARGB);
-    fourccs->push_back(FOURCC_24BG);
-
+    // Cheapest to convert first, so formats differing only in fourcc are
+    // ranked by conversion cost when matched by GetBestCaptureFormat.
+    *fourccs = VideoFormatCost::preferredFourccs();
     return true;
   }
 
+  //-----------------------------------------------------------------------------
+  bool VideoCapturer::selectCaptureFormat(
+    const VideoFormat &desired,
+    VideoFormat &outBest) noexcept
+  {
+    const std::vector<VideoFormat> *formats = GetSupportedFormats();
+    if (formats && VideoFormatCost::selectCheapest(*formats, desired, outBest))
+      return true;
+
+    // nothing meets the desired size and rate, settle for the closest
+    return GetBestCaptureFormat(desired, &outBest);
+  }
+
   //-----------------------------------------------------------------------------
   void VideoCapturer::OnDisplayOrientationChanged(
     DisplayOrientations orientation) {
     ApplyDisplayOrientation(orientation);
   }
 
+  //-----------------------------------------------------------------------------
+  void VideoCapturer::OnSinkWantsChanged(const rtc::VideoSinkWants& wants)
+  {
+    rtc::VideoSinkWants adjusted = wants;
+    if (deferRotation_)
+      adjusted.rotation_applied = false;
+
+    // Rotation sinks ask for is applied while converting, in the same pass,
+    // rather than by cricket::VideoCapturer rotating each converted frame
+    // into another buffer.
+    apply_rotation_ = adjusted.rotation_applied;
+    cricket::VideoCapturer::OnSinkWantsChanged(adjusted);
+  }
+
   //-----------------------------------------------------------------------------
   void VideoCapturer::OnIncomingFrame(
     uint8_t* videoFrame,
     size_t videoFrameLength,
     const VideoFormat& frameInfo,
+    int64_t captureTimeUs,
+    VideoFrameTrace::FrameId traceId,
     winrt::com_ptr<IMFSample> spMediaSample)
   {
     rtc::CritScope cs(&apiCs_);
 
+    const int64_t startUs = rtc::TimeMicros();
+
+    // The device clock runs at its own rate from its own origin; map the
+    // moment of exposure onto the rtc clock used by the rest of the engine.
+    // Translated before any frame is dropped so the aligner sees every one.
+    const int64_t alignedCaptureUs = timestampAligner_->TranslateTimestamp(captureTimeUs, startUs);
+
     const int32_t width = frameInfo.width;
     const int32_t height = frameInfo.height;
 
-    int stride_y = width;
-    int stride_uv = (width + 1) / 2;
-    int target_width = width;
-    int target_height = height;
+    // Only the cropped region is read by the conversion.
+    const VideoCaptureCrop::Rect region = crop_->resolve(width, height);
 
-    // SetApplyRotation doesn't take any lock. Make a local copy here.
+    // OnSinkWantsChanged doesn't take apiCs_. Make a local copy here.
     bool apply_rotation = apply_rotation_;
+    const bool parallel = parallelConversion_;
+    const VideoRotation rotation =
+      apply_rotation ? rotateFrame_ : kVideoRotation_0;
+
+    // Devices may pad rows and planes out to 16 pixels. The padding is
+    // skipped by the conversion itself, except when native buffers are
+    // forwarded to delegates as those read the sample memory directly.
+    VideoFrameConverter::SourceLayout layout = VideoFrameConverter::describe(
+      frameInfo.fourcc, width, height, videoFrameLength);
+
+    // Unchanged frames of static content are dropped before any work is
+    // done for them.
+    if (!changeDetector_->examine(videoFrame, layout, region, startUs))
+      return;
+    if (layout.isPadded() && subscriptions_.size() > 0) {
+      layout = VideoFrameConverter::removePadding(videoFrame, layout);
+    }
+
+    rtc::scoped_refptr<I420BufferInterface> buffer;
+    int conversionResult = -1;
+
+    if (kVideoRotation_0 == rotation &&
+      VideoFrameConverter::canConvertToNV12(layout.fourcc_)) {
+      // Keep 4:2:0 sources in NV12 so the local preview renders them without
+      // conversion. Encoders needing I420 only split the chroma on demand.
+      rtc::scoped_refptr<NV12Buffer> nv12Buffer =
+        framePool_->createNV12Buffer(region.width_, region.height_);
+      conversionResult = VideoFrameConverter::convertToNV12(
+        videoFrame, layout, region, *nv12Buffer, parallel);
+      buffer = nv12Buffer;
+    } else {
+      int target_width = region.width_;
+      int target_height = region.height_;
 
-    if (apply_rotation) {
       // Rotating resolution when for 90/270 degree rotations.
-      if (rotateFrame_ == kVideoRotation_90 ||
-        rotateFrame_ == kVideoRotation_270) {
-        target_width = abs(height);
-        target_height = width;
+      if (rotation == kVideoRotation_90 ||
+        rotation == kVideoRotation_270) {
+        target_width = region.height_;
+        target_height = region.width_;
       }
-    }
 
-    rtc::scoped_refptr<I420Buffer> buffer = I420Buffer::Create(
-      target_width, abs(target_height), stride_y, stride_uv, stride_uv);
-
-    libyuv::RotationMode rotation_mode = libyuv::kRotate0;
-    if (apply_rotation) {
-      switch (rotateFrame_) {
-      case kVideoRotation_0:
-        rotation_mode = libyuv::kRotate0;
-        break;
-      case kVideoRotation_90:
-        rotation_mode = libyuv::kRotate90;
-        break;
-      case kVideoRotation_180:
-        rotation_mode = libyuv::kRotate180;
-        break;
-      case kVideoRotation_270:
-        rotation_mode = libyuv::kRotate270;
-        break;
-      }
+      // Strides follow the destination width so rotated frames are laid out
+      // the same as unrotated ones and the pool can recycle them alike.
+      int stride_y = target_width;
+      int stride_uv = (target_width + 1) / 2;
+
+      rtc::scoped_refptr<I420Buffer> i420Buffer = framePool_->createBuffer(
+        target_width, abs(target_height), stride_y, stride_uv, stride_uv);
+      conversionResult = VideoFrameConverter::convertToI420(
+        videoFrame, layout, region, rotation, *i420Buffer, parallel);
+      buffer = i420Buffer;
     }
 
-    const int conversionResult = libyuv::ConvertToI420(
-      videoFrame, videoFrameLength, buffer.get()->MutableDataY(),
-      buffer.get()->StrideY(), buffer.get()->MutableDataU(),
-      buffer.get()->StrideU(), buffer.get()->MutableDataV(),
-      buffer.get()->StrideV(), 0, 0,  // No Cropping
-      width, height, target_width, target_height, rotation_mode,
-      frameInfo.fourcc);
     if (conversionResult < 0) {
       RTC_LOG(LS_ERROR) << "Failed to convert capture frame from type "
-        << static_cast<int>(frameInfo.fourcc) << " to I420.";
+        << static_cast<int>(frameInfo.fourcc) << ".";
       return;
     }
 
-    int64_t captureTime = 0;
-    VideoFrame captureFrame(buffer, 0, rtc::TimeMillis(),
+    VideoFrameTrace::record(traceId, VideoFrameTrace::Stage_CaptureConverted);
+
+    // The encoder derives the RTP timestamp from the NTP capture time, so
+    // receivers recover it through the RTCP sender reports and can measure
+    // end to end latency from the moment of exposure.
+    const int64_t captureTimeMs = alignedCaptureUs / rtc::kNumMicrosecsPerMillisec;
+    VideoFrame captureFrame(buffer, 0, captureTimeMs,
       !apply_rotation ? rotateFrame_ : kVideoRotation_0);
-    captureFrame.set_ntp_time_ms(captureTime);
+    captureFrame.set_ntp_time_ms(Clock::GetRealTimeClock()->CurrentNtpInMilliseconds() - (rtc::TimeMillis() - captureTimeMs));
+
+    forwardToDelegates(frameInfo, spMediaSample, buffer, captureFrame.rotation());
+    VideoFrameTrace::record(traceId, VideoFrameTrace::Stage_CaptureForwarded);
 
-    forwardToDelegates(frameInfo, spMediaSample, buffer);
     OnFrame(captureFrame, captureFrame.width(), captureFrame.height());
+
+    // shared capturers receive the same converted buffer
+    fanout_->OnFrame(captureFrame);
+    VideoFrameTrace::endFrame(traceId, VideoFrameTrace::Stage_CaptureDelivered);
+
+    adaptToLoad(rtc::TimeMicros() - startUs, startUs);
   }
 
   //-----------------------------------------------------------------------------
   void VideoCapturer::forwardToDelegates(
     const cricket::VideoFormat &frameInfo,
     const winrt::com_ptr<IMFSample> &spMediaSample,
-    rtc::scoped_refptr<I420BufferInterface> i420Frame)
+    rtc::scoped_refptr<I420BufferInterface> i420Frame,
+    VideoRotation rotation)
   {
     if (subscriptions_.size() < 1)
       return;
@@ -1163,11 +1167,169 @@ namespace webrtc
       frameInfo.height));
 
     auto wrapperBuffer = UseVideoFrameNativeBuffer::toWrapper(nativeHandleBuffer.get());
-    auto event = UseVideoFrameBufferEvent::toWrapper(wrapperBuffer);
+    auto event = UseVideoFrameBufferEvent::toWrapper(wrapperBuffer, static_cast<int>(rotation));
 
     subscriptions_.delegate()->onVideoFrameReceived(event);
   }
 
+  //-----------------------------------------------------------------------------
+  void VideoCapturer::adaptToLoad(int64_t processingUs, int64_t nowUs)
+  {
+    // a restart is already on its way
+    if (adaptationPending_)
+      return;
+
+    const VideoFormat *format = GetCaptureFormat();
+    if (!format)
+      return;
+
+    auto decision = loadMonitor_->onFrame(
+      processingUs, format->interval / rtc::kNumNanosecsPerMicrosec, nowUs);
+    if (VideoCaptureLoadMonitor::Decision_None == decision)
+      return;
+
+    VideoFormat adapted;
+    if (!selectAdaptedFormat(decision, adapted))
+      return;
+
+    auto queue = UseWebrtcLib::videoFrameProcessingQueue();
+    if (!queue)
+      return;
+
+    // The device cannot be restarted from within its own frame callback.
+    adaptationPending_ = true;
+    auto guard = adaptationGuard_;
+    int generation = startGeneration_;
+    queue->postClosure([guard, adapted, decision, generation]() {
+      std::lock_guard<std::mutex> lock(guard->mutex_);
+      if (!guard->capturer_)
+        return;
+      guard->capturer_->restartAdapted(adapted, decision, generation);
+    });
+  }
+
+  //-----------------------------------------------------------------------------
+  bool VideoCapturer::selectAdaptedFormat(
+    VideoCaptureLoadMonitor::Decision decision,
+    VideoFormat &outFormat)
+  {
+    const VideoFormat *current = GetCaptureFormat();
+    const std::vector<VideoFormat> *formats = GetSupportedFormats();
+    if (!current || !formats)
+      return false;
+
+    auto pixelsOf = [](const VideoFormat &format) {
+      return static_cast<int64_t>(format.width) * abs(format.height);
+    };
+
+    const int64_t currentPixels = pixelsOf(*current);
+    const int64_t maxPixels = pixelsOf(requestedFormat_);
+    const bool down = (VideoCaptureLoadMonitor::Decision_StepDown == decision);
+
+    // Steps go to the next frame size the device supports, never above the
+    // size the application started the capturer with.
+    const VideoFormat *next = nullptr;
+    for (const VideoFormat &format : *formats) {
+      const int64_t pixels = pixelsOf(format);
+      if (down) {
+        if (pixels >= currentPixels)
+          continue;
+        if (next && pixels <= pixelsOf(*next))
+          continue;
+      } else {
+        if (pixels <= currentPixels || pixels > maxPixels)
+          continue;
+        if (next && pixels >= pixelsOf(*next))
+          continue;
+      }
+      next = &format;
+    }
+    if (!next)
+      return false;
+
+    // Keep the requested frame rate and pick the format of that size that
+    // is cheapest to convert.
+    VideoFormat desired(next->width, next->height,
+      requestedFormat_.interval, FOURCC_ANY);
+    if (!selectCaptureFormat(desired, outFormat))
+      return false;
+    return pixelsOf(outFormat) != currentPixels;
+  }
+
+  //-----------------------------------------------------------------------------
+  void VideoCapturer::restartAdapted(
+    const VideoFormat& format,
+    VideoCaptureLoadMonitor::Decision decision,
+    int generation)
+  {
+    VideoFormat previous;
+
+    {
+      rtc::CritScope cs(&apiCs_);
+      adaptationPending_ = false;
+
+      // Stopped, or started again by the application, while queued.
+      if (generation != startGeneration_ ||
+        capture_state() != CS_RUNNING ||
+        !device_->CaptureStarted())
+        return;
+
+      const VideoFormat *current = GetCaptureFormat();
+      if (!current)
+        return;
+      previous = *current;
+
+      // The device is restarted directly rather than through Stop() and
+      // Start() so the capture state stays CS_RUNNING and the track source
+      // fed by this capturer does not end.
+      try {
+        device_->StopCapture();
+      } catch (winrt::hresult_error const& e) {
+        RTC_LOG(LS_ERROR) << "Failed to stop capture for format adaptation. "
+          << rtc::ToUtf8(e.message().c_str());
+        return;
+      }
+    }
+
+    // The stop completes asynchronously and its completion tears down the
+    // media capture, so the device is only started again once it is done.
+    // Waited for without apiCs_ so a frame being delivered can finish.
+    const bool stopped = device_->WaitForStop(5000);
+
+    rtc::CritScope cs(&apiCs_);
+
+    // Stopped or started by the application while the device was stopping.
+    if (generation != startGeneration_ ||
+      capture_state() != CS_RUNNING)
+      return;
+
+    if (!stopped) {
+      RTC_LOG(LS_ERROR) << "Capture did not stop for format adaptation.";
+      SetCaptureState(CS_FAILED);
+      return;
+    }
+
+    if (!startDevice(format)) {
+      RTC_LOG(LS_WARNING) << "Failed to adapt capture format to "
+        << format.ToString() << ", restoring " << previous.ToString();
+      loadMonitor_->reset();
+      if (!startDevice(previous)) {
+        RTC_LOG(LS_ERROR) << "Failed to restore capture format "
+          << previous.ToString();
+        SetCaptureState(CS_FAILED);
+      }
+      return;
+    }
+
+    loadMonitor_->onStepped(decision);
+    RTC_LOG(LS_INFO) << "Capture format "
+      << (VideoCaptureLoadMonitor::Decision_StepDown == decision ? "lowered" : "raised")
+      << " to " << format.ToString() << " for CPU load";
+
+    if (subscriptions_.size() > 0)
+      subscriptions_.delegate()->onCaptureFormatAdapted(UseVideoFormat::toWrapper(format));
+  }
+
   //-----------------------------------------------------------------------------
   void VideoCapturer::OnCaptureDeviceFailed(HRESULT code,
     winrt::hstring const& message) {
@@ -7,6 +7,7 @@
 
 #include <wrapper/impl_org_webRtc_pre_include.h>
 #include "rtc_base/criticalsection.h"
+#include "rtc_base/timestampaligner.h"
 #include "media/base/videocapturer.h"
 #include "system_wrappers/include/event_wrapper.h"
 #include <wrapper/impl_org_webRtc_post_include.h>
@@ -19,10 +20,12 @@
 #include <mfidl.h>
 
 #include <functional>
+#include <mutex>
 #include <vector>
 #include <queue>
 
 #include "impl_webrtc_VideoCaptureMediaSink.h"
+#include "impl_webrtc_VideoFrameTrace.h"
 
 namespace webrtc
 {
@@ -40,6 +43,8 @@ namespace webrtc
     virtual void OnIncomingFrame(uint8_t* video_frame,
       size_t video_frame_length,
       const cricket::VideoFormat& frame_info,
+      int64_t capture_time_us,
+      VideoFrameTrace::FrameId trace_id,
       winrt::com_ptr<IMFSample> spMediaSample) = 0;
     virtual void OnCaptureDeviceFailed(HRESULT code,
       winrt::hstring const& message) = 0;
@@ -65,6 +70,18 @@ namespace webrtc
     IVideoCapturerSubscriptionPtr subscribe(IVideoCapturerDelegatePtr delegate) override;
 
     std::string id() const noexcept override { return id_; }
+    VideoFrameFanoutPtr fanout() const noexcept override { return fanout_; }
+    I420FramePoolPtr framePool() const noexcept override { return framePool_; }
+    VideoCaptureCropPtr crop() const noexcept override { return crop_; }
+    VideoChangeDetectorPtr changeDetector() const noexcept override { return changeDetector_; }
+    VideoCaptureLoadMonitorPtr loadMonitor() const noexcept override { return loadMonitor_; }
+    bool parallelConversion() const noexcept override { return parallelConversion_; }
+    void setParallelConversion(bool enabled) noexcept override { parallelConversion_ = enabled; }
+    bool deferRotation() const noexcept override { return deferRotation_; }
+    void setDeferRotation(bool enabled) noexcept override { deferRotation_ = enabled; }
+    bool selectCaptureFormat(
+      const cricket::VideoFormat &desired,
+      cricket::VideoFormat &outBest) noexcept override;
 
     // Overrides from cricket::VideoCapturer
     virtual cricket::CaptureState Start(const cricket::VideoFormat& capture_format) override;
@@ -77,12 +94,26 @@ namespace webrtc
     void OnDisplayOrientationChanged(
       winrt::Windows::Graphics::Display::DisplayOrientations orientation) override;
 
+  protected:
+    // Overrides from cricket::VideoCapturer
+    void OnSinkWantsChanged(const rtc::VideoSinkWants& wants) override;
+
   private:
+    // Outlives the capturer so restarts queued by load adaptation can tell
+    // the capturer is gone.
+    struct AdaptationGuard
+    {
+      std::mutex mutex_;
+      VideoCapturer *capturer_ {};
+    };
+
     // Overrides from CaptureDeviceListener
     virtual void OnIncomingFrame(
       uint8_t* video_frame,
       size_t video_frame_length,
       const cricket::VideoFormat& frame_info,
+      int64_t capture_time_us,
+      VideoFrameTrace::FrameId trace_id,
       winrt::com_ptr<IMFSample> spMediaSample) override;
 
     virtual void OnCaptureDeviceFailed(HRESULT code,
@@ -94,13 +125,32 @@ namespace webrtc
     void forwardToDelegates(
       const cricket::VideoFormat& frameInfo,
       const winrt::com_ptr<IMFSample> &spMediaSample,
-      rtc::scoped_refptr<I420BufferInterface> i420Frame);
+      rtc::scoped_refptr<I420BufferInterface> i420Frame,
+      VideoRotation rotation);
+
+    bool startDevice(const cricket::VideoFormat& capture_format);
+
+    void adaptToLoad(int64_t processingUs, int64_t nowUs);
+    bool selectAdaptedFormat(
+      VideoCaptureLoadMonitor::Decision decision,
+      cricket::VideoFormat &outFormat);
+    void restartAdapted(
+      const cricket::VideoFormat& format,
+      VideoCaptureLoadMonitor::Decision decision,
+      int generation);
 
   private:
     mutable zsLib::RecursiveLock lock_;
 
     IVideoCapturerDelegateSubscriptions subscriptions_;
     IVideoCapturerSubscriptionPtr defaultSubscription_;
+    VideoFrameFanoutPtr fanout_;
+    I420FramePoolPtr framePool_;
+    VideoCaptureCropPtr crop_;
+    VideoChangeDetectorPtr changeDetector_;
+    VideoCaptureLoadMonitorPtr loadMonitor_;
+    std::shared_ptr<AdaptationGuard> adaptationGuard_;
+    std::unique_ptr<rtc::TimestampAligner> timestampAligner_;
 
     std::string id_;
 
@@ -108,7 +158,13 @@ namespace webrtc
     rtc::CriticalSection apiCs_;
 
     VideoRotation rotateFrame_ { kVideoRotation_0 };
-    bool apply_rotation_ { false };
+    std::atomic_bool apply_rotation_ { false };
+    std::atomic_bool deferRotation_ {};
+    std::atomic_bool parallelConversion_ {};
+
+    cricket::VideoFormat requestedFormat_;    // format passed to Start(), adaptation never steps above it
+    int startGeneration_ {};
+    std::atomic_bool adaptationPending_ {};
 
     winrt::hstring device_id_;
     std::shared_ptr<CaptureDevice> device_;
@@ -0,0 +1,261 @@
+
+#include "impl_webrtc_VideoChangeDetector.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/compare.h"
+#include "libyuv/video_common.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+
+using namespace webrtc;
+
+namespace
+{
+  const uint32_t kHashSeed = 5381;
+}
+
+//-----------------------------------------------------------------------------
+VideoChangeDetector::VideoChangeDetector(const make_private &) noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoChangeDetector::~VideoChangeDetector() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoChangeDetectorPtr VideoChangeDetector::create() noexcept
+{
+  return std::make_shared<VideoChangeDetector>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoChangeDetector::setOptions(const Options &options) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  if (options.enabled_ != options_.enabled_)
+    resetPending_ = true;
+  options_ = options;
+}
+
+//-----------------------------------------------------------------------------
+VideoChangeDetector::Options VideoChangeDetector::options() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return options_;
+}
+
+//-----------------------------------------------------------------------------
+VideoChangeDetector::Stats VideoChangeDetector::stats() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return stats_;
+}
+
+//-----------------------------------------------------------------------------
+void VideoChangeDetector::reset() noexcept
+{
+  rtc::CritScope cs(&cs_);
+  resetPending_ = true;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoChangeDetector::examine(
+                                  const uint8_t *sample,
+                                  const SourceLayout &layout,
+                                  const Rect &crop,
+                                  int64_t nowUs
+                                  ) noexcept
+{
+  Options options;
+  bool reset {};
+
+  {
+    rtc::CritScope cs(&cs_);
+    options = options_;
+    reset = resetPending_;
+    resetPending_ = false;
+  }
+
+  if ((!options.enabled_) || (!sample)) return true;
+
+  const int bytesPerPixel = blockBytesPerPixel(layout.fourcc_);
+  hashBlocks(sample, layout, crop, bytesPerPixel);
+
+  const bool sameGeometry =
+    (!reset) &&
+    (previous_.size() == current_.size()) &&
+    (previousLayout_.fourcc_ == layout.fourcc_) &&
+    (previousLayout_.alignedWidth_ == layout.alignedWidth_) &&
+    (previousLayout_.alignedHeight_ == layout.alignedHeight_) &&
+    (previousCrop_.x_ == crop.x_) &&
+    (previousCrop_.y_ == crop.y_) &&
+    (previousCrop_.width_ == crop.width_) &&
+    (previousCrop_.height_ == crop.height_);
+
+  Rect dirty;
+  if (!sameGeometry) {
+    dirty.width_ = crop.width_;
+    dirty.height_ = crop.height_;
+  } else {
+    int left = columns_;
+    int top = rows_;
+    int right = -1;
+    int bottom = -1;
+    for (int row = 0; row < rows_; ++row) {
+      const uint32_t *previousRow = previous_.data() + (row * columns_);
+      const uint32_t *currentRow = current_.data() + (row * columns_);
+      for (int column = 0; column < columns_; ++column) {
+        if (previousRow[column] == currentRow[column]) continue;
+        left = std::min(left, column);
+        right = std::max(right, column);
+        top = std::min(top, row);
+        bottom = std::max(bottom, row);
+      }
+    }
+
+    if (right >= 0) {
+      if (0 == bytesPerPixel) {
+        // hashed as a whole, any change dirties the entire frame
+        dirty.width_ = crop.width_;
+        dirty.height_ = crop.height_;
+      } else {
+        dirty.x_ = left * kBlockSize;
+        dirty.y_ = top * kBlockSize;
+        dirty.width_ = std::min((right + 1) * kBlockSize, crop.width_) - dirty.x_;
+        dirty.height_ = std::min((bottom + 1) * kBlockSize, crop.height_) - dirty.y_;
+      }
+    }
+  }
+
+  previous_.swap(current_);
+  previousLayout_ = layout;
+  previousCrop_ = crop;
+
+  rtc::CritScope cs(&cs_);
+
+  if ((dirty.width_ > 0) && (dirty.height_ > 0)) {
+    ++stats_.changed_;
+    stats_.dirty_ = dirty;
+    lastEmittedUs_ = nowUs;
+    return true;
+  }
+
+  if (options.keepAliveFramerate_ > 0) {
+    const int64_t intervalUs = static_cast<int64_t>(1000000.0f / options.keepAliveFramerate_);
+    if (nowUs - lastEmittedUs_ >= intervalUs) {
+      ++stats_.keepAlive_;
+      lastEmittedUs_ = nowUs;
+      return true;
+    }
+  }
+
+  ++stats_.unchanged_;
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+int VideoChangeDetector::blockBytesPerPixel(uint32_t fourcc) noexcept
+{
+  // bytes per pixel of the plane hashed block by block, the luma plane for
+  // planar formats whose chroma planes are hashed alongside
+  switch (libyuv::CanonicalFourCC(fourcc)) {
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12:
+    case libyuv::FOURCC_NV12:
+    case libyuv::FOURCC_NV21: return 1;
+    case libyuv::FOURCC_YUY2:
+    case libyuv::FOURCC_UYVY: return 2;
+    case libyuv::FOURCC_24BG:
+    case libyuv::FOURCC_RAW:  return 3;
+    case libyuv::FOURCC_ARGB:
+    case libyuv::FOURCC_BGRA:
+    case libyuv::FOURCC_ABGR:
+    case libyuv::FOURCC_RGBA: return 4;
+    default:                  break;
+  }
+  return 0;
+}
+
+//-----------------------------------------------------------------------------
+void VideoChangeDetector::hashBlocks(
+                                     const uint8_t *sample,
+                                     const SourceLayout &layout,
+                                     const Rect &crop,
+                                     int bytesPerPixel
+                                     ) noexcept
+{
+  if (0 == bytesPerPixel) {
+    columns_ = 1;
+    rows_ = 1;
+    current_.assign(1, libyuv::HashDjb2(sample, layout.length_, kHashSeed));
+    return;
+  }
+
+  columns_ = (crop.width_ + kBlockSize - 1) / kBlockSize;
+  rows_ = (crop.height_ + kBlockSize - 1) / kBlockSize;
+  current_.assign(static_cast<size_t>(columns_) * rows_, kHashSeed);
+
+  const size_t stride = static_cast<size_t>(layout.alignedWidth_) * bytesPerPixel;
+  hashPlane(sample, stride, crop, bytesPerPixel, kBlockSize);
+
+  // a change of colour alone, such as a highlight moving over text, leaves
+  // luma untouched so each block's chroma extends its hash
+  const size_t planeSize = stride * layout.alignedHeight_;
+  const size_t chromaRows = static_cast<size_t>((layout.alignedHeight_ + 1) / 2);
+
+  Rect chromaCrop;
+  chromaCrop.x_ = crop.x_ / 2;
+  chromaCrop.y_ = crop.y_ / 2;
+  chromaCrop.width_ = ((crop.x_ + crop.width_ + 1) / 2) - chromaCrop.x_;
+  chromaCrop.height_ = ((crop.y_ + crop.height_ + 1) / 2) - chromaCrop.y_;
+
+  switch (libyuv::CanonicalFourCC(layout.fourcc_)) {
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12: {
+      const size_t chromaStride = static_cast<size_t>((layout.alignedWidth_ + 1) / 2);
+      const size_t chromaSize = chromaStride * chromaRows;
+      if (layout.length_ < planeSize + (2 * chromaSize)) break;
+      hashPlane(sample + planeSize, chromaStride, chromaCrop, 1, kBlockSize / 2);
+      hashPlane(sample + planeSize + chromaSize, chromaStride, chromaCrop, 1, kBlockSize / 2);
+      break;
+    }
+    case libyuv::FOURCC_NV12:
+    case libyuv::FOURCC_NV21: {
+      // interleaved chroma rows share the luma stride
+      if (layout.length_ < planeSize + (stride * chromaRows)) break;
+      hashPlane(sample + planeSize, stride, chromaCrop, 2, kBlockSize / 2);
+      break;
+    }
+    default: break;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void VideoChangeDetector::hashPlane(
+                                    const uint8_t *plane,
+                                    size_t stride,
+                                    const Rect &area,
+                                    int bytesPerPixel,
+                                    int blockSize
+                                    ) noexcept
+{
+  const size_t blockBytes = static_cast<size_t>(blockSize) * bytesPerPixel;
+  const size_t rowBytes = static_cast<size_t>(area.width_) * bytesPerPixel;
+
+  // rows are walked top to bottom so memory is read sequentially, each row
+  // extending the hash of the blocks it crosses; a subsampled area starting
+  // on an odd pixel can reach one row or column past the last block, which
+  // is folded into it
+  for (int y = 0; y < area.height_; ++y) {
+    const uint8_t *row = plane + ((static_cast<size_t>(area.y_) + y) * stride) + (static_cast<size_t>(area.x_) * bytesPerPixel);
+    uint32_t *hashes = current_.data() + (std::min(y / blockSize, rows_ - 1) * columns_);
+    size_t offset = 0;
+    for (int column = 0; offset < rowBytes; ++column, offset += blockBytes) {
+      uint32_t &hash = hashes[std::min(column, columns_ - 1)];
+      hash = libyuv::HashDjb2(row + offset, std::min(blockBytes, rowBytes - offset), hash);
+    }
+  }
+}
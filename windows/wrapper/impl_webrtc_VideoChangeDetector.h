@@ -0,0 +1,114 @@
+#pragma once
+
+#include "impl_webrtc_VideoFrameConverter.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/criticalsection.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <vector>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoChangeDetector);
+
+  //---------------------------------------------------------------------------
+  // Detects captured frames identical to the previous one, as produced by
+  // mostly static content such as a shared screen or slide deck, so they can
+  // be dropped before any conversion or encoding is done for them.
+  //
+  // The raw sample is compared block by block: every kBlockSize square of
+  // the crop window is hashed, together with the chroma covering it for
+  // planar formats, with libyuv's SIMD accelerated hash and compared
+  // against the hash of the same block in the previous frame. Formats that cannot be addressed by block (MJPG) are
+  // hashed as a whole. Unchanged frames are still emitted at a keep-alive
+  // rate so receivers and encoders see the stream is alive, and the area
+  // covered by changed blocks is kept as a dirty rectangle hint.
+  //
+  // examine() must only be called from the capturing thread; options and
+  // statistics may be accessed from any thread.
+  class VideoChangeDetector
+  {
+  private:
+    struct make_private {};
+
+  public:
+    typedef VideoFrameConverter::Rect Rect;
+    typedef VideoFrameConverter::SourceLayout SourceLayout;
+
+    struct Options
+    {
+      bool enabled_ {};
+      float keepAliveFramerate_ {1};    // rate unchanged frames are still emitted at, 0 for never
+    };
+
+    struct Stats
+    {
+      uint64_t changed_ {};
+      uint64_t unchanged_ {};           // dropped as identical to the previous frame
+      uint64_t keepAlive_ {};           // unchanged frames emitted for the keep-alive rate
+      Rect dirty_;                      // changed area of the last changed frame, relative to the crop window
+    };
+
+    static const int kBlockSize = 32;
+
+  public:
+    VideoChangeDetector(const make_private &) noexcept;
+    ~VideoChangeDetector() noexcept;
+
+    static VideoChangeDetectorPtr create() noexcept;
+
+    void setOptions(const Options &options) noexcept;
+    Options options() const noexcept;
+    Stats stats() const noexcept;
+
+    // Forgets the previous frame so the next one is always emitted, e.g.
+    // when the capture format changes.
+    void reset() noexcept;
+
+    // Returns false when the crop window of the sample is unchanged since
+    // the previous frame and the frame should be dropped.
+    bool examine(
+                 const uint8_t *sample,
+                 const SourceLayout &layout,
+                 const Rect &crop,
+                 int64_t nowUs
+                 ) noexcept;
+
+  private:
+    static int blockBytesPerPixel(uint32_t fourcc) noexcept;
+
+    void hashBlocks(
+                    const uint8_t *sample,
+                    const SourceLayout &layout,
+                    const Rect &crop,
+                    int bytesPerPixel
+                    ) noexcept;
+
+    void hashPlane(
+                   const uint8_t *plane,
+                   size_t stride,
+                   const Rect &area,
+                   int bytesPerPixel,
+                   int blockSize
+                   ) noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    Options options_;
+    Stats stats_;
+    int64_t lastEmittedUs_ {};
+    bool resetPending_ {true};
+
+    // capturing thread only
+    SourceLayout previousLayout_;
+    Rect previousCrop_;
+    int columns_ {};
+    int rows_ {};
+    std::vector<uint32_t> previous_;
+    std::vector<uint32_t> current_;
+  };
+
+} // namespace webrtc
@@ -0,0 +1,241 @@
+
+#include "impl_webrtc_VideoFormatCost.h"
+#include "impl_webrtc_VideoFrameConverter.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/logging.h"
+#include "rtc_base/timeutils.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+using namespace webrtc;
+
+namespace
+{
+  struct FormatCost
+  {
+    uint32_t fourcc_;
+    double costPerPixel_;               // nanoseconds
+  };
+
+  //---------------------------------------------------------------------------
+  // Typical single core costs with SIMD. MJPG is decoded to NV12 by Media
+  // Foundation before it reaches the converter, which cannot be measured
+  // here, so its cost stays an estimate scaled to the measured host.
+  const FormatCost kBuiltInCosts[] =
+  {
+    { cricket::FOURCC_NV12, 0.2 },
+    { cricket::FOURCC_I420, 0.3 },
+    { cricket::FOURCC_YV12, 0.3 },
+    { cricket::FOURCC_NV21, 0.6 },
+    { cricket::FOURCC_YUY2, 0.7 },
+    { cricket::FOURCC_UYVY, 0.7 },
+    { cricket::FOURCC_ARGB, 1.2 },
+    { cricket::FOURCC_24BG, 1.5 },
+    { cricket::FOURCC_MJPG, 6.0 },
+  };
+
+  const int kMeasureIterations = 5;
+
+  //---------------------------------------------------------------------------
+  struct MeasuredCosts
+  {
+    std::mutex mutex_;
+    bool measured_ {};
+    double costPerPixel_[sizeof(kBuiltInCosts) / sizeof(kBuiltInCosts[0])] {};
+  };
+
+  //---------------------------------------------------------------------------
+  MeasuredCosts &measuredCosts() noexcept
+  {
+    static MeasuredCosts costs;
+    return costs;
+  }
+
+  //---------------------------------------------------------------------------
+  size_t sampleLength(
+                      uint32_t fourcc,
+                      int width,
+                      int height
+                      ) noexcept
+  {
+    const size_t pixels = static_cast<size_t>(width) * height;
+    const size_t chroma = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+    switch (cricket::CanonicalFourCC(fourcc)) {
+      case cricket::FOURCC_NV12:
+      case cricket::FOURCC_I420:
+      case cricket::FOURCC_YV12:
+      case cricket::FOURCC_NV21: return pixels + (chroma * 2);
+      case cricket::FOURCC_YUY2:
+      case cricket::FOURCC_UYVY: return static_cast<size_t>((width + 1) / 2) * 4 * height;
+      case cricket::FOURCC_ARGB: return pixels * 4;
+      case cricket::FOURCC_24BG: return pixels * 3;
+      default:                   break;
+    }
+    return 0;
+  }
+
+  //---------------------------------------------------------------------------
+  // Converts a blank sample the way the capturer does and returns the
+  // fastest of a few runs in nanoseconds, or a negative value on failure.
+  int64_t timeConversion(
+                         uint32_t fourcc,
+                         int width,
+                         int height
+                         ) noexcept
+  {
+    std::vector<uint8_t> sample(sampleLength(fourcc, width, height));
+    if (sample.size() < 1) return -1;
+
+    auto layout = VideoFrameConverter::describe(fourcc, width, height, sample.size());
+    VideoFrameConverter::Rect crop;
+    crop.width_ = width;
+    crop.height_ = height;
+
+    auto nv12 = NV12Buffer::create(width, height);
+    auto i420 = I420Buffer::Create(width, height);
+    const bool toNV12 = VideoFrameConverter::canConvertToNV12(fourcc);
+
+    int64_t fastest = -1;
+    for (int iteration = 0; iteration <= kMeasureIterations; ++iteration) {
+      const int64_t start = rtc::TimeNanos();
+      int result = (toNV12 ?
+        VideoFrameConverter::convertToNV12(sample.data(), layout, crop, *nv12) :
+        VideoFrameConverter::convertToI420(sample.data(), layout, crop, kVideoRotation_0, *i420));
+      const int64_t elapsed = rtc::TimeNanos() - start;
+      if (result < 0) return -1;
+
+      // the first run pays for faulting in the buffers
+      if (0 == iteration) continue;
+      if ((fastest < 0) || (elapsed < fastest)) fastest = elapsed;
+    }
+    return fastest;
+  }
+}
+
+//-----------------------------------------------------------------------------
+double VideoFormatCost::costPerPixel(uint32_t fourcc) noexcept
+{
+  const uint32_t canonical = cricket::CanonicalFourCC(fourcc);
+  auto &measured = measuredCosts();
+
+  for (size_t index = 0; index < sizeof(kBuiltInCosts) / sizeof(kBuiltInCosts[0]); ++index) {
+    if (kBuiltInCosts[index].fourcc_ != canonical) continue;
+
+    std::lock_guard<std::mutex> lock(measured.mutex_);
+    return (measured.measured_ ? measured.costPerPixel_[index] : kBuiltInCosts[index].costPerPixel_);
+  }
+  return -1;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFormatCost::measure(
+                              int width,
+                              int height
+                              ) noexcept
+{
+  const size_t count = sizeof(kBuiltInCosts) / sizeof(kBuiltInCosts[0]);
+  const double pixels = static_cast<double>(width) * height;
+  if (pixels < 1) return;
+
+  double costs[count] {};
+  double totalScale = 0;
+  int scaled = 0;
+
+  for (size_t index = 0; index < count; ++index) {
+    int64_t elapsed = timeConversion(kBuiltInCosts[index].fourcc_, width, height);
+    if (elapsed < 0) continue;
+
+    costs[index] = static_cast<double>(elapsed) / pixels;
+    totalScale += costs[index] / kBuiltInCosts[index].costPerPixel_;
+    ++scaled;
+  }
+
+  if (scaled < 1) {
+    RTC_LOG(LS_WARNING) << "Failed to measure the conversion cost of any capture format";
+    return;
+  }
+
+  // formats that could not be timed keep their table cost relative to the
+  // formats that were
+  const double scale = totalScale / scaled;
+  for (size_t index = 0; index < count; ++index) {
+    if (costs[index] > 0) continue;
+    costs[index] = kBuiltInCosts[index].costPerPixel_ * scale;
+  }
+
+  for (size_t index = 0; index < count; ++index) {
+    RTC_LOG(LS_INFO) << "Conversion cost of " << cricket::GetFourccName(kBuiltInCosts[index].fourcc_) << ": " << costs[index] << "ns per pixel";
+  }
+
+  auto &measured = measuredCosts();
+  std::lock_guard<std::mutex> lock(measured.mutex_);
+  std::copy(costs, costs + count, measured.costPerPixel_);
+  measured.measured_ = true;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<uint32_t> VideoFormatCost::preferredFourccs() noexcept
+{
+  std::vector<uint32_t> result;
+  for (auto &entry : kBuiltInCosts) {
+    result.push_back(entry.fourcc_);
+  }
+  std::stable_sort(result.begin(), result.end(), [](uint32_t first, uint32_t second) {
+    return costPerPixel(first) < costPerPixel(second);
+  });
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFormatCost::selectCheapest(
+                                     const std::vector<cricket::VideoFormat> &supported,
+                                     const cricket::VideoFormat &desired,
+                                     cricket::VideoFormat &outBest
+                                     ) noexcept
+{
+  const cricket::VideoFormat *best = nullptr;
+  int64_t bestPixels = 0;
+  double bestCost = 0;
+
+  for (auto &format : supported) {
+    if ((format.width < desired.width) ||
+        (abs(format.height) < abs(desired.height)))
+      continue;
+
+    // allows for devices offering 29.97fps when 30fps is desired
+    if ((desired.interval > 0) &&
+        (format.interval > desired.interval + (desired.interval / 20)))
+      continue;
+
+    if ((cricket::FOURCC_ANY != desired.fourcc) &&
+        (cricket::CanonicalFourCC(format.fourcc) != cricket::CanonicalFourCC(desired.fourcc)))
+      continue;
+
+    const double perPixel = costPerPixel(format.fourcc);
+    if (perPixel < 0) continue;
+
+    // larger frames cost more in every later stage too, so the size closest
+    // to the desired one always wins and cost only decides between formats
+    // of that size
+    const int64_t pixels = static_cast<int64_t>(format.width) * abs(format.height);
+    const double cost = perPixel * static_cast<double>(pixels) * cricket::VideoFormat::IntervalToFpsFloat(format.interval);
+
+    if ((best) &&
+        ((pixels > bestPixels) ||
+         ((pixels == bestPixels) && (cost >= bestCost))))
+      continue;
+
+    best = &format;
+    bestPixels = pixels;
+    bestCost = cost;
+  }
+
+  if (!best) return false;
+
+  outBest = *best;
+  return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "media/base/videocommon.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Ranks captured pixel formats by what they cost to turn into the frames
+  // the capturer emits, and picks capture formats by that cost rather than
+  // by size and rate alone.
+  //
+  // NV12 and I420 samples are only copied or have their chroma interleaved,
+  // packed 4:2:2 formats are repacked, RGB formats go through a colour
+  // matrix and MJPG has to be decoded first. A built-in table gives the
+  // typical cost per pixel of each on SIMD capable hosts; measure() replaces
+  // it with timings of the actual conversions on this host.
+  class VideoFormatCost
+  {
+  public:
+    static const int kMeasureWidth = 640;
+    static const int kMeasureHeight = 480;
+
+  public:
+    // Nanoseconds spent converting one pixel of the format, or a negative
+    // value when the capturer cannot convert the format.
+    static double costPerPixel(uint32_t fourcc) noexcept;
+
+    // Times the conversion of a frame of every uncompressed format the
+    // capturer converts. Blocks for tens of milliseconds; intended to run
+    // once, off the UI thread, before capture formats are selected.
+    static void measure(
+                        int width = kMeasureWidth,
+                        int height = kMeasureHeight
+                        ) noexcept;
+
+    // Formats the capturer converts, cheapest first.
+    static std::vector<uint32_t> preferredFourccs() noexcept;
+
+    // Of the supported formats at least as large and as fast as desired (and
+    // of the desired fourcc unless it is FOURCC_ANY), picks the one with the
+    // fewest pixels, then the cheapest to convert per second. Returns false
+    // when no supported format meets the desired size and rate.
+    static bool selectCheapest(
+                               const std::vector<cricket::VideoFormat> &supported,
+                               const cricket::VideoFormat &desired,
+                               cricket::VideoFormat &outBest
+                               ) noexcept;
+  };
+
+} // namespace webrtc
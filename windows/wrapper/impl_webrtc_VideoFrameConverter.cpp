@@ -0,0 +1,341 @@
+
+#include "impl_webrtc_VideoFrameConverter.h"
+#include "impl_webrtc_VideoWorkerPool.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/convert.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
+#include "libyuv/video_common.h"
+#include "rtc_base/logging.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <atomic>
+#include <cstdlib>
+
+using namespace webrtc;
+
+namespace
+{
+  //---------------------------------------------------------------------------
+  libyuv::RotationMode toRotationMode(VideoRotation rotation) noexcept
+  {
+    switch (rotation) {
+      case kVideoRotation_0:    return libyuv::kRotate0;
+      case kVideoRotation_90:   return libyuv::kRotate90;
+      case kVideoRotation_180:  return libyuv::kRotate180;
+      case kVideoRotation_270:  return libyuv::kRotate270;
+    }
+    return libyuv::kRotate0;
+  }
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameConverter::SourceLayout VideoFrameConverter::describe(
+                                                                uint32_t fourcc,
+                                                                int width,
+                                                                int height,
+                                                                size_t length,
+                                                                int alignment
+                                                                ) noexcept
+{
+  SourceLayout layout;
+  layout.fourcc_ = fourcc;
+  layout.width_ = width;
+  layout.height_ = height;
+  layout.alignedWidth_ = width;
+  layout.alignedHeight_ = height;
+  layout.length_ = length;
+
+  if ((alignment < 2) || (width < 1) || (height < 1)) return layout;
+
+  size_t unpaddedLength = frameLength(fourcc, width, height);
+  if ((0 == unpaddedLength) || (length <= unpaddedLength)) return layout;
+
+  int alignedWidth = ((width + alignment - 1) / alignment) * alignment;
+  int alignedHeight = ((height + alignment - 1) / alignment) * alignment;
+
+  // packed formats only carry the row padding; rows past the visible height
+  // are never read
+  size_t paddedLength = frameLength(fourcc, alignedWidth, alignedHeight);
+  switch (libyuv::CanonicalFourCC(fourcc)) {
+    case libyuv::FOURCC_YUY2:
+    case libyuv::FOURCC_24BG:
+    case libyuv::FOURCC_ARGB: paddedLength = frameLength(fourcc, alignedWidth, height); break;
+    default:                  break;
+  }
+
+  if (length < paddedLength) {
+    RTC_LOG(LS_WARNING) << "Captured sample is larger than the frame but too small to be padded, length: " << length;
+    return layout;
+  }
+
+  layout.alignedWidth_ = alignedWidth;
+  layout.alignedHeight_ = alignedHeight;
+  return layout;
+}
+
+//-----------------------------------------------------------------------------
+int VideoFrameConverter::convertToI420(
+                                       const uint8_t *sample,
+                                       const SourceLayout &layout,
+                                       const Rect &crop,
+                                       VideoRotation rotation,
+                                       I420Buffer &dest,
+                                       bool parallel
+                                       ) noexcept
+{
+  if ((!sample) ||
+      (crop.x_ < 0) ||
+      (crop.y_ < 0) ||
+      (crop.width_ < 1) ||
+      (crop.height_ < 1) ||
+      (crop.x_ + crop.width_ > layout.width_) ||
+      (crop.y_ + crop.height_ > layout.height_)) {
+    RTC_LOG(LS_ERROR) << "Invalid crop window for captured frame";
+    return -1;
+  }
+
+  // the allocated size is presented as the source size and the crop window
+  // selects the visible pixels, which is exactly how the padding is laid out
+  auto convertRows = [&](int sourceRow, int rows, int destRow) {
+    const int destChromaRow = destRow / 2;
+    return libyuv::ConvertToI420(
+      sample, layout.length_,
+      dest.MutableDataY() + (destRow * dest.StrideY()), dest.StrideY(),
+      dest.MutableDataU() + (destChromaRow * dest.StrideU()), dest.StrideU(),
+      dest.MutableDataV() + (destChromaRow * dest.StrideV()), dest.StrideV(),
+      crop.x_, crop.y_ + sourceRow,
+      layout.alignedWidth_, layout.alignedHeight_,
+      crop.width_, rows,
+      toRotationMode(rotation),
+      layout.fourcc_);
+  };
+
+  // bands have to start on even rows of the source as well as the
+  // destination so each one reads and writes whole rows of chroma
+  const bool canBand =
+    (parallel) &&
+    (layout.alignedHeight_ > 0) &&
+    (0 == (crop.y_ % 2)) &&
+    ((kVideoRotation_0 == rotation) ||
+     ((kVideoRotation_180 == rotation) && (0 == (crop.height_ % 2)))) &&
+    (canConvertInBands(layout.fourcc_));
+
+  if (!canBand)
+    return convertRows(0, crop.height_, 0);
+
+  std::atomic<int> result {0};
+  VideoWorkerPool::forEachRowBand(crop.height_, kMinBandRows, true, [&](int firstRow, int rows) {
+    // a 180 degree rotation fills the destination from the bottom of the
+    // source upwards
+    const int sourceRow = (kVideoRotation_180 == rotation ? crop.height_ - firstRow - rows : firstRow);
+    int bandResult = convertRows(sourceRow, rows, firstRow);
+    if (bandResult < 0)
+      result = bandResult;
+  });
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+int VideoFrameConverter::convertToI420(
+                                       const uint8_t *sample,
+                                       const SourceLayout &layout,
+                                       VideoRotation rotation,
+                                       I420Buffer &dest
+                                       ) noexcept
+{
+  Rect crop;
+  crop.width_ = layout.width_;
+  crop.height_ = layout.height_;
+  return convertToI420(sample, layout, crop, rotation, dest);
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameConverter::canConvertToNV12(uint32_t fourcc) noexcept
+{
+  switch (libyuv::CanonicalFourCC(fourcc)) {
+    case libyuv::FOURCC_NV12:
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12: return true;
+    default:                  break;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameConverter::canConvertInBands(uint32_t fourcc) noexcept
+{
+  // formats whose rows can be located directly from a crop offset, which
+  // rules out compressed formats such as MJPG
+  switch (libyuv::CanonicalFourCC(fourcc)) {
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12:
+    case libyuv::FOURCC_NV12:
+    case libyuv::FOURCC_NV21:
+    case libyuv::FOURCC_YUY2:
+    case libyuv::FOURCC_UYVY:
+    case libyuv::FOURCC_24BG:
+    case libyuv::FOURCC_RAW:
+    case libyuv::FOURCC_ARGB:
+    case libyuv::FOURCC_BGRA:
+    case libyuv::FOURCC_ABGR:
+    case libyuv::FOURCC_RGBA: return true;
+    default:                  break;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+int VideoFrameConverter::convertToNV12(
+                                       const uint8_t *sample,
+                                       const SourceLayout &layout,
+                                       const Rect &crop,
+                                       NV12Buffer &dest,
+                                       bool parallel
+                                       ) noexcept
+{
+  if ((!sample) ||
+      (crop.x_ < 0) ||
+      (crop.y_ < 0) ||
+      (0 != (crop.x_ % 2)) ||
+      (0 != (crop.y_ % 2)) ||
+      (crop.width_ < 1) ||
+      (crop.height_ < 1) ||
+      (crop.x_ + crop.width_ > layout.width_) ||
+      (crop.y_ + crop.height_ > layout.height_) ||
+      (dest.width() != crop.width_) ||
+      (dest.height() != crop.height_)) {
+    RTC_LOG(LS_ERROR) << "Invalid crop window for captured NV12 frame";
+    return -1;
+  }
+
+  const int strideY = layout.alignedWidth_;
+  const size_t planeSize = static_cast<size_t>(layout.alignedWidth_) * layout.alignedHeight_;
+  const uint8_t *srcY = sample + (static_cast<size_t>(crop.y_) * strideY) + crop.x_;
+
+  switch (libyuv::CanonicalFourCC(layout.fourcc_)) {
+    case libyuv::FOURCC_NV12: {
+      // interleaved chroma rows of an odd width frame round up to whole pairs
+      const int strideUV = 2 * ((layout.alignedWidth_ + 1) / 2);
+      const uint8_t *srcUV = sample + planeSize + (static_cast<size_t>(crop.y_ / 2) * strideUV) + crop.x_;
+      VideoWorkerPool::forEachRowBand(crop.height_, kMinBandRows, parallel, [&](int firstRow, int rows) {
+        const int chromaRow = firstRow / 2;
+        libyuv::CopyPlane(
+          srcY + (static_cast<size_t>(firstRow) * strideY), strideY,
+          dest.MutableDataY() + (firstRow * dest.StrideY()), dest.StrideY(),
+          crop.width_, rows);
+        libyuv::CopyPlane(
+          srcUV + (static_cast<size_t>(chromaRow) * strideUV), strideUV,
+          dest.MutableDataUV() + (chromaRow * dest.StrideUV()), dest.StrideUV(),
+          2 * ((crop.width_ + 1) / 2), (rows + 1) / 2);
+      });
+      return 0;
+    }
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12: {
+      const int strideChroma = (layout.alignedWidth_ + 1) / 2;
+      const size_t chromaOffset = (static_cast<size_t>(crop.y_ / 2) * strideChroma) + (crop.x_ / 2);
+      const uint8_t *srcFirst = sample + planeSize + chromaOffset;
+      const uint8_t *srcSecond = sample + planeSize + (static_cast<size_t>(strideChroma) * ((layout.alignedHeight_ + 1) / 2)) + chromaOffset;
+      const bool isYV12 = (libyuv::FOURCC_YV12 == libyuv::CanonicalFourCC(layout.fourcc_));
+      const uint8_t *srcU = (isYV12 ? srcSecond : srcFirst);
+      const uint8_t *srcV = (isYV12 ? srcFirst : srcSecond);
+
+      std::atomic<int> result {0};
+      VideoWorkerPool::forEachRowBand(crop.height_, kMinBandRows, parallel, [&](int firstRow, int rows) {
+        const size_t chromaRow = firstRow / 2;
+        int bandResult = libyuv::I420ToNV12(
+          srcY + (static_cast<size_t>(firstRow) * strideY), strideY,
+          srcU + (chromaRow * strideChroma), strideChroma,
+          srcV + (chromaRow * strideChroma), strideChroma,
+          dest.MutableDataY() + (firstRow * dest.StrideY()), dest.StrideY(),
+          dest.MutableDataUV() + (chromaRow * dest.StrideUV()), dest.StrideUV(),
+          crop.width_, rows);
+        if (bandResult < 0)
+          result = bandResult;
+      });
+      return result;
+    }
+    default: break;
+  }
+
+  RTC_LOG(LS_ERROR) << "Captured frame cannot be converted to NV12, fourcc: " << layout.fourcc_;
+  return -1;
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameConverter::SourceLayout VideoFrameConverter::removePadding(
+                                                                     uint8_t *sample,
+                                                                     const SourceLayout &layout
+                                                                     ) noexcept
+{
+  if ((!sample) || (!layout.isPadded())) return layout;
+
+  const int width = layout.width_;
+  const int height = layout.height_;
+  const int alignedWidth = layout.alignedWidth_;
+  const int alignedHeight = layout.alignedHeight_;
+
+  const size_t planeSize = static_cast<size_t>(width) * height;
+  const size_t alignedPlaneSize = static_cast<size_t>(alignedWidth) * alignedHeight;
+
+  // subsampled chroma and packed 4:2:2 pixels round odd sizes up, as
+  // libyuv lays out the frame
+  const int chromaWidth = (width + 1) / 2;
+  const int chromaHeight = (height + 1) / 2;
+  const int alignedChromaWidth = (alignedWidth + 1) / 2;
+  const size_t chromaSize = static_cast<size_t>(chromaWidth) * chromaHeight;
+  const size_t alignedChromaSize = static_cast<size_t>(alignedChromaWidth) * ((alignedHeight + 1) / 2);
+
+  // every destination row starts at or before its source row so copying
+  // front to back never overwrites unread data
+  switch (libyuv::CanonicalFourCC(layout.fourcc_)) {
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12: {
+      libyuv::CopyPlane(sample, alignedWidth, sample, width, width, height);
+      libyuv::CopyPlane(sample + alignedPlaneSize, alignedChromaWidth, sample + planeSize, chromaWidth, chromaWidth, chromaHeight);
+      libyuv::CopyPlane(sample + alignedPlaneSize + alignedChromaSize, alignedChromaWidth, sample + planeSize + chromaSize, chromaWidth, chromaWidth, chromaHeight);
+      break;
+    }
+    case libyuv::FOURCC_NV12: {
+      libyuv::CopyPlane(sample, alignedWidth, sample, width, width, height);
+      libyuv::CopyPlane(sample + alignedPlaneSize, 2 * alignedChromaWidth, sample + planeSize, 2 * chromaWidth, 2 * chromaWidth, chromaHeight);
+      break;
+    }
+    case libyuv::FOURCC_YUY2: libyuv::CopyPlane(sample, 4 * alignedChromaWidth, sample, 4 * chromaWidth, 4 * chromaWidth, height); break;
+    case libyuv::FOURCC_24BG: libyuv::CopyPlane(sample, 3 * alignedWidth, sample, 3 * width, 3 * width, height); break;
+    case libyuv::FOURCC_ARGB: libyuv::CopyPlane(sample, 4 * alignedWidth, sample, 4 * width, 4 * width, height); break;
+    default:                  return layout;
+  }
+
+  SourceLayout result = layout;
+  result.alignedWidth_ = width;
+  result.alignedHeight_ = height;
+  result.length_ = frameLength(layout.fourcc_, width, height);
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+size_t VideoFrameConverter::frameLength(
+                                        uint32_t fourcc,
+                                        int width,
+                                        int height
+                                        ) noexcept
+{
+  const size_t rows = static_cast<size_t>(std::abs(height));
+  const size_t pixels = static_cast<size_t>(width) * rows;
+  const size_t chromaWidth = static_cast<size_t>((width + 1) / 2);
+  const size_t chromaRows = (rows + 1) / 2;
+
+  switch (libyuv::CanonicalFourCC(fourcc)) {
+    case libyuv::FOURCC_I420:
+    case libyuv::FOURCC_YV12:
+    case libyuv::FOURCC_NV12: return pixels + (2 * chromaWidth * chromaRows);
+    case libyuv::FOURCC_YUY2: return 4 * chromaWidth * rows;
+    case libyuv::FOURCC_24BG: return pixels * 3;
+    case libyuv::FOURCC_ARGB: return pixels * 4;
+    default:                  break;
+  }
+  return 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "api/video/video_rotation.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include "impl_webrtc_NV12Buffer.h"
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Converts raw captured samples into I420 buffers in a single pass.
+  //
+  // Capture devices may deliver frames whose rows and planes are padded out
+  // to a 16 pixel boundary. Rather than compacting such frames in place before
+  // converting them, the padded frame is described by its allocated
+  // dimensions and the visible area is read out of it as a crop window, so
+  // padding is skipped by the conversion itself.
+  class VideoFrameConverter
+  {
+  public:
+    static const int kDefaultAlignment = 16;
+
+    struct SourceLayout
+    {
+      uint32_t fourcc_ {};
+      int width_ {};                    // visible pixels per row
+      int height_ {};                   // visible rows
+      int alignedWidth_ {};             // allocated pixels per row (luma stride)
+      int alignedHeight_ {};            // allocated rows per plane (locates the chroma planes)
+      size_t length_ {};                // bytes of sample data
+
+      bool isPadded() const noexcept { return (alignedWidth_ != width_) || (alignedHeight_ != height_); }
+    };
+
+    struct Rect
+    {
+      int x_ {};
+      int y_ {};
+      int width_ {};
+      int height_ {};
+    };
+
+  public:
+    // Describes a sample of the given visible size. When the sample is larger
+    // than an unpadded frame and large enough to hold one padded to the
+    // alignment, the padded layout is assumed for the formats capture devices
+    // are known to pad (I420/IYUV, YV12, NV12, YUY2, 24BG and ARGB).
+    static SourceLayout describe(
+                                 uint32_t fourcc,
+                                 int width,
+                                 int height,
+                                 size_t length,
+                                 int alignment = kDefaultAlignment
+                                 ) noexcept;
+
+    // Converts the crop window (in unrotated source coordinates) of a sample
+    // into the destination, rotating as requested. The destination must be
+    // sized to the rotated crop window. Returns a negative value on failure.
+    //
+    // When parallel is set large frames are converted in bands of rows on
+    // the VideoWorkerPool. Only unrotated and 180 degree rotated conversions
+    // of uncompressed formats are banded; 90 and 270 degree rotations turn
+    // source columns into destination rows, so they and compressed formats
+    // are always converted in a single pass.
+    static int convertToI420(
+                             const uint8_t *sample,
+                             const SourceLayout &layout,
+                             const Rect &crop,
+                             VideoRotation rotation,
+                             I420Buffer &dest,
+                             bool parallel = false
+                             ) noexcept;
+
+    // Convenience for converting the whole visible area of a sample.
+    static int convertToI420(
+                             const uint8_t *sample,
+                             const SourceLayout &layout,
+                             VideoRotation rotation,
+                             I420Buffer &dest
+                             ) noexcept;
+
+    // Returns true if samples of the format can be converted to NV12 by
+    // convertToNV12.
+    static bool canConvertToNV12(uint32_t fourcc) noexcept;
+
+    // Copies the crop window of an NV12 sample, or interleaves the chroma of
+    // an I420/YV12 sample, into an NV12 buffer sized to the crop window.
+    // Rotation is not supported. Returns a negative value on failure. Large
+    // frames are converted in bands of rows when parallel is set.
+    static int convertToNV12(
+                             const uint8_t *sample,
+                             const SourceLayout &layout,
+                             const Rect &crop,
+                             NV12Buffer &dest,
+                             bool parallel = false
+                             ) noexcept;
+
+    // Compacts a padded sample in place so it is laid out as an unpadded
+    // frame, for consumers that read the sample memory directly. Returns the
+    // unpadded layout.
+    static SourceLayout removePadding(
+                                      uint8_t *sample,
+                                      const SourceLayout &layout
+                                      ) noexcept;
+
+  private:
+    static const int kMinBandRows = 270;
+
+    static bool canConvertInBands(uint32_t fourcc) noexcept;
+
+    static size_t frameLength(
+                              uint32_t fourcc,
+                              int width,
+                              int height
+                              ) noexcept;
+  };
+
+} // namespace webrtc
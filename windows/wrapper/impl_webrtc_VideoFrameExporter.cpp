@@ -0,0 +1,231 @@
+
+#include "impl_webrtc_VideoFrameExporter.h"
+#include "impl_webrtc_NV12Buffer.h"
+#include "impl_webrtc_VideoWorkerPool.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/convert_argb.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
+#include "libyuv/scale.h"
+#include "rtc_base/logging.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef int (*I420ToRgbFunction)(
+                                   const uint8_t *srcY, int strideY,
+                                   const uint8_t *srcU, int strideU,
+                                   const uint8_t *srcV, int strideV,
+                                   uint8_t *dst, int dstStride,
+                                   int width, int height);
+
+  //---------------------------------------------------------------------------
+  // libyuv names 32 bit formats by their order within a little endian word,
+  // the reverse of their byte order in memory.
+  I420ToRgbFunction i420ToRgbFunction(VideoFrameExporter::RgbFormat format) noexcept
+  {
+    switch (format)
+    {
+      case VideoFrameExporter::RgbFormat_BGRA:  return libyuv::I420ToARGB;
+      case VideoFrameExporter::RgbFormat_RGBA:  return libyuv::I420ToABGR;
+      case VideoFrameExporter::RgbFormat_ARGB:  return libyuv::I420ToBGRA;
+      case VideoFrameExporter::RgbFormat_ABGR:  return libyuv::I420ToRGBA;
+    }
+    return nullptr;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameExporter::toNV12(
+                                VideoFrameBuffer &source,
+                                const Plane &y,
+                                const Plane &uv,
+                                bool parallel
+                                ) noexcept
+{
+  const int width = source.width();
+  const int height = source.height();
+  const int chromaHeight = (height + 1) / 2;
+
+  if ((!fits(y, width, height)) ||
+      (!fits(uv, ((width + 1) / 2) * 2, chromaHeight))) {
+    RTC_LOG(LS_ERROR) << "NV12 destination planes are too small for a " << width << "x" << height << " frame";
+    return false;
+  }
+
+  auto nv12 = dynamic_cast<NV12Buffer *>(&source);
+  if (nv12) {
+    // already NV12, only the planes need copying
+    VideoWorkerPool::forEachRowBand(height, kMinBandRows, parallel, [&](int firstRow, int rows) {
+      libyuv::CopyPlane(
+        nv12->DataY() + (firstRow * nv12->StrideY()), nv12->StrideY(),
+        y.data_ + (firstRow * y.stride_), y.stride_,
+        width, rows);
+      libyuv::CopyPlane(
+        nv12->DataUV() + ((firstRow / 2) * nv12->StrideUV()), nv12->StrideUV(),
+        uv.data_ + ((firstRow / 2) * uv.stride_), uv.stride_,
+        ((width + 1) / 2) * 2, (rows + 1) / 2);
+    });
+    return true;
+  }
+
+  auto i420 = source.ToI420();
+  if (!i420) {
+    RTC_LOG(LS_ERROR) << "Frame buffer cannot be converted to NV12";
+    return false;
+  }
+
+  VideoWorkerPool::forEachRowBand(height, kMinBandRows, parallel, [&](int firstRow, int rows) {
+    const int chromaRow = firstRow / 2;
+    libyuv::I420ToNV12(
+      i420->DataY() + (firstRow * i420->StrideY()), i420->StrideY(),
+      i420->DataU() + (chromaRow * i420->StrideU()), i420->StrideU(),
+      i420->DataV() + (chromaRow * i420->StrideV()), i420->StrideV(),
+      y.data_ + (firstRow * y.stride_), y.stride_,
+      uv.data_ + (chromaRow * uv.stride_), uv.stride_,
+      width, rows);
+  });
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameExporter::toRgb(
+                               VideoFrameBuffer &source,
+                               const Plane &rgb,
+                               RgbFormat format,
+                               bool parallel
+                               ) noexcept
+{
+  const int width = source.width();
+  const int height = source.height();
+
+  auto convert = i420ToRgbFunction(format);
+  if (!convert) {
+    RTC_LOG(LS_ERROR) << "RGB format not supported: " << static_cast<int>(format);
+    return false;
+  }
+
+  if (!fits(rgb, width * 4, height)) {
+    RTC_LOG(LS_ERROR) << "RGB destination is too small for a " << width << "x" << height << " frame";
+    return false;
+  }
+
+  auto nv12 = dynamic_cast<NV12Buffer *>(&source);
+  if ((nv12) &&
+      ((RgbFormat_BGRA == format) || (RgbFormat_RGBA == format))) {
+    // convert straight from the interleaved chroma rather than splitting it
+    auto nv12Convert = (RgbFormat_BGRA == format ? libyuv::NV12ToARGB : libyuv::NV12ToABGR);
+    VideoWorkerPool::forEachRowBand(height, kMinBandRows, parallel, [&](int firstRow, int rows) {
+      nv12Convert(
+        nv12->DataY() + (firstRow * nv12->StrideY()), nv12->StrideY(),
+        nv12->DataUV() + ((firstRow / 2) * nv12->StrideUV()), nv12->StrideUV(),
+        rgb.data_ + (firstRow * rgb.stride_), rgb.stride_,
+        width, rows);
+    });
+    return true;
+  }
+
+  auto i420 = source.ToI420();
+  if (!i420) {
+    RTC_LOG(LS_ERROR) << "Frame buffer cannot be converted to RGB";
+    return false;
+  }
+
+  VideoWorkerPool::forEachRowBand(height, kMinBandRows, parallel, [&](int firstRow, int rows) {
+    const int chromaRow = firstRow / 2;
+    convert(
+      i420->DataY() + (firstRow * i420->StrideY()), i420->StrideY(),
+      i420->DataU() + (chromaRow * i420->StrideU()), i420->StrideU(),
+      i420->DataV() + (chromaRow * i420->StrideV()), i420->StrideV(),
+      rgb.data_ + (firstRow * rgb.stride_), rgb.stride_,
+      width, rows);
+  });
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameExporter::scaleToI420(
+                                     VideoFrameBuffer &source,
+                                     const Plane &y,
+                                     const Plane &u,
+                                     const Plane &v,
+                                     int width,
+                                     int height,
+                                     bool parallel
+                                     ) noexcept
+{
+  const int chromaWidth = (width + 1) / 2;
+  const int chromaHeight = (height + 1) / 2;
+
+  if ((width < 1) ||
+      (height < 1) ||
+      (!fits(y, width, height)) ||
+      (!fits(u, chromaWidth, chromaHeight)) ||
+      (!fits(v, chromaWidth, chromaHeight))) {
+    RTC_LOG(LS_ERROR) << "I420 destination planes are too small for a " << width << "x" << height << " frame";
+    return false;
+  }
+
+  auto i420 = source.ToI420();
+  if (!i420) {
+    RTC_LOG(LS_ERROR) << "Frame buffer cannot be scaled";
+    return false;
+  }
+
+  const int sourceChromaWidth = i420->ChromaWidth();
+  const int sourceChromaHeight = i420->ChromaHeight();
+
+  auto scaleLuma = [&]() {
+    libyuv::ScalePlane(
+      i420->DataY(), i420->StrideY(), i420->width(), i420->height(),
+      y.data_, y.stride_, width, height,
+      libyuv::kFilterBox);
+  };
+  auto scaleChroma = [&]() {
+    libyuv::ScalePlane(
+      i420->DataU(), i420->StrideU(), sourceChromaWidth, sourceChromaHeight,
+      u.data_, u.stride_, chromaWidth, chromaHeight,
+      libyuv::kFilterBox);
+    libyuv::ScalePlane(
+      i420->DataV(), i420->StrideV(), sourceChromaWidth, sourceChromaHeight,
+      v.data_, v.stride_, chromaWidth, chromaHeight,
+      libyuv::kFilterBox);
+  };
+
+  if ((!parallel) || (height < kMinBandRows)) {
+    scaleLuma();
+    scaleChroma();
+    return true;
+  }
+
+  // filtering reads across rows so the planes are split between threads
+  // rather than bands of rows
+  VideoWorkerPool::forEachTask(2, [&](int index) {
+    if (0 == index)
+      scaleChroma();
+    else
+      scaleLuma();
+  });
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameExporter::fits(
+                              const Plane &plane,
+                              int rowBytes,
+                              int rows
+                              ) noexcept
+{
+  if ((!plane.data_) ||
+      (plane.stride_ < rowBytes))
+    return false;
+  if (rows < 1)
+    return true;
+
+  // the last row only has to hold its own pixels, not a full stride
+  size_t required = (static_cast<size_t>(plane.stride_) * static_cast<size_t>(rows - 1)) + static_cast<size_t>(rowBytes);
+  return plane.size_ >= required;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/video_frame_buffer.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Writes frame buffers out in the formats consumers commonly want (NV12,
+  // 32 bit RGB or a scaled I420 frame) directly into memory owned by the
+  // caller, so no intermediate frame is allocated per conversion.
+  //
+  // I420 and NV12 buffers are read in place; other buffer types have to be
+  // converted to I420 first. Conversions can optionally be split into
+  // bands of rows converted concurrently, which pays off for large (4K)
+  // frames where a single core cannot keep up with the frame rate. The bands
+  // run on the shared VideoWorkerPool.
+  class VideoFrameExporter
+  {
+  public:
+    // Formats are named by their byte order in memory.
+    enum RgbFormat
+    {
+      RgbFormat_First,
+
+      RgbFormat_BGRA = RgbFormat_First,
+      RgbFormat_RGBA,
+      RgbFormat_ARGB,
+      RgbFormat_ABGR,
+
+      RgbFormat_Last = RgbFormat_ABGR,
+    };
+
+    struct Plane
+    {
+      uint8_t *data_ {};
+      int stride_ {};                   // bytes between successive rows
+      size_t size_ {};                  // bytes available at data_
+    };
+
+  public:
+    // Writes the frame as NV12, a Y plane and an interleaved UV plane of the
+    // frame's size.
+    static bool toNV12(
+                       VideoFrameBuffer &source,
+                       const Plane &y,
+                       const Plane &uv,
+                       bool parallel
+                       ) noexcept;
+
+    // Writes the frame as 32 bit RGB with an opaque alpha channel.
+    static bool toRgb(
+                      VideoFrameBuffer &source,
+                      const Plane &rgb,
+                      RgbFormat format,
+                      bool parallel
+                      ) noexcept;
+
+    // Scales the frame into I420 planes of the given size.
+    static bool scaleToI420(
+                            VideoFrameBuffer &source,
+                            const Plane &y,
+                            const Plane &u,
+                            const Plane &v,
+                            int width,
+                            int height,
+                            bool parallel
+                            ) noexcept;
+
+  private:
+    static const int kMinBandRows = 270;
+
+    static bool fits(
+                     const Plane &plane,
+                     int rowBytes,
+                     int rows
+                     ) noexcept;
+  };
+
+} // namespace webrtc
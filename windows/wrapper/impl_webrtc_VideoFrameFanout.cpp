@@ -0,0 +1,202 @@
+
+#include "impl_webrtc_VideoFrameFanout.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/logging.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+VideoFrameFanout::VideoFrameFanout(const make_private &) noexcept :
+  sinks_(std::make_shared<const SinkStateList>())
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameFanout::~VideoFrameFanout()
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameFanoutPtr VideoFrameFanout::create() noexcept
+{
+  return std::make_shared<VideoFrameFanout>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameFanout::addSink(SinkType *sink, const SinkOptions &options) noexcept
+{
+  ZS_ASSERT(sink);
+  if (!sink) return;
+
+  auto state = std::make_shared<SinkState>();
+  state->sink_ = sink;
+  state->options_ = options;
+
+  if ((DropPolicy_None != state->options_.policy_) &&
+      (!state->options_.queue_)) {
+    RTC_LOG(LS_WARNING) << "Video fanout sink has a drop policy but no queue, delivering inline";
+    state->options_.policy_ = DropPolicy_None;
+  }
+
+  SinkStatePtr replaced;
+
+  {
+    rtc::CritScope cs(&cs_);
+
+    auto updated = std::make_shared<SinkStateList>(*sinks_);
+    auto found = std::find_if(updated->begin(), updated->end(), [sink](const SinkStatePtr &existing) { return existing->sink_ == sink; });
+    if (found != updated->end()) {
+      replaced = *found;
+      *found = state;
+    } else {
+      updated->push_back(state);
+    }
+    sinks_ = updated;
+  }
+
+  if (!replaced) return;
+
+  // retire the replaced state as removeSink does so a delivery already
+  // queued with the old options never reaches the sink
+  SinkStats previous;
+
+  {
+    rtc::CritScope cs(&replaced->deliverCs_);
+    rtc::CritScope pendingCs(&replaced->pendingCs_);
+    replaced->removed_ = true;
+    replaced->pending_.reset();
+    previous = replaced->stats_;
+  }
+
+  // keep the existing statistics when only the options change
+  rtc::CritScope pendingCs(&state->pendingCs_);
+  state->stats_.delivered_ += previous.delivered_;
+  state->stats_.dropped_ += previous.dropped_;
+  state->stats_.replaced_ += previous.replaced_;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameFanout::removeSink(SinkType *sink) noexcept
+{
+  SinkStatePtr state;
+
+  {
+    rtc::CritScope cs(&cs_);
+
+    auto updated = std::make_shared<SinkStateList>(*sinks_);
+    auto found = std::find_if(updated->begin(), updated->end(), [sink](const SinkStatePtr &existing) { return existing->sink_ == sink; });
+    if (found == updated->end()) return;
+
+    state = *found;
+    updated->erase(found);
+    sinks_ = updated;
+  }
+
+  // wait for any in-progress delivery so the sink is never called after
+  // removal returns
+  rtc::CritScope cs(&state->deliverCs_);
+  rtc::CritScope pendingCs(&state->pendingCs_);
+  state->removed_ = true;
+  state->pending_.reset();
+}
+
+//-----------------------------------------------------------------------------
+size_t VideoFrameFanout::sinkCount() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return sinks_->size();
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameFanout::sinkStats(SinkType *sink, SinkStats &outStats) const noexcept
+{
+  std::shared_ptr<const SinkStateList> sinks;
+
+  {
+    rtc::CritScope cs(&cs_);
+    sinks = sinks_;
+  }
+
+  for (auto &state : *sinks) {
+    if (state->sink_ != sink) continue;
+    rtc::CritScope cs(&state->pendingCs_);
+    outStats = state->stats_;
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameFanout::OnFrame(const VideoFrame &frame)
+{
+  std::shared_ptr<const SinkStateList> sinks;
+
+  {
+    rtc::CritScope cs(&cs_);
+    sinks = sinks_;
+  }
+
+  for (auto &state : *sinks) {
+    switch (state->options_.policy_) {
+      case DropPolicy_None: {
+        rtc::CritScope cs(&state->deliverCs_);
+        if (state->removed_) break;
+        state->sink_->OnFrame(frame);
+        rtc::CritScope pendingCs(&state->pendingCs_);
+        ++state->stats_.delivered_;
+        break;
+      }
+      case DropPolicy_DropIfBusy:
+      case DropPolicy_LatestOnly: {
+        {
+          rtc::CritScope cs(&state->pendingCs_);
+          if (state->removed_) break;
+          if (state->posted_) {
+            // the queued delivery will pick up whatever frame is pending
+            if (DropPolicy_DropIfBusy == state->options_.policy_) {
+              ++state->stats_.dropped_;
+            } else if (state->pending_) {
+              ++state->stats_.replaced_;
+              *(state->pending_) = frame;
+            } else {
+              state->pending_ = std::make_unique<VideoFrame>(frame);
+            }
+            break;
+          }
+          state->pending_ = std::make_unique<VideoFrame>(frame);
+          state->posted_ = true;
+        }
+
+        auto pendingState = state;
+        state->options_.queue_->postClosure([pendingState]() { deliverPending(pendingState); });
+        break;
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameFanout::deliverPending(SinkStatePtr state) noexcept
+{
+  rtc::CritScope cs(&state->deliverCs_);
+
+  while (true) {
+    std::unique_ptr<VideoFrame> frame;
+
+    {
+      rtc::CritScope pendingCs(&state->pendingCs_);
+      if ((state->removed_) || (!state->pending_)) {
+        state->posted_ = false;
+        return;
+      }
+      frame = std::move(state->pending_);
+      ++state->stats_.delivered_;
+    }
+
+    state->sink_->OnFrame(*frame);
+  }
+}
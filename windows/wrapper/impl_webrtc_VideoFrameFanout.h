@@ -0,0 +1,103 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/video_frame.h"
+#include "api/videosinkinterface.h"
+#include "rtc_base/criticalsection.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+#include <zsLib/IMessageQueue.h>
+
+#include <memory>
+#include <vector>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoFrameFanout);
+
+  //---------------------------------------------------------------------------
+  // Distributes each captured frame to any number of sinks. Every sink
+  // receives the same reference counted buffer, which must be treated as
+  // read-only, so a frame is converted once no matter how many consumers are
+  // attached. Sinks choose how frames are handed to them:
+  //
+  //   DropPolicy_None        - delivered inline on the capture thread
+  //   DropPolicy_DropIfBusy  - delivered on a queue, frames arriving while the
+  //                            previous one is still pending are dropped
+  //   DropPolicy_LatestOnly  - delivered on a queue, a pending frame is
+  //                            replaced by a newer one
+  class VideoFrameFanout : public rtc::VideoSinkInterface<VideoFrame>
+  {
+  public:
+    typedef rtc::VideoSinkInterface<VideoFrame> SinkType;
+
+    enum DropPolicy
+    {
+      DropPolicy_First,
+
+      DropPolicy_None = DropPolicy_First,
+      DropPolicy_DropIfBusy,
+      DropPolicy_LatestOnly,
+
+      DropPolicy_Last = DropPolicy_LatestOnly,
+    };
+
+    struct SinkOptions
+    {
+      DropPolicy policy_ {DropPolicy_None};
+      zsLib::IMessageQueuePtr queue_;   // required unless policy is DropPolicy_None
+    };
+
+    struct SinkStats
+    {
+      uint64_t delivered_ {};
+      uint64_t dropped_ {};             // DropPolicy_DropIfBusy frames skipped
+      uint64_t replaced_ {};            // DropPolicy_LatestOnly frames superseded
+    };
+
+  private:
+    struct make_private {};
+
+    ZS_DECLARE_STRUCT_PTR(SinkState);
+
+    struct SinkState
+    {
+      SinkType *sink_ {};
+      SinkOptions options_;
+
+      rtc::CriticalSection deliverCs_;  // held while calling into the sink
+
+      rtc::CriticalSection pendingCs_;
+      bool removed_ {};
+      bool posted_ {};                  // a delivery is queued or running
+      std::unique_ptr<VideoFrame> pending_;
+      SinkStats stats_;
+    };
+
+    typedef std::vector<SinkStatePtr> SinkStateList;
+
+  public:
+    VideoFrameFanout(const make_private &) noexcept;
+    ~VideoFrameFanout() override;
+
+    static VideoFrameFanoutPtr create() noexcept;
+
+    void addSink(SinkType *sink, const SinkOptions &options) noexcept;
+    void removeSink(SinkType *sink) noexcept;
+
+    size_t sinkCount() const noexcept;
+    bool sinkStats(SinkType *sink, SinkStats &outStats) const noexcept;
+
+    // rtc::VideoSinkInterface<VideoFrame>
+    void OnFrame(const VideoFrame &frame) override;
+
+  private:
+    static void deliverPending(SinkStatePtr state) noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    std::shared_ptr<const SinkStateList> sinks_;  // replaced as a whole, never modified
+  };
+
+} // namespace webrtc
@@ -0,0 +1,152 @@
+
+#include "impl_webrtc_VideoFramePlaneLayout.h"
+#include "impl_webrtc_NV12Buffer.h"
+
+using namespace webrtc;
+
+namespace
+{
+  struct Planar
+  {
+    const PlanarYuvBuffer *yuv_ {};
+    const PlanarYuv8Buffer *yuv8_ {};
+    const PlanarYuv16BBuffer *yuv16_ {};
+    const I420ABufferInterface *i420A_ {};
+    const NV12Buffer *nv12_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  Planar planarOf(const VideoFrameBuffer &buffer) noexcept
+  {
+    Planar result;
+    switch (buffer.type()) {
+      case VideoFrameBuffer::Type::kI420: {
+        auto i420 = buffer.GetI420();
+        result.yuv_ = i420;
+        result.yuv8_ = i420;
+        result.nv12_ = dynamic_cast<const NV12Buffer *>(i420);
+        break;
+      }
+      case VideoFrameBuffer::Type::kI420A: {
+        auto i420A = buffer.GetI420A();
+        result.yuv_ = i420A;
+        result.yuv8_ = i420A;
+        result.i420A_ = i420A;
+        break;
+      }
+      case VideoFrameBuffer::Type::kI444: {
+        auto i444 = buffer.GetI444();
+        result.yuv_ = i444;
+        result.yuv8_ = i444;
+        break;
+      }
+      case VideoFrameBuffer::Type::kI010: {
+        auto i010 = buffer.GetI010();
+        result.yuv_ = i010;
+        result.yuv16_ = i010;
+        break;
+      }
+      default: break;
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  VideoFramePlaneLayout::Span span8(const uint8_t *data, int stride, int rows) noexcept
+  {
+    VideoFramePlaneLayout::Span result;
+    result.data8bit_ = data;
+    result.size_ = static_cast<size_t>(stride) * static_cast<size_t>(rows);
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  VideoFramePlaneLayout::Span span16(const uint16_t *data, int stride, int rows) noexcept
+  {
+    VideoFramePlaneLayout::Span result;
+    result.data16bit_ = data;
+    result.size_ = static_cast<size_t>(stride) * static_cast<size_t>(rows);
+    return result;
+  }
+}
+
+//-----------------------------------------------------------------------------
+VideoFramePlaneLayout::Span VideoFramePlaneLayout::locate(
+                                                          const VideoFrameBuffer &buffer,
+                                                          Planes plane
+                                                          ) noexcept
+{
+  auto planar = planarOf(buffer);
+  if (!planar.yuv_) return Span();
+
+  const int height = planar.yuv_->height();
+  const int chromaHeight = planar.yuv_->ChromaHeight();
+
+  switch (plane) {
+    case Plane_Y: {
+      if (planar.yuv8_) return span8(planar.yuv8_->DataY(), planar.yuv_->StrideY(), height);
+      return span16(planar.yuv16_->DataY(), planar.yuv_->StrideY(), height);
+    }
+    case Plane_U: {
+      if (planar.yuv8_) return span8(planar.yuv8_->DataU(), planar.yuv_->StrideU(), chromaHeight);
+      return span16(planar.yuv16_->DataU(), planar.yuv_->StrideU(), chromaHeight);
+    }
+    case Plane_V: {
+      if (planar.yuv8_) return span8(planar.yuv8_->DataV(), planar.yuv_->StrideV(), chromaHeight);
+      return span16(planar.yuv16_->DataV(), planar.yuv_->StrideV(), chromaHeight);
+    }
+    case Plane_UV: {
+      if (!planar.nv12_) break;
+      return span8(planar.nv12_->DataUV(), planar.nv12_->StrideUV(), chromaHeight);
+    }
+    case Plane_A: {
+      if (!planar.i420A_) break;
+      return span8(planar.i420A_->DataA(), planar.i420A_->StrideA(), height);
+    }
+    case Plane_Total: break;
+  }
+  return Span();
+}
+
+//-----------------------------------------------------------------------------
+size_t VideoFramePlaneLayout::collect(
+                                      const VideoFrameBuffer &buffer,
+                                      Span (&spans)[kMaxPlanes]
+                                      ) noexcept
+{
+  auto planar = planarOf(buffer);
+  if (!planar.yuv_) return 0;
+
+  size_t total {};
+  spans[total++] = locate(buffer, Plane_Y);
+  if (planar.nv12_) {
+    spans[total++] = locate(buffer, Plane_UV);
+  } else {
+    spans[total++] = locate(buffer, Plane_U);
+    spans[total++] = locate(buffer, Plane_V);
+  }
+  if (planar.i420A_)
+    spans[total++] = locate(buffer, Plane_A);
+  return total;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFramePlaneLayout::contiguous(
+                                       const VideoFrameBuffer &buffer,
+                                       Span &outSpan
+                                       ) noexcept
+{
+  Span spans[kMaxPlanes];
+  const size_t total = collect(buffer, spans);
+  if (total < 1) return false;
+
+  size_t byteSize = spans[0].byteSize();
+  for (size_t index = 1; index < total; ++index) {
+    if (spans[index - 1].bytes() + spans[index - 1].byteSize() != spans[index].bytes()) return false;
+    byteSize += spans[index].byteSize();
+  }
+
+  outSpan = spans[0];
+  outSpan.size_ = byteSize / (spans[0].data16bit_ ? sizeof(uint16_t) : sizeof(uint8_t));
+  return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/video_frame_buffer.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Locates the planes of planar YUV frame buffers so they can be handed out
+  // as views without copying. Plane sizes follow each format's own plane
+  // heights: the chroma of I444 is full height like its luma, and the alpha
+  // plane of I420A is full height while its chroma is halved.
+  class VideoFramePlaneLayout
+  {
+  public:
+    enum Planes
+    {
+      Plane_Y,
+      Plane_U,
+      Plane_V,
+      Plane_UV,                         // NV12 buffers only
+      Plane_A,                          // I420A buffers only
+
+      Plane_Total
+    };
+
+    struct Span
+    {
+      const uint8_t *data8bit_ {};
+      const uint16_t *data16bit_ {};
+      size_t size_ {};                  // in samples of the plane's depth
+
+      bool empty() const noexcept { return (!data8bit_) && (!data16bit_); }
+      const uint8_t *bytes() const noexcept { return data16bit_ ? reinterpret_cast<const uint8_t *>(data16bit_) : data8bit_; }
+      size_t byteSize() const noexcept { return size_ * (data16bit_ ? sizeof(uint16_t) : sizeof(uint8_t)); }
+    };
+
+    static const size_t kMaxPlanes = 4;
+
+    // Locates one plane; the span is empty when the buffer has no such
+    // plane. Locating U or V of an NV12 buffer splits its chroma.
+    static Span locate(const VideoFrameBuffer &buffer, Planes plane) noexcept;
+
+    // Locates every plane in frame order: Y, the chroma (interleaved for
+    // NV12, so it is never split), then alpha. Returns how many there are.
+    static size_t collect(const VideoFrameBuffer &buffer, Span (&spans)[kMaxPlanes]) noexcept;
+
+    // Returns the whole frame as one span when its planes follow each other
+    // in memory, as they do for buffers allocated by webrtc.
+    static bool contiguous(const VideoFrameBuffer &buffer, Span &outSpan) noexcept;
+  };
+
+} // namespace webrtc
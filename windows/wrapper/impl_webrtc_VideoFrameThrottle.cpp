@@ -0,0 +1,155 @@
+
+#include "impl_webrtc_VideoFrameThrottle.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "rtc_base/logging.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+VideoFrameThrottle::VideoFrameThrottle(const make_private &) noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameThrottle::~VideoFrameThrottle() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameThrottlePtr VideoFrameThrottle::create() noexcept
+{
+  return std::make_shared<VideoFrameThrottle>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameThrottle::setOptions(const Options &options) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  options_ = options;
+  lastAdmittedUs_ = 0;
+
+  if ((options_.latestFrameOnly_) && (pending_.size() > 1)) {
+    stats_.coalesced_ += pending_.size() - 1;
+    pending_.erase(pending_.begin(), pending_.end() - 1);
+  }
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameThrottle::Options VideoFrameThrottle::options() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return options_;
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameThrottle::Stats VideoFrameThrottle::stats() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  Stats result = stats_;
+  result.pending_ = pending_.size();
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameThrottle::admit(int64_t nowUs) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  if (options_.maxFramerate_ <= 0) return true;
+
+  // allow 10% jitter so a source running at exactly the limit is not halved
+  int64_t interval = static_cast<int64_t>(1000000.0f / options_.maxFramerate_);
+  if ((0 != lastAdmittedUs_) && (nowUs - lastAdmittedUs_ < interval - (interval / 10))) {
+    ++stats_.rateDropped_;
+    return false;
+  }
+
+  lastAdmittedUs_ = nowUs;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoFrameThrottle::offer(
+                               rtc::scoped_refptr<VideoFrameBuffer> buffer,
+                               VideoRotation rotation
+                               ) noexcept
+{
+  rtc::CritScope cs(&cs_);
+
+  if (options_.latestFrameOnly_) {
+    stats_.coalesced_ += pending_.size();
+    pending_.clear();
+  }
+  PendingFrame frame;
+  frame.buffer_ = buffer;
+  frame.rotation_ = rotation;
+  pending_.push_back(frame);
+
+  if ((options_.latestFrameOnly_) && (posted_)) return false;
+
+  posted_ = true;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<VideoFrameBuffer> VideoFrameThrottle::take(VideoRotation *outRotation) noexcept
+{
+  rtc::scoped_refptr<VideoFrameBuffer> buffer;
+  int maxWidth {};
+  int maxHeight {};
+
+  {
+    rtc::CritScope cs(&cs_);
+    if (pending_.size() < 1) {
+      posted_ = false;
+      return buffer;
+    }
+    buffer = pending_.front().buffer_;
+    if (outRotation) *outRotation = pending_.front().rotation_;
+    pending_.pop_front();
+    ++stats_.delivered_;
+
+    maxWidth = options_.maxWidth_;
+    maxHeight = options_.maxHeight_;
+  }
+
+  // scaled outside the lock and only for frames actually consumed
+  return scale(buffer, maxWidth, maxHeight);
+}
+
+//-----------------------------------------------------------------------------
+rtc::scoped_refptr<VideoFrameBuffer> VideoFrameThrottle::scale(
+                                                              rtc::scoped_refptr<VideoFrameBuffer> buffer,
+                                                              int maxWidth,
+                                                              int maxHeight
+                                                              ) const noexcept
+{
+  if (!buffer) return buffer;
+
+  int width = buffer->width();
+  int height = buffer->height();
+  if ((width < 1) || (height < 1)) return buffer;
+
+  double factor = 1.0;
+  if ((maxWidth > 0) && (width > maxWidth)) factor = std::min(factor, static_cast<double>(maxWidth) / width);
+  if ((maxHeight > 0) && (height > maxHeight)) factor = std::min(factor, static_cast<double>(maxHeight) / height);
+  if (factor >= 1.0) return buffer;
+
+  // encoded frames have no pixels to scale
+  if (VideoFrameBuffer::Type::kNative == buffer->type()) return buffer;
+
+  auto source = buffer->ToI420();
+  if (!source) return buffer;
+
+  int scaledWidth = std::max(2, static_cast<int>(width * factor) & ~1);
+  int scaledHeight = std::max(2, static_cast<int>(height * factor) & ~1);
+
+  auto scaled = I420Buffer::Create(scaledWidth, scaledHeight);
+  scaled->ScaleFrom(*source);
+  return scaled;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/video_frame_buffer.h"
+#include "api/video/video_rotation.h"
+#include "rtc_base/criticalsection.h"
+#include "rtc_base/scoped_ref_ptr.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <deque>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoFrameThrottle);
+
+  //---------------------------------------------------------------------------
+  // Limits the frames handed to a slow consumer on another thread. Frames
+  // arriving faster than the maximum frame rate are dropped on the producing
+  // thread before any work is done for them. The remaining frames wait in a
+  // pending list until the consumer takes them; with latestFrameOnly_ the
+  // list holds a single frame and a newer frame replaces (coalesces) one
+  // the consumer has not taken yet, bounding both memory and latency.
+  //
+  // The producer calls admit() then offer() and posts a drain to the
+  // consumer whenever offer() returns true; the drain calls take() until it
+  // returns an empty buffer.
+  class VideoFrameThrottle
+  {
+  private:
+    struct make_private {};
+
+  public:
+    struct Options
+    {
+      float maxFramerate_ {};           // 0 for no limit
+      int maxWidth_ {};                 // 0 for no limit, frames are scaled
+      int maxHeight_ {};                // down to fit keeping their aspect ratio
+      bool latestFrameOnly_ {};
+    };
+
+    struct Stats
+    {
+      uint64_t delivered_ {};
+      uint64_t rateDropped_ {};         // dropped by the frame rate limit
+      uint64_t coalesced_ {};           // replaced by a newer frame before being taken
+      size_t pending_ {};
+    };
+
+  public:
+    VideoFrameThrottle(const make_private &) noexcept;
+    ~VideoFrameThrottle() noexcept;
+
+    static VideoFrameThrottlePtr create() noexcept;
+
+    void setOptions(const Options &options) noexcept;
+    Options options() const noexcept;
+    Stats stats() const noexcept;
+
+    // producer side
+    bool admit(int64_t nowUs) noexcept;
+    bool offer(
+               rtc::scoped_refptr<VideoFrameBuffer> buffer,
+               VideoRotation rotation = kVideoRotation_0
+               ) noexcept;
+
+    // consumer side, the returned buffer is already scaled to fit and the
+    // rotation it was offered with is returned through outRotation
+    rtc::scoped_refptr<VideoFrameBuffer> take(VideoRotation *outRotation = nullptr) noexcept;
+
+  private:
+    struct PendingFrame
+    {
+      rtc::scoped_refptr<VideoFrameBuffer> buffer_;
+      VideoRotation rotation_ {kVideoRotation_0};
+    };
+
+    rtc::scoped_refptr<VideoFrameBuffer> scale(
+                                               rtc::scoped_refptr<VideoFrameBuffer> buffer,
+                                               int maxWidth,
+                                               int maxHeight
+                                               ) const noexcept;
+
+  private:
+    mutable rtc::CriticalSection cs_;
+    Options options_;
+    Stats stats_;
+    int64_t lastAdmittedUs_ {};
+    bool posted_ {};                    // a drain is queued or running
+    std::deque<PendingFrame> pending_;
+  };
+
+} // namespace webrtc
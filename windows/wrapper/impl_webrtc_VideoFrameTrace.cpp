@@ -0,0 +1,170 @@
+
+#include "impl_webrtc_VideoFrameTrace.h"
+#include "impl_webrtc_VideoFrameTraceCollector.h"
+#include "Org.WebRtc.Glue.events.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/timeutils.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <atomic>
+
+namespace wrapper { namespace impl { namespace org { namespace webRtc {
+  ZS_DECLARE_SUBSYSTEM(wrapper_org_webRtc);
+
+  //---------------------------------------------------------------------------
+  static bool isTracingVideoFrames() noexcept
+  {
+    return ZS_EVENTING_IS_LOGGING(Trace);
+  }
+
+  //---------------------------------------------------------------------------
+  static void traceVideoFrameStage(
+                                   uint64_t frameId,
+                                   const char *stage,
+                                   int64_t sincePreviousUs,
+                                   int64_t sinceFirstUs
+                                   ) noexcept
+  {
+    ZS_EVENTING_4(
+      x, i, Trace, VideoFrameTraceStage, glue, Video, Info,
+      size_t, frameId, frameId,
+      string, stage, stage,
+      duration, sincePreviousUs, sincePreviousUs,
+      duration, sinceFirstUs, sinceFirstUs
+    );
+  }
+
+  //---------------------------------------------------------------------------
+  static void traceVideoFrameSummary(
+                                     const char *stage,
+                                     uint64_t count,
+                                     int64_t p50Us,
+                                     int64_t p90Us,
+                                     int64_t p99Us,
+                                     int64_t maxUs
+                                     ) noexcept
+  {
+    ZS_EVENTING_6(
+      x, i, Debug, VideoFrameTraceSummary, glue, Video, Info,
+      string, stage, stage,
+      size_t, count, count,
+      duration, p50Us, p50Us,
+      duration, p90Us, p90Us,
+      duration, p99Us, p99Us,
+      duration, maxUs, maxUs
+    );
+  }
+} } } }
+
+using namespace webrtc;
+
+namespace
+{
+  std::atomic<size_t> gInterval {VideoFrameTrace::kDefaultInterval};
+  std::atomic<uint64_t> gFrameCount {};
+
+  //---------------------------------------------------------------------------
+  VideoFrameTraceCollector &collector() noexcept
+  {
+    static VideoFrameTraceCollector collector(
+      [](VideoFrameTrace::FrameId frameId, VideoFrameTrace::Stage stage, int64_t sincePreviousUs, int64_t sinceFirstUs) {
+        wrapper::impl::org::webRtc::traceVideoFrameStage(frameId, VideoFrameTrace::toString(stage), sincePreviousUs, sinceFirstUs);
+      },
+      [](VideoFrameTrace::Stage stage, const VideoFrameTrace::Histogram &histogram) {
+        wrapper::impl::org::webRtc::traceVideoFrameSummary(
+          VideoFrameTrace::toString(stage),
+          histogram.total_,
+          histogram.percentileUs(0.5),
+          histogram.percentileUs(0.9),
+          histogram.percentileUs(0.99),
+          histogram.maxUs_);
+      });
+    return collector;
+  }
+
+  //---------------------------------------------------------------------------
+  VideoFrameTraceCollector::Ring &threadRing() noexcept
+  {
+    thread_local VideoFrameTraceCollector::RingPtr ring;
+    if (!ring)
+      ring = collector().createRing();
+    return *ring;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTrace::setInterval(size_t interval) noexcept
+{
+  gInterval = interval;
+}
+
+//-----------------------------------------------------------------------------
+size_t VideoFrameTrace::interval() noexcept
+{
+  return gInterval;
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameTrace::FrameId VideoFrameTrace::beginFrame() noexcept
+{
+  const size_t interval = gInterval.load(std::memory_order_relaxed);
+  if (0 == interval) return 0;
+
+  const uint64_t frameId = ++gFrameCount;
+  if (0 != (frameId % interval)) return 0;
+  if (!wrapper::impl::org::webRtc::isTracingVideoFrames()) return 0;
+  return frameId;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTrace::record(
+                             FrameId frameId,
+                             Stage stage
+                             ) noexcept
+{
+  if (0 == frameId) return;
+
+  VideoFrameTraceCollector::record(threadRing(), frameId, stage, rtc::TimeMicros());
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTrace::endFrame(
+                               FrameId frameId,
+                               Stage stage
+                               ) noexcept
+{
+  if (0 == frameId) return;
+
+  record(frameId, stage);
+  collector().collect();
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameTrace::Histogram VideoFrameTrace::histogram(Stage stage) noexcept
+{
+  return collector().histogram(stage);
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTrace::resetHistograms() noexcept
+{
+  collector().resetHistograms();
+}
+
+//-----------------------------------------------------------------------------
+const char *VideoFrameTrace::toString(Stage stage) noexcept
+{
+  switch (stage) {
+    case Stage_CaptureSample:     return "captureSample";
+    case Stage_CaptureConverted:  return "captureConverted";
+    case Stage_CaptureForwarded:  return "captureForwarded";
+    case Stage_CaptureDelivered:  return "captureDelivered";
+    case Stage_RenderReceived:    return "renderReceived";
+    case Stage_RenderQueued:      return "renderQueued";
+    case Stage_RenderDequeued:    return "renderDequeued";
+    case Stage_RenderSampleMade:  return "renderSampleMade";
+    case Stage_RenderResponded:   return "renderResponded";
+  }
+  return "unknown";
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <zsLib/types.h>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Records when sampled video frames pass each stage of the capture and
+  // render pipelines, so the time a frame spends between two stages can be
+  // seen on a trace and summarized as a latency histogram per stage.
+  //
+  // Only every interval()th frame is traced, and only while the
+  // Org.WebRtc.Glue provider is logging at the Trace level; every other
+  // frame is given the id 0 and recording it costs a single branch. Stages
+  // are written to a ring owned by the recording thread without locking.
+  // Whichever thread ends a frame collects the rings of all threads, emits
+  // a VideoFrameTraceStage event per stage of each completed frame and
+  // periodically a VideoFrameTraceSummary event per stage.
+  //
+  // The capture pipeline ends when a frame is handed to the engine; the
+  // engine encodes asynchronously and does not identify frames, so encoding
+  // is not traced.
+  class VideoFrameTrace
+  {
+  public:
+    typedef uint64_t FrameId;           // 0 when a frame is not traced
+
+    enum Stage
+    {
+      Stage_First,
+
+      Stage_CaptureSample = Stage_First,  // sample received from the device
+      Stage_CaptureConverted,             // converted into a frame buffer
+      Stage_CaptureForwarded,             // sample handed to frame buffer delegates
+      Stage_CaptureDelivered,             // frame handed to the engine's sinks
+
+      Stage_RenderReceived,               // frame reached the track
+      Stage_RenderQueued,                 // queued for the media source
+      Stage_RenderDequeued,               // taken from the queue for a sample request
+      Stage_RenderSampleMade,             // turned into a media sample (uncompressed frames only)
+      Stage_RenderResponded,              // media sample handed to the renderer
+
+      Stage_Last = Stage_RenderResponded,
+    };
+
+    static const size_t kDefaultInterval = 30;
+
+    static const int kHistogramBuckets = 16;
+    static const int64_t kFirstBucketUs = 64;   // bucket n counts latencies below kFirstBucketUs << n, the last one all others
+
+    struct Histogram
+    {
+      uint64_t counts_[kHistogramBuckets] {};
+      uint64_t total_ {};
+      int64_t maxUs_ {};
+
+      void add(int64_t latencyUs) noexcept;
+
+      // Upper bound of the bucket holding the given fraction of latencies.
+      int64_t percentileUs(double fraction) const noexcept;
+    };
+
+  public:
+    // Traces every interval'th frame, 0 disables tracing.
+    static void setInterval(size_t interval) noexcept;
+    static size_t interval() noexcept;
+
+    // Returns the id of a new frame, or 0 when the frame is not sampled.
+    static FrameId beginFrame() noexcept;
+
+    static void record(
+                       FrameId frameId,
+                       Stage stage
+                       ) noexcept;
+
+    // Records the last stage of a frame's pipeline and publishes every
+    // frame completed so far.
+    static void endFrame(
+                         FrameId frameId,
+                         Stage stage
+                         ) noexcept;
+
+    // Latencies into the stage from the stage before it in the same frame.
+    // The first stage of each pipeline has no latency.
+    static Histogram histogram(Stage stage) noexcept;
+    static void resetHistograms() noexcept;
+
+    static const char *toString(Stage stage) noexcept;
+  };
+
+} // namespace webrtc
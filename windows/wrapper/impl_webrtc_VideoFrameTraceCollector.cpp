@@ -0,0 +1,182 @@
+
+#include "impl_webrtc_VideoFrameTraceCollector.h"
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+void VideoFrameTrace::Histogram::add(int64_t latencyUs) noexcept
+{
+  int bucket = 0;
+  while ((bucket < kHistogramBuckets - 1) &&
+         (latencyUs >= (kFirstBucketUs << bucket)))
+    ++bucket;
+
+  ++counts_[bucket];
+  ++total_;
+  maxUs_ = std::max(maxUs_, latencyUs);
+}
+
+//-----------------------------------------------------------------------------
+int64_t VideoFrameTrace::Histogram::percentileUs(double fraction) const noexcept
+{
+  if (total_ < 1) return 0;
+
+  const uint64_t wanted = static_cast<uint64_t>(fraction * static_cast<double>(total_));
+  uint64_t counted = 0;
+  for (int bucket = 0; bucket < kHistogramBuckets - 1; ++bucket) {
+    counted += counts_[bucket];
+    if (counted > wanted) return std::min(kFirstBucketUs << bucket, maxUs_);
+  }
+  return maxUs_;
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameTraceCollector::VideoFrameTraceCollector(
+                                                   StageCallback onStage,
+                                                   SummaryCallback onSummary
+                                                   ) noexcept :
+  onStage_(std::move(onStage)),
+  onSummary_(std::move(onSummary))
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameTraceCollector::RingPtr VideoFrameTraceCollector::createRing() noexcept
+{
+  auto ring = std::make_shared<Ring>();
+  std::lock_guard<std::mutex> lock(ringsMutex_);
+  rings_.push_back(ring);
+  return ring;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTraceCollector::record(
+                                      Ring &ring,
+                                      FrameId frameId,
+                                      Stage stage,
+                                      int64_t timeUs
+                                      ) noexcept
+{
+  const uint64_t head = ring.head_.load(std::memory_order_relaxed);
+  auto &record = ring.records_[head % Ring::kSize];
+  record.frameId_.store(frameId, std::memory_order_relaxed);
+  record.stage_.store(stage, std::memory_order_relaxed);
+  record.timeUs_.store(timeUs, std::memory_order_relaxed);
+  ring.head_.store(head + 1, std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTraceCollector::collect() noexcept
+{
+  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) return;
+
+  std::vector<RingPtr> rings;
+  {
+    std::lock_guard<std::mutex> ringsLock(ringsMutex_);
+    rings = rings_;
+  }
+
+  for (auto &ring : rings) {
+    drain(*ring);
+  }
+
+  for (auto iter = frames_.begin(); iter != frames_.end(); ) {
+    auto &frame = iter->second;
+    const bool complete =
+      (0 != frame.timesUs_[VideoFrameTrace::Stage_CaptureDelivered]) ||
+      (0 != frame.timesUs_[VideoFrameTrace::Stage_RenderResponded]);
+    if (!complete) {
+      ++iter;
+      continue;
+    }
+    publish(iter->first, frame);
+    iter = frames_.erase(iter);
+  }
+
+  while (frames_.size() > kMaxPendingFrames) {
+    frames_.erase(frames_.begin());
+  }
+
+  // rings of threads that have exited are released once drained
+  rings.clear();
+  std::lock_guard<std::mutex> ringsLock(ringsMutex_);
+  rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const RingPtr &ring) {
+    return (ring.use_count() < 2) && (ring->tail_ == ring->head_.load(std::memory_order_acquire));
+  }), rings_.end());
+}
+
+//-----------------------------------------------------------------------------
+VideoFrameTraceCollector::Histogram VideoFrameTraceCollector::histogram(Stage stage) const noexcept
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return histograms_[stage];
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTraceCollector::resetHistograms() noexcept
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &histogram : histograms_) {
+    histogram = Histogram{};
+  }
+  completed_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTraceCollector::drain(Ring &ring) noexcept
+{
+  const uint64_t head = ring.head_.load(std::memory_order_acquire);
+  uint64_t index = std::max(ring.tail_, (head > Ring::kSize ? head - Ring::kSize : 0));
+
+  for (; index < head; ++index) {
+    auto &record = ring.records_[index % Ring::kSize];
+    const FrameId frameId = record.frameId_.load(std::memory_order_relaxed);
+    const int stage = record.stage_.load(std::memory_order_relaxed);
+    const int64_t timeUs = record.timeUs_.load(std::memory_order_relaxed);
+
+    // the writer may have lapped the record while it was read
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (ring.head_.load(std::memory_order_relaxed) >= index + Ring::kSize) continue;
+
+    if ((0 == frameId) || (stage < 0) || (stage >= static_cast<int>(kStageCount))) continue;
+    frames_[frameId].timesUs_[stage] = timeUs;
+  }
+  ring.tail_ = head;
+}
+
+//-----------------------------------------------------------------------------
+void VideoFrameTraceCollector::publish(
+                                       FrameId frameId,
+                                       const PendingFrame &frame
+                                       ) noexcept
+{
+  int64_t firstUs = 0;
+  int64_t previousUs = 0;
+
+  for (size_t stage = 0; stage < kStageCount; ++stage) {
+    const int64_t timeUs = frame.timesUs_[stage];
+    if (0 == timeUs) continue;
+
+    if (0 == firstUs) {
+      firstUs = timeUs;
+    } else {
+      histograms_[stage].add(timeUs - previousUs);
+    }
+
+    if (onStage_)
+      onStage_(frameId, static_cast<Stage>(stage), (0 == previousUs ? 0 : timeUs - previousUs), timeUs - firstUs);
+    previousUs = timeUs;
+  }
+
+  if (0 != (++completed_ % kSummaryFrames)) return;
+  if (!onSummary_) return;
+
+  for (size_t stage = 0; stage < kStageCount; ++stage) {
+    auto &histogram = histograms_[stage];
+    if (histogram.total_ < 1) continue;
+    onSummary_(static_cast<Stage>(stage), histogram);
+  }
+}
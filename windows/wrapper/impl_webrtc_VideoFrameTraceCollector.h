@@ -0,0 +1,113 @@
+#pragma once
+
+#include "impl_webrtc_VideoFrameTrace.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // Assembles the stages VideoFrameTrace records on many threads into
+  // frames. Each recording thread writes to a ring of its own without
+  // locking; collecting drains every ring, hands the stages of each
+  // completed frame to the stage callback, adds their latencies to the
+  // per stage histograms and every kSummaryFrames completed frames hands
+  // the histograms to the summary callback.
+  class VideoFrameTraceCollector
+  {
+  public:
+    typedef VideoFrameTrace::FrameId FrameId;
+    typedef VideoFrameTrace::Stage Stage;
+    typedef VideoFrameTrace::Histogram Histogram;
+
+    static const size_t kStageCount = VideoFrameTrace::Stage_Last + 1;
+
+    // frames begun but not completed are forgotten once this many newer ones
+    // are pending, e.g. frames dropped by the render queue
+    static const size_t kMaxPendingFrames = 64;
+
+    // completed frames between summaries
+    static const uint64_t kSummaryFrames = 300;
+
+    struct Record
+    {
+      std::atomic<uint64_t> frameId_ {};
+      std::atomic<int> stage_ {};
+      std::atomic<int64_t> timeUs_ {};
+    };
+
+    //-------------------------------------------------------------------------
+    // Written by its thread only and read by one collector at a time. The
+    // writer never waits; a collector that falls a full ring behind loses the
+    // overwritten records.
+    struct Ring
+    {
+      static const size_t kSize = 256;
+
+      Record records_[kSize];
+      std::atomic<uint64_t> head_ {};
+      uint64_t tail_ {};                // collector only
+    };
+
+    typedef std::shared_ptr<Ring> RingPtr;
+
+    typedef std::function<void(FrameId frameId, Stage stage, int64_t sincePreviousUs, int64_t sinceFirstUs)> StageCallback;
+    typedef std::function<void(Stage stage, const Histogram &histogram)> SummaryCallback;
+
+  public:
+    VideoFrameTraceCollector(
+                             StageCallback onStage,
+                             SummaryCallback onSummary
+                             ) noexcept;
+
+    // Returns a ring for a recording thread. The collector shares ownership
+    // so records outlive their thread until they are collected.
+    RingPtr createRing() noexcept;
+
+    static void record(
+                       Ring &ring,
+                       FrameId frameId,
+                       Stage stage,
+                       int64_t timeUs
+                       ) noexcept;
+
+    // Publishes every frame completed so far, unless another thread is
+    // already collecting and picks the frames up on its next pass.
+    void collect() noexcept;
+
+    Histogram histogram(Stage stage) const noexcept;
+    void resetHistograms() noexcept;
+
+  private:
+    struct PendingFrame
+    {
+      int64_t timesUs_[kStageCount] {};
+    };
+
+    typedef std::map<FrameId, PendingFrame> PendingFrameMap;
+
+    void drain(Ring &ring) noexcept;
+    void publish(
+                 FrameId frameId,
+                 const PendingFrame &frame
+                 ) noexcept;
+
+  private:
+    StageCallback onStage_;
+    SummaryCallback onSummary_;
+
+    std::mutex ringsMutex_;
+    std::vector<RingPtr> rings_;
+
+    mutable std::mutex mutex_;          // one collector at a time
+    PendingFrameMap frames_;
+    Histogram histograms_[kStageCount];
+    uint64_t completed_ {};
+  };
+
+} // namespace webrtc
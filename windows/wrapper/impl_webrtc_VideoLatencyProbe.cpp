@@ -0,0 +1,133 @@
+
+#include "impl_webrtc_VideoLatencyProbe.h"
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "system_wrappers/include/clock.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+VideoLatencyProbe::VideoLatencyProbe(const make_private &) noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoLatencyProbe::~VideoLatencyProbe() noexcept
+{
+}
+
+//-----------------------------------------------------------------------------
+VideoLatencyProbePtr VideoLatencyProbe::create() noexcept
+{
+  return std::make_shared<VideoLatencyProbe>(make_private{});
+}
+
+//-----------------------------------------------------------------------------
+void VideoLatencyProbe::setEnabled(bool enabled) noexcept
+{
+  rtc::CritScope cs(&cs_);
+  if ((enabled) && (!enabled_)) {
+    stats_ = Stats{};
+    pending_.clear();
+    totalDeliveryMs_ = 0;
+    totalRenderMs_ = 0;
+    totalMs_ = 0;
+  }
+  enabled_ = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool VideoLatencyProbe::enabled() const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  return enabled_;
+}
+
+//-----------------------------------------------------------------------------
+VideoLatencyProbe::Stats VideoLatencyProbe::stats(int64_t ntpOffsetMs) const noexcept
+{
+  rtc::CritScope cs(&cs_);
+  Stats result = stats_;
+  if (result.rendered_ > 0)
+    result.lastRendered_.captureTimeMs_ = result.lastRendered_.captureNtpMs_ + ntpOffsetMs;
+  if (result.delivered_ > 0)
+    result.averageDeliveryMs_ = static_cast<double>(totalDeliveryMs_) / result.delivered_;
+  if (result.rendered_ > 0) {
+    result.averageRenderMs_ = static_cast<double>(totalRenderMs_) / result.rendered_;
+    result.averageTotalMs_ = static_cast<double>(totalMs_) / result.rendered_;
+  }
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+void VideoLatencyProbe::onFrameDelivered(
+                                         int64_t captureNtpMs,
+                                         int64_t nowNtpMs
+                                         ) noexcept
+{
+  if (captureNtpMs <= 0) return;
+
+  rtc::CritScope cs(&cs_);
+  if (!enabled_) return;
+
+  // a frame can not arrive before it was captured, clock estimates can
+  // briefly claim otherwise
+  const int64_t deliveryMs = std::max<int64_t>(nowNtpMs - captureNtpMs, 0);
+
+  ++stats_.delivered_;
+  stats_.lastDeliveryMs_ = deliveryMs;
+  totalDeliveryMs_ += deliveryMs;
+
+  if (pending_.size() >= kMaxPending) pending_.pop_front();
+  pending_.push_back(Pending{captureNtpMs, nowNtpMs});
+}
+
+//-----------------------------------------------------------------------------
+void VideoLatencyProbe::onFrameRendered(
+                                        int64_t captureNtpMs,
+                                        int64_t nowNtpMs
+                                        ) noexcept
+{
+  if (captureNtpMs <= 0) return;
+
+  rtc::CritScope cs(&cs_);
+  if (!enabled_) return;
+
+  auto found = std::find_if(pending_.begin(), pending_.end(), [captureNtpMs](const Pending &pending) {
+    return pending.captureNtpMs_ == captureNtpMs;
+  });
+  if (found == pending_.end()) return;
+
+  const int64_t deliveredNtpMs = found->deliveredNtpMs_;
+
+  // frames render in the order they were delivered, so frames ahead of the
+  // rendered one were dropped by the render queue
+  pending_.erase(pending_.begin(), found + 1);
+
+  Frame frame;
+  frame.captureNtpMs_ = captureNtpMs;
+  frame.deliveryMs_ = std::max<int64_t>(deliveredNtpMs - captureNtpMs, 0);
+  frame.renderMs_ = std::max<int64_t>(nowNtpMs - deliveredNtpMs, 0);
+  frame.totalMs_ = frame.deliveryMs_ + frame.renderMs_;
+
+  ++stats_.rendered_;
+  stats_.lastRendered_ = frame;
+  stats_.maxTotalMs_ = std::max(stats_.maxTotalMs_, frame.totalMs_);
+  totalRenderMs_ += frame.renderMs_;
+  totalMs_ += frame.totalMs_;
+}
+
+//-----------------------------------------------------------------------------
+int64_t VideoLatencyProbe::currentNtpMs() noexcept
+{
+  return Clock::GetRealTimeClock()->CurrentNtpInMilliseconds();
+}
+
+//-----------------------------------------------------------------------------
+int64_t VideoLatencyProbe::ntpOffsetMs(int64_t serverNtpMs) noexcept
+{
+  return serverNtpMs - currentNtpMs();
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/criticalsection.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <zsLib/types.h>
+
+#include <deque>
+
+namespace webrtc
+{
+  ZS_DECLARE_CLASS_PTR(VideoLatencyProbe);
+
+  //---------------------------------------------------------------------------
+  // Measures how long video frames take from capture until they are handed
+  // to the renderer, split at the point the frame reaches the track.
+  //
+  // Frames carry the NTP time they were captured at. Captured frames are
+  // stamped with the engine's NTP clock and remote frames with the remote
+  // capture time mapped onto the local NTP clock through the RTCP sender
+  // reports, so both compare directly with the local NTP clock. For a
+  // remote track the delivery stage covers encoding, sending, the network,
+  // the jitter buffer and decoding; the render stage covers the wait in the
+  // render queue. Frames without a capture time (remote frames before the
+  // first sender report) are not measured.
+  //
+  // onFrameDelivered() and onFrameRendered() may be called from different
+  // threads.
+  class VideoLatencyProbe
+  {
+  private:
+    struct make_private {};
+
+  public:
+    struct Frame
+    {
+      int64_t captureNtpMs_ {};         // NTP time of capture on the local clock
+      int64_t captureTimeMs_ {};        // the same on the NTP server's clock
+      int64_t deliveryMs_ {};           // capture until delivered to the track
+      int64_t renderMs_ {};             // delivered until handed to the renderer
+      int64_t totalMs_ {};              // capture until handed to the renderer
+    };
+
+    struct Stats
+    {
+      uint64_t delivered_ {};
+      uint64_t rendered_ {};
+      Frame lastRendered_;
+      int64_t lastDeliveryMs_ {};       // of the most recently delivered frame
+      double averageDeliveryMs_ {};
+      double averageRenderMs_ {};
+      double averageTotalMs_ {};
+      int64_t maxTotalMs_ {};
+    };
+
+    // delivered frames remembered while waiting to be rendered, frames
+    // older than these have been dropped before rendering
+    static const size_t kMaxPending = 64;
+
+  public:
+    VideoLatencyProbe(const make_private &) noexcept;
+    ~VideoLatencyProbe() noexcept;
+
+    static VideoLatencyProbePtr create() noexcept;
+
+    // Measurements restart whenever the probe is enabled.
+    void setEnabled(bool enabled) noexcept;
+    bool enabled() const noexcept;
+
+    // The capture time of the last rendered frame is reported on the NTP
+    // server's clock, ntpOffsetMs ahead of the local one; latencies are
+    // differences on one clock and do not depend on it.
+    Stats stats(int64_t ntpOffsetMs = 0) const noexcept;
+
+    void onFrameDelivered(
+                          int64_t captureNtpMs,
+                          int64_t nowNtpMs
+                          ) noexcept;
+    void onFrameRendered(
+                         int64_t captureNtpMs,
+                         int64_t nowNtpMs
+                         ) noexcept;
+
+    // The local NTP clock the engine stamps frames with.
+    static int64_t currentNtpMs() noexcept;
+
+    // How far the NTP server's clock, read as serverNtpMs, is ahead of the
+    // local one. The engine's clock follows the system clock and cannot be
+    // adjusted, so its timestamps are moved by this offset instead.
+    static int64_t ntpOffsetMs(int64_t serverNtpMs) noexcept;
+
+  private:
+    struct Pending
+    {
+      int64_t captureNtpMs_ {};
+      int64_t deliveredNtpMs_ {};
+    };
+
+    mutable rtc::CriticalSection cs_;
+    bool enabled_ {};
+    Stats stats_;
+    std::deque<Pending> pending_;
+    int64_t totalDeliveryMs_ {};
+    int64_t totalRenderMs_ {};
+    int64_t totalMs_ {};
+  };
+
+} // namespace webrtc
@@ -0,0 +1,134 @@
+
+#include "impl_webrtc_VideoWorkerPool.h"
+
+#include <algorithm>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+VideoWorkerPool::VideoWorkerPool(int workers) noexcept
+{
+  workers_.reserve(workers);
+  for (int index = 0; index < workers; ++index) {
+    workers_.emplace_back([this]() { runWorker(); });
+  }
+}
+
+//-----------------------------------------------------------------------------
+VideoWorkerPool &VideoWorkerPool::instance() noexcept
+{
+  // never destroyed; joining threads while the module unloads can deadlock
+  static VideoWorkerPool *pool = []() {
+    int workers = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+    if (workers > kMaxWorkers) workers = kMaxWorkers;
+    return new VideoWorkerPool(std::max(0, workers));
+  }();
+  return *pool;
+}
+
+//-----------------------------------------------------------------------------
+int VideoWorkerPool::concurrency() noexcept
+{
+  return static_cast<int>(instance().workers_.size()) + 1;
+}
+
+//-----------------------------------------------------------------------------
+void VideoWorkerPool::forEachTask(
+                                  int count,
+                                  const TaskFunction &task
+                                  ) noexcept
+{
+  if (count < 1) return;
+
+  auto &pool = instance();
+  if ((count < 2) || (pool.workers_.size() < 1)) {
+    for (int index = 0; index < count; ++index) {
+      task(index);
+    }
+    return;
+  }
+
+  Batch batch;
+  batch.remaining_ = count - 1;
+
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    for (int index = 1; index < count; ++index) {
+      pool.queue_.push_back(Work{ &batch, &task, index });
+    }
+  }
+  pool.workAvailable_.notify_all();
+
+  task(0);
+
+  std::unique_lock<std::mutex> lock(pool.mutex_);
+  while (batch.remaining_ > 0) {
+    if (pool.queue_.size() > 0) {
+      // help with whatever is queued rather than idle while workers are
+      // busy with other frames
+      Work work = pool.queue_.front();
+      pool.queue_.pop_front();
+      lock.unlock();
+      pool.execute(work);
+      lock.lock();
+      continue;
+    }
+    pool.workDone_.wait(lock);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void VideoWorkerPool::forEachRowBand(
+                                     int height,
+                                     int minBandRows,
+                                     bool parallel,
+                                     const BandFunction &convert
+                                     ) noexcept
+{
+  int bands = 1;
+  if ((parallel) && (minBandRows > 0))
+    bands = std::max(1, std::min(concurrency(), height / minBandRows));
+
+  if (bands < 2) {
+    convert(0, height);
+    return;
+  }
+
+  // bands start on even rows so each one owns whole rows of chroma
+  const int bandRows = (((height + bands - 1) / bands) + 1) & ~1;
+  bands = (height + bandRows - 1) / bandRows;
+
+  forEachTask(bands, [&](int index) {
+    const int firstRow = index * bandRows;
+    convert(firstRow, std::min(bandRows, height - firstRow));
+  });
+}
+
+//-----------------------------------------------------------------------------
+void VideoWorkerPool::runWorker() noexcept
+{
+  while (true) {
+    Work work;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      workAvailable_.wait(lock, [this]() { return queue_.size() > 0; });
+      work = queue_.front();
+      queue_.pop_front();
+    }
+
+    execute(work);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void VideoWorkerPool::execute(const Work &work) noexcept
+{
+  (*work.task_)(work.index_);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --(work.batch_->remaining_);
+  }
+  workDone_.notify_all();
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <zsLib/types.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace webrtc
+{
+  //---------------------------------------------------------------------------
+  // A small process wide pool of threads splitting per-frame pixel work
+  // (colour conversion, rotation and scaling) across cores. The threads are
+  // started once on first use and then wait for work, so a parallel
+  // conversion costs a hand-off rather than a thread creation per frame.
+  //
+  // The calling thread always takes a share of the work itself and helps
+  // drain queued work while it waits, so callers never block on a pool that
+  // is busy with other frames.
+  class VideoWorkerPool
+  {
+  public:
+    typedef std::function<void(int index)> TaskFunction;
+    typedef std::function<void(int firstRow, int rows)> BandFunction;
+
+    static const int kMaxWorkers = 7;
+
+  public:
+    // Total number of threads work can be split across, including the
+    // calling thread.
+    static int concurrency() noexcept;
+
+    // Calls task once for every index below count and returns when all of
+    // them are done. Index 0 runs on the calling thread.
+    static void forEachTask(
+                            int count,
+                            const TaskFunction &task
+                            ) noexcept;
+
+    // Calls convert for consecutive bands of an even number of rows covering
+    // the whole height, concurrently when parallel is set and every band
+    // would have at least minBandRows rows. Returns once every band is done.
+    static void forEachRowBand(
+                               int height,
+                               int minBandRows,
+                               bool parallel,
+                               const BandFunction &convert
+                               ) noexcept;
+
+  private:
+    struct Batch
+    {
+      int remaining_ {};
+    };
+
+    struct Work
+    {
+      Batch *batch_ {};
+      const TaskFunction *task_ {};
+      int index_ {};
+    };
+
+    VideoWorkerPool(int workers) noexcept;
+
+    static VideoWorkerPool &instance() noexcept;
+
+    void runWorker() noexcept;
+    void execute(const Work &work) noexcept;
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workDone_;
+    std::deque<Work> queue_;
+    std::vector<std::thread> workers_;
+  };
+
+} // namespace webrtc
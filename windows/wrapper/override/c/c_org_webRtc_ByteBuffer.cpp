@@ -0,0 +1,148 @@
+
+#ifndef C_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
+
+#include "c_helpers.h"
+#include <zsLib/types.h>
+#include <zsLib/eventing/types.h>
+#include <zsLib/SafeInt.h>
+
+#include "c_org_webRtc_ByteBuffer.h"
+#include "../org_webRtc_ByteBuffer.h"
+
+using namespace wrapper;
+
+//------------------------------------------------------------------------------
+org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperClone(org_webRtc_ByteBuffer_t handle)
+{
+  typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+  typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+  if (0 == handle) return 0;
+  return reinterpret_cast<org_webRtc_ByteBuffer_t>(new WrapperTypePtr(*reinterpret_cast<WrapperTypePtrRawPtr>(handle)));
+}
+
+//------------------------------------------------------------------------------
+void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperDestroy(org_webRtc_ByteBuffer_t handle)
+{
+  typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+  typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+  if (0 == handle) return;
+  delete reinterpret_cast<WrapperTypePtrRawPtr>(handle);
+}
+
+//------------------------------------------------------------------------------
+instance_id_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperInstanceId(org_webRtc_ByteBuffer_t handle)
+{
+  typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+  typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+  if (0 == handle) return 0;
+  return reinterpret_cast<instance_id_t>((*reinterpret_cast<WrapperTypePtrRawPtr>(handle)).get());
+}
+
+//------------------------------------------------------------------------------
+void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperDispose(org_webRtc_ByteBuffer_t handle)
+{
+  typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+  typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+  if (0 == handle) return;
+  (*reinterpret_cast<WrapperTypePtrRawPtr>(handle))->wrapper_dispose();
+}
+
+//------------------------------------------------------------------------------
+org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperCreate_ByteBuffer()
+{
+  auto wrapperThis = wrapper::org::webRtc::ByteBuffer::wrapper_create();
+  wrapperThis->wrapper_init_org_webRtc_ByteBuffer();
+  return wrapper::org_webRtc_ByteBuffer_wrapperToHandle(wrapperThis);
+}
+
+//------------------------------------------------------------------------------
+org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperCreate_ByteBufferWithSize(binary_size_t size)
+{
+  auto wrapperThis = wrapper::org::webRtc::ByteBuffer::wrapper_create();
+  wrapperThis->wrapper_init_org_webRtc_ByteBuffer(SafeInt<size_t>(size));
+  return wrapper::org_webRtc_ByteBuffer_wrapperToHandle(wrapperThis);
+}
+
+//------------------------------------------------------------------------------
+bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_readOnly(org_webRtc_ByteBuffer_t wrapperThisHandle)
+{
+  auto wrapperThis = wrapper::org_webRtc_ByteBuffer_wrapperFromHandle(wrapperThisHandle);
+  return (wrapperThis->get_readOnly());
+}
+
+//------------------------------------------------------------------------------
+binary_size_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_size(org_webRtc_ByteBuffer_t wrapperThisHandle)
+{
+  auto wrapperThis = wrapper::org_webRtc_ByteBuffer_wrapperFromHandle(wrapperThisHandle);
+  return wrapperThis->get_size();
+}
+
+//------------------------------------------------------------------------------
+void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_data(
+  org_webRtc_ByteBuffer_t wrapperThisHandle,
+  uintptr_t buffer,
+  binary_size_t size)
+{
+  auto wrapperThis = wrapper::org_webRtc_ByteBuffer_wrapperFromHandle(wrapperThisHandle);
+
+  auto data = wrapperThis->get_data();
+  auto actualSize = wrapperThis->get_size();
+  size = size > actualSize ? actualSize : size;
+
+  if (!data)
+    return;
+
+  auto ptr = reinterpret_cast<uint8_t *>(buffer);
+  if (!ptr)
+    return;
+
+  memcpy(ptr, data, sizeof(uint8_t)*size);
+}
+
+//------------------------------------------------------------------------------
+void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_set_data(
+  org_webRtc_ByteBuffer_t wrapperThisHandle,
+  uintptr_t buffer,
+  binary_size_t size)
+{
+  auto wrapperThis = wrapper::org_webRtc_ByteBuffer_wrapperFromHandle(wrapperThisHandle);
+
+  auto data = wrapperThis->get_mutableData();
+  auto actualSize = wrapperThis->get_size();
+  size = size > actualSize ? actualSize : size;
+
+  if (!data)
+    return;
+
+  auto ptr = reinterpret_cast<const uint8_t *>(buffer);
+  if (!ptr)
+    return;
+
+  memcpy(data, ptr, sizeof(uint8_t)*size);
+}
+
+namespace wrapper
+{
+  //----------------------------------------------------------------------------
+  org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_wrapperToHandle(wrapper::org::webRtc::ByteBufferPtr value)
+  {
+    typedef org_webRtc_ByteBuffer_t CType;
+    typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+    typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+    if (!value) return 0;
+    return reinterpret_cast<CType>(new WrapperTypePtr(value));
+  }
+
+  //----------------------------------------------------------------------------
+  wrapper::org::webRtc::ByteBufferPtr org_webRtc_ByteBuffer_wrapperFromHandle(org_webRtc_ByteBuffer_t handle)
+  {
+    typedef wrapper::org::webRtc::ByteBufferPtr WrapperTypePtr;
+    typedef WrapperTypePtr * WrapperTypePtrRawPtr;
+    if (0 == handle) return WrapperTypePtr();
+    return (*reinterpret_cast<WrapperTypePtrRawPtr>(handle));
+  }
+
+
+} /* namespace wrapper */
+
+#endif /* ifndef C_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER */
@@ -0,0 +1,48 @@
+
+#ifndef C_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
+
+#pragma once
+
+#include "types.h"
+
+
+ORG_WEBRTC_WRAPPER_C_PLUS_PLUS_BEGIN_GUARD
+
+
+/* org_webRtc_ByteBuffer*/
+
+ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperClone(org_webRtc_ByteBuffer_t handle);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperDestroy(org_webRtc_ByteBuffer_t handle);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API instance_id_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperInstanceId(org_webRtc_ByteBuffer_t handle);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperDispose(org_webRtc_ByteBuffer_t handle);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperCreate_ByteBuffer();
+ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_ByteBuffer_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_wrapperCreate_ByteBufferWithSize(binary_size_t size);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_readOnly(org_webRtc_ByteBuffer_t wrapperThisHandle);
+
+ORG_WEBRTC_WRAPPER_C_EXPORT_API binary_size_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_size(org_webRtc_ByteBuffer_t wrapperThisHandle);
+
+ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_get_data(
+  org_webRtc_ByteBuffer_t wrapperThisHandle,
+  uintptr_t buffer,
+  binary_size_t size);
+
+ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_ByteBuffer_set_data(
+  org_webRtc_ByteBuffer_t wrapperThisHandle,
+  uintptr_t buffer,
+  binary_size_t size);
+
+
+ORG_WEBRTC_WRAPPER_C_PLUS_PLUS_END_GUARD
+
+#ifdef __cplusplus
+
+
+namespace wrapper
+{
+  org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_wrapperToHandle(wrapper::org::webRtc::ByteBufferPtr value);
+  wrapper::org::webRtc::ByteBufferPtr org_webRtc_ByteBuffer_wrapperFromHandle(org_webRtc_ByteBuffer_t handle);
+
+} /* namespace wrapper */
+#endif /* __cplusplus */
+
+#endif /* ifndef C_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER */
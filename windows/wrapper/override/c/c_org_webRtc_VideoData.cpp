@@ -47,6 +47,29 @@ void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperDispose
   (*reinterpret_cast<WrapperTypePtrRawPtr>(handle))->wrapper_dispose();
 }
 
+//------------------------------------------------------------------------------
+org_webRtc_VideoData_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperCreate_VideoData()
+{
+  auto wrapperThis = wrapper::org::webRtc::VideoData::wrapper_create();
+  wrapperThis->wrapper_init_org_webRtc_VideoData();
+  return wrapper::org_webRtc_VideoData_wrapperToHandle(wrapperThis);
+}
+
+//------------------------------------------------------------------------------
+org_webRtc_VideoData_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperCreate_VideoDataWithSize(binary_size_t size)
+{
+  auto wrapperThis = wrapper::org::webRtc::VideoData::wrapper_create();
+  wrapperThis->wrapper_init_org_webRtc_VideoData(SafeInt<size_t>(size));
+  return wrapper::org_webRtc_VideoData_wrapperToHandle(wrapperThis);
+}
+
+//------------------------------------------------------------------------------
+bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_get_readOnly(org_webRtc_VideoData_t wrapperThisHandle)
+{
+  auto wrapperThis = wrapper::org_webRtc_VideoData_wrapperFromHandle(wrapperThisHandle);
+  return (wrapperThis->get_readOnly());
+}
+
 //------------------------------------------------------------------------------
 bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_get_is8BitColorSpace(org_webRtc_VideoData_t wrapperThisHandle)
 {
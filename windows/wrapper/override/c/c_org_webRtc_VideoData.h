@@ -15,6 +15,9 @@ ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_VideoData_t ORG_WEBRTC_WRAPPER_C_CALL
 ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperDestroy(org_webRtc_VideoData_t handle);
 ORG_WEBRTC_WRAPPER_C_EXPORT_API instance_id_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperInstanceId(org_webRtc_VideoData_t handle);
 ORG_WEBRTC_WRAPPER_C_EXPORT_API void ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperDispose(org_webRtc_VideoData_t handle);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_VideoData_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperCreate_VideoData();
+ORG_WEBRTC_WRAPPER_C_EXPORT_API org_webRtc_VideoData_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_wrapperCreate_VideoDataWithSize(binary_size_t size);
+ORG_WEBRTC_WRAPPER_C_EXPORT_API bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_get_readOnly(org_webRtc_VideoData_t wrapperThisHandle);
 ORG_WEBRTC_WRAPPER_C_EXPORT_API bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_get_is8BitColorSpace(org_webRtc_VideoData_t wrapperThisHandle);
 ORG_WEBRTC_WRAPPER_C_EXPORT_API bool_t ORG_WEBRTC_WRAPPER_C_CALLING_CONVENTION org_webRtc_VideoData_get_is16BitColorSpace(org_webRtc_VideoData_t wrapperThisHandle);
 
@@ -0,0 +1,277 @@
+
+#include "pch.h"
+
+#ifndef CPPWINRT_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
+
+#include "cppwinrt_Helpers.h"
+#include "ByteBuffer.h"
+#include "VideoFormat.h"
+#include "RTCRtcpFeedback.h"
+#include "RTCRtpCodecCapability.h"
+#include "RTCRtpContributingSource.h"
+#include "RTCRtpDecodingParameters.h"
+#include "RTCRtpSynchronizationSource.h"
+#include "RTCIceServer.h"
+#include "RTCRtpCodecParameters.h"
+#include "RTCDtlsFingerprint.h"
+#include "Constraint.h"
+#include "RTCRtpHeaderExtensionCapability.h"
+#include "RTCRtpHeaderExtensionParameters.h"
+#include "VideoDeviceInfo.h"
+#include "RTCStatsReport.h"
+#include "RTCCertificate.h"
+#include "RTCSessionDescription.h"
+#include "RTCRtpReceiver.h"
+#include "RTCRtpEncodingParameters.h"
+#include "RTCIceCandidate.h"
+#include "RTCRtpTransceiver.h"
+#include "RTCRtpSender.h"
+
+#include <zsLib/SafeInt.h>
+
+using namespace winrt;
+
+struct __declspec(uuid("5b0d3235-4dba-4d44-865e-8f1d0e4fd04d")) __declspec(novtable) IMemoryBufferByteAccess : ::IUnknown
+{
+  virtual HRESULT __stdcall GetBuffer(uint8_t** value, uint32_t* capacity) = 0;
+};
+
+//------------------------------------------------------------------------------
+winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > Org::WebRtc::implementation::ByteBuffer::ToCppWinrtImpl(wrapper::org::webRtc::ByteBufferPtr value)
+{
+  if (!value) return nullptr;
+  auto result = winrt::make_self<Org::WebRtc::implementation::ByteBuffer>(WrapperCreate{});
+  result->native_ = value;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > Org::WebRtc::implementation::ByteBuffer::ToCppWinrtImpl(Org::WebRtc::ByteBuffer const & value)
+{
+  winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > impl {nullptr};
+  impl.copy_from(winrt::from_abi<Org::WebRtc::implementation::ByteBuffer>(value));
+  return impl;
+}
+
+//------------------------------------------------------------------------------
+winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > Org::WebRtc::implementation::ByteBuffer::ToCppWinrtImpl(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value)
+{
+  return value;
+}
+
+//------------------------------------------------------------------------------
+winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > Org::WebRtc::implementation::ByteBuffer::ToCppWinrtImpl(Org::WebRtc::IByteBuffer const & value)
+{
+  winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > impl {nullptr};
+  impl.copy_from(winrt::from_abi<Org::WebRtc::implementation::ByteBuffer>(value));
+  return impl;
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::ByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrt(wrapper::org::webRtc::ByteBufferPtr value)
+{
+  auto result = ToCppWinrtImpl(value);
+  if (!result) return Org::WebRtc::ByteBuffer {nullptr};
+  return result.as< Org::WebRtc::ByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::ByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrt(Org::WebRtc::ByteBuffer const & value)
+{
+  return value;
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::ByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrt(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value)
+{
+  if (!value) return Org::WebRtc::ByteBuffer {nullptr};
+  return value.as< Org::WebRtc::ByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::ByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrt(Org::WebRtc::IByteBuffer const & value)
+{
+  if (!value) return Org::WebRtc::ByteBuffer {nullptr};
+  return value.as< Org::WebRtc::ByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::IByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrtInterface(wrapper::org::webRtc::ByteBufferPtr value)
+{
+  auto result = ToCppWinrtImpl(value);
+  if (!result) return Org::WebRtc::IByteBuffer {nullptr};
+  return result.as< Org::WebRtc::IByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::IByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrtInterface(Org::WebRtc::ByteBuffer const & value)
+{
+  if (!value) return Org::WebRtc::IByteBuffer {nullptr};
+  return value.as< Org::WebRtc::IByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::IByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrtInterface(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value)
+{
+  if (!value) return Org::WebRtc::IByteBuffer {nullptr};
+  return value.as< Org::WebRtc::IByteBuffer >();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::IByteBuffer Org::WebRtc::implementation::ByteBuffer::ToCppWinrtInterface(Org::WebRtc::IByteBuffer const & value)
+{
+  return value;
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr Org::WebRtc::implementation::ByteBuffer::FromCppWinrt(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value)
+{
+  if (!value) return wrapper::org::webRtc::ByteBufferPtr();
+  return value->native_;
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr Org::WebRtc::implementation::ByteBuffer::FromCppWinrt(Org::WebRtc::ByteBuffer const & value)
+{
+  return FromCppWinrt(ToCppWinrtImpl(value));
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr Org::WebRtc::implementation::ByteBuffer::FromCppWinrt(wrapper::org::webRtc::ByteBufferPtr value)
+{
+  return value;
+}
+
+//------------------------------------------------------------------------------
+wrapper::org::webRtc::ByteBufferPtr Org::WebRtc::implementation::ByteBuffer::FromCppWinrt(Org::WebRtc::IByteBuffer const & value)
+{
+  return FromCppWinrt(ToCppWinrtImpl(value));
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::ByteBuffer Org::WebRtc::implementation::ByteBuffer::Cast(Org::WebRtc::IByteBuffer const & value)
+{
+  if (!value) return nullptr;
+  auto nativeObject = ::Internal::Helper::FromCppWinrt_Org_WebRtc_ByteBuffer(value);  
+  if (!nativeObject) return nullptr;
+  auto result = std::dynamic_pointer_cast< wrapper::org::webRtc::ByteBuffer >(nativeObject);
+  if (!result) return nullptr;
+  return ToCppWinrt(result);
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::implementation::ByteBuffer::ByteBuffer()
+ : native_(wrapper::org::webRtc::ByteBuffer::wrapper_create())
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  native_->wrapper_init_org_webRtc_ByteBuffer();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::implementation::ByteBuffer::ByteBuffer(uint64_t size)
+ : native_(wrapper::org::webRtc::ByteBuffer::wrapper_create())
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  native_->wrapper_init_org_webRtc_ByteBuffer(SafeInt<size_t>(size));
+}
+
+//------------------------------------------------------------------------------
+void Org::WebRtc::implementation::ByteBuffer::Close()
+{
+  if (native_) native_->wrapper_dispose();
+  native_.reset();
+}
+
+//------------------------------------------------------------------------------
+bool Org::WebRtc::implementation::ByteBuffer::ReadOnly()
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  return ::Internal::Helper::ToCppWinrt_Bool(native_->get_readOnly());
+}
+
+//------------------------------------------------------------------------------
+uint64_t Org::WebRtc::implementation::ByteBuffer::Length()
+{
+  if (!native_)
+    return 0;
+
+  return SafeInt<uint64_t>(native_->get_size());
+}
+
+//------------------------------------------------------------------------------
+uint64_t Org::WebRtc::implementation::ByteBuffer::GetData(array_view<uint8_t> values)
+{
+  if (!native_)
+    return 0;
+
+  uint64_t inSize = SafeInt<decltype(inSize)>(values.size());
+
+  uint64_t size = native_->get_size();
+
+  size = inSize < size ? inSize : size;
+
+  auto dest = values.data();
+  auto source = native_->get_data();
+
+  if ((!dest) ||
+      (!source))
+    return 0;
+
+  memcpy(dest, source, SafeInt<size_t>(sizeof(uint8_t) * size));
+
+  return size;
+}
+
+//------------------------------------------------------------------------------
+uint64_t Org::WebRtc::implementation::ByteBuffer::SetData(array_view<uint8_t const> values)
+{
+  if (!native_)
+    return 0;
+
+  uint64_t inSize = SafeInt<decltype(inSize)>(values.size());
+
+  uint64_t size = native_->get_size();
+
+  size = inSize < size ? inSize : size;
+
+  auto source = values.data();
+  auto dest = native_->get_mutableData();
+
+  if ((!dest) ||
+      (!source))
+    return 0;
+
+  memcpy(dest, source, SafeInt<size_t>(sizeof(uint8_t) * size));
+
+  return size;
+}
+
+//------------------------------------------------------------------------------
+winrt::Windows::Foundation::IMemoryBuffer Org::WebRtc::implementation::ByteBuffer::Data()
+{
+  if (!native_)
+    return {nullptr};
+
+  Windows::Foundation::MemoryBuffer memBuffer{ static_cast<uint32_t>(sizeof(uint8_t)*native_->get_size()) };
+
+  auto ref = memBuffer.CreateReference();
+
+  auto byteAccess = ref.as<IMemoryBufferByteAccess>();
+  if (!byteAccess)
+    return {nullptr};
+
+  uint8_t* dest{};
+  uint32_t destSize {};
+  if (FAILED(byteAccess->GetBuffer(&dest, &destSize)))
+    return {nullptr};
+
+  if (destSize != (sizeof(uint8_t)*native_->get_size()))
+    return {nullptr};
+
+  if (destSize > 0)
+    memcpy(dest, native_->get_data(), destSize);
+
+  return memBuffer;
+}
+
+#endif //ifndef CPPWINRT_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
@@ -0,0 +1,96 @@
+
+#pragma once
+
+
+#ifndef CPPWINRT_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
+
+#include "types.h"
+
+#include "ByteBuffer.g.h"
+#include <wrapper/generated/org_webRtc_ByteBuffer.h>
+
+namespace winrt {
+  namespace Org {
+    namespace WebRtc {
+      namespace implementation {
+
+
+        struct ByteBuffer : ByteBufferT<ByteBuffer>
+        {
+          // internal
+          wrapper::org::webRtc::ByteBufferPtr native_;
+
+          struct WrapperCreate {};
+          ByteBuffer(const WrapperCreate &) {}
+
+          // ToCppWinrtImpl
+          static winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > ToCppWinrtImpl(wrapper::org::webRtc::ByteBufferPtr value);
+          static winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > ToCppWinrtImpl(Org::WebRtc::ByteBuffer const & value);
+          static winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > ToCppWinrtImpl(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value);
+          static winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > ToCppWinrtImpl(Org::WebRtc::IByteBuffer const & value);
+
+          // ToCppWinrt
+          static Org::WebRtc::ByteBuffer ToCppWinrt(wrapper::org::webRtc::ByteBufferPtr value);
+          static Org::WebRtc::ByteBuffer ToCppWinrt(Org::WebRtc::ByteBuffer const & value);
+          static Org::WebRtc::ByteBuffer ToCppWinrt(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value);
+          static Org::WebRtc::ByteBuffer ToCppWinrt(Org::WebRtc::IByteBuffer const & value);
+
+          // ToCppWinrtInterface
+          static Org::WebRtc::IByteBuffer ToCppWinrtInterface(wrapper::org::webRtc::ByteBufferPtr value);
+          static Org::WebRtc::IByteBuffer ToCppWinrtInterface(Org::WebRtc::ByteBuffer const & value);
+          static Org::WebRtc::IByteBuffer ToCppWinrtInterface(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value);
+          static Org::WebRtc::IByteBuffer ToCppWinrtInterface(Org::WebRtc::IByteBuffer const & value);
+
+          // FromCppWinrt
+          static wrapper::org::webRtc::ByteBufferPtr FromCppWinrt(wrapper::org::webRtc::ByteBufferPtr value);
+          static wrapper::org::webRtc::ByteBufferPtr FromCppWinrt(winrt::com_ptr< Org::WebRtc::implementation::ByteBuffer > const & value);
+          static wrapper::org::webRtc::ByteBufferPtr FromCppWinrt(Org::WebRtc::ByteBuffer const & value);
+          static wrapper::org::webRtc::ByteBufferPtr FromCppWinrt(Org::WebRtc::IByteBuffer const & value);
+
+        public:
+          /// <summary>
+          /// Cast from Org::WebRtc::IByteBuffer to ByteBuffer
+          /// </summary>
+          static Org::WebRtc::ByteBuffer Cast(Org::WebRtc::IByteBuffer const & value);
+
+          // ::org::webRtc::ByteBuffer
+
+          /// <summary>
+          /// Constructs a new empty byte buffer.
+          /// </summary>
+          ByteBuffer();
+
+          /// <summary>
+          /// Constructs a writable byte buffer of the given size.
+          /// </summary>
+          ByteBuffer(uint64_t size);
+
+          // Windows.Foundation.IClosable
+          void Close();
+
+          bool ReadOnly();
+
+          uint64_t Length();
+          uint64_t GetData(array_view<uint8_t> values);
+          uint64_t SetData(array_view<uint8_t const> values);
+
+          /// <summary>
+          /// Gets a copy of the bytes of the buffer.
+          /// </summary>
+          Windows::Foundation::IMemoryBuffer Data();
+        };
+
+      } // namespace implementation
+
+      namespace factory_implementation {
+
+        struct ByteBuffer : ByteBufferT<ByteBuffer, implementation::ByteBuffer>
+        {
+        };
+
+      } // namespace factory_implementation
+
+    } // namespace WebRtc
+  } // namespace Org
+} // namespace winrt
+#endif //ifndef CPPWINRT_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
@@ -159,6 +159,22 @@ Org::WebRtc::VideoData Org::WebRtc::implementation::VideoData::Cast(Org::WebRtc:
   return ToCppWinrt(result);
 }
 
+//------------------------------------------------------------------------------
+Org::WebRtc::implementation::VideoData::VideoData()
+ : native_(wrapper::org::webRtc::VideoData::wrapper_create())
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  native_->wrapper_init_org_webRtc_VideoData();
+}
+
+//------------------------------------------------------------------------------
+Org::WebRtc::implementation::VideoData::VideoData(uint64_t size)
+ : native_(wrapper::org::webRtc::VideoData::wrapper_create())
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  native_->wrapper_init_org_webRtc_VideoData(SafeInt<size_t>(size));
+}
+
 //------------------------------------------------------------------------------
 void Org::WebRtc::implementation::VideoData::Close()
 {
@@ -166,6 +182,13 @@ void Org::WebRtc::implementation::VideoData::Close()
   native_.reset();
 }
 
+//------------------------------------------------------------------------------
+bool Org::WebRtc::implementation::VideoData::ReadOnly()
+{
+  if (!native_) {throw hresult_error(E_POINTER);}
+  return ::Internal::Helper::ToCppWinrt_Bool(native_->get_readOnly());
+}
+
 //------------------------------------------------------------------------------
 bool Org::WebRtc::implementation::VideoData::Is8BitColorSpace()
 {
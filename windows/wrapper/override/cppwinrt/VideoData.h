@@ -53,9 +53,22 @@ namespace winrt {
           /// </summary>
           static Org::WebRtc::VideoData Cast(Org::WebRtc::IVideoData const & value);
 
+          // ::org::webRtc::VideoData
+
+          /// <summary>
+          /// Constructs a new empty video data object.
+          /// </summary>
+          VideoData();
+
+          /// <summary>
+          /// Constructs a writable 8 bit video data object of the given size.
+          /// </summary>
+          VideoData(uint64_t size);
+
           // Windows.Foundation.IClosable
           void Close();
 
+          bool ReadOnly();
           bool Is8BitColorSpace();
           bool Is16BitColorSpace();
 
@@ -50,6 +50,7 @@ using std_list_uint16_t_t = System.IntPtr;
 using uint16_t = System.UInt16;
 
 using org_webRtc_AudioData_t = System.IntPtr;
+using org_webRtc_ByteBuffer_t = System.IntPtr;
 using org_webRtc_EventQueue_t = System.IntPtr;
 using org_webRtc_MediaElement_t = System.IntPtr;
 using org_webRtc_MediaSample_t = System.IntPtr;
@@ -127,6 +128,55 @@ namespace Wrapper
             #endregion // Org.WebRtc.AudioData
 
 
+            #region Org.WebRtc.ByteBuffer
+
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+            // Org.WebRtc.ByteBuffer
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_wrapperClone(org_webRtc_ByteBuffer_t handle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static void org_webRtc_ByteBuffer_wrapperDestroy(org_webRtc_ByteBuffer_t handle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static void org_webRtc_ByteBuffer_wrapperDispose(org_webRtc_ByteBuffer_t handle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static instance_id_t org_webRtc_ByteBuffer_wrapperInstanceId(org_webRtc_ByteBuffer_t handle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_wrapperCreate_ByteBuffer();
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_wrapperCreate_ByteBufferWithSize(binary_size_t size);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            [return: MarshalAs(UseBoolMashal)]
+            public extern static bool_t org_webRtc_ByteBuffer_get_readOnly(org_webRtc_ByteBuffer_t thisHandle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static binary_size_t org_webRtc_ByteBuffer_get_size(org_webRtc_ByteBuffer_t thisHandle);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static void org_webRtc_ByteBuffer_get_data(
+                org_webRtc_ByteBuffer_t thisHandle,
+                [Out] byte[] buffer,
+                binary_size_t size);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static void org_webRtc_ByteBuffer_set_data(
+                org_webRtc_ByteBuffer_t thisHandle,
+                byte[] buffer,
+                binary_size_t size);
+
+            #endregion // Org.WebRtc.ByteBuffer
+
+
             #region Org.WebRtc.EventQueueMaker
 
             //------------------------------------------------------------------
@@ -228,6 +278,16 @@ namespace Wrapper
             [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
             public extern static instance_id_t org_webRtc_VideoData_wrapperInstanceId(org_webRtc_VideoData_t handle);
 
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static org_webRtc_VideoData_t org_webRtc_VideoData_wrapperCreate_VideoData();
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            public extern static org_webRtc_VideoData_t org_webRtc_VideoData_wrapperCreate_VideoDataWithSize(binary_size_t size);
+
+            [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
+            [return: MarshalAs(UseBoolMashal)]
+            public extern static bool_t org_webRtc_VideoData_get_readOnly(org_webRtc_VideoData_t thisHandle);
+
             [DllImport(UseDynamicLib, CallingConvention = UseCallingConvention)]
             [return: MarshalAs(UseBoolMashal)]
             public extern static bool_t org_webRtc_VideoData_get_is8BitColorSpace(org_webRtc_VideoData_t thisHandle);
@@ -324,6 +384,25 @@ namespace Wrapper
 
             #endregion // Org.WebRtc.AudioData
 
+            #region Org.WebRtc.ByteBuffer
+
+            public static Org.WebRtc.ByteBuffer org_webRtc_ByteBuffer_FromC(org_webRtc_ByteBuffer_t handle)
+            {
+                return Org.WebRtc.ByteBuffer.org_webRtc_ByteBuffer_FromC(handle);
+            }
+
+            public static Org.WebRtc.ByteBuffer org_webRtc_ByteBuffer_AdoptFromC(org_webRtc_ByteBuffer_t handle)
+            {
+                return Org.WebRtc.ByteBuffer.org_webRtc_ByteBuffer_AdoptFromC(handle);
+            }
+
+            public static org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_ToC(Org.WebRtc.ByteBuffer value)
+            {
+                return Org.WebRtc.ByteBuffer.org_webRtc_ByteBuffer_ToC(value);
+            }
+
+            #endregion // Org.WebRtc.ByteBuffer
+
             #region Org.WebRtc.MediaSample
 
             public static Org.WebRtc.MediaSample org_webRtc_MediaSample_FromC(org_webRtc_MediaSample_t handle)
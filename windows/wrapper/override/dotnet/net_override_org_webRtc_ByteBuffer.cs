@@ -0,0 +1,182 @@
+
+using org_webRtc_ByteBuffer_t = System.IntPtr;
+using instance_id_t = System.IntPtr;
+using bool_t = System.Boolean;
+using box_bool_t = System.IntPtr;
+using std_list_uint8_t_t = System.IntPtr;
+
+namespace Org
+{
+    namespace WebRtc
+    {
+
+        public interface IByteBuffer
+        {
+            /// <summary>
+            /// Gets if the data is read-only. Buffers of received messages
+            /// are always read-only.
+            /// </summary>
+            bool ReadOnly { get; }
+
+            /// <summary>
+            /// Gets the buffer data size.
+            /// </summary>
+            System.UInt64 Size { get; }
+
+            /// <summary>
+            /// Gets a copy of the bytes of the buffer.
+            /// </summary>
+            byte[] GetData();
+
+            /// <summary>
+            /// Copies the bytes into a writable buffer, up to its size.
+            /// </summary>
+            void SetData(byte[] values);
+
+        }
+
+        public sealed class ByteBuffer : System.IDisposable,
+                                        Org.WebRtc.IByteBuffer
+        {
+
+            #region To / From C routines
+
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+            // To / From C routines
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+
+            private class WrapperMakePrivate {}
+            private org_webRtc_ByteBuffer_t native_ = System.IntPtr.Zero;
+
+            private ByteBuffer(WrapperMakePrivate ignored, org_webRtc_ByteBuffer_t handle)
+            {
+                this.native_ = handle;
+            }
+
+
+            public void Dispose()
+            {
+                Dispose(true);
+            }
+
+            private void Dispose(bool disposing)
+            {
+                if (System.IntPtr.Zero == this.native_) return;
+                Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperDispose(this.native_);
+                Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperDestroy(this.native_);
+                this.native_ = System.IntPtr.Zero;
+                if (disposing) System.GC.SuppressFinalize(this);
+            }
+
+            ~ByteBuffer()
+            {
+                Dispose(false);
+            }
+
+            internal static ByteBuffer org_webRtc_ByteBuffer_FromC(org_webRtc_ByteBuffer_t handle)
+            {
+                if (System.IntPtr.Zero == handle) return null;
+                return new ByteBuffer((WrapperMakePrivate)null, Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperClone(handle));
+            }
+
+            internal static ByteBuffer org_webRtc_ByteBuffer_AdoptFromC(org_webRtc_ByteBuffer_t handle)
+            {
+                if (System.IntPtr.Zero == handle) return null;
+                return new ByteBuffer((WrapperMakePrivate)null, handle);
+            }
+
+            internal static org_webRtc_ByteBuffer_t org_webRtc_ByteBuffer_ToC(ByteBuffer value)
+            {
+                if (null == value) return System.IntPtr.Zero;
+                return Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperClone(value.native_);
+            }
+
+            #endregion // To / From C routines
+
+
+            #region Org.WebRtc.ByteBuffer
+
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+            // Org.WebRtc.ByteBuffer
+            //------------------------------------------------------------------
+            //------------------------------------------------------------------
+
+            /// <summary>
+            /// Constructs a new empty byte buffer.
+            /// </summary>
+            public ByteBuffer()
+            {
+                this.native_ = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperCreate_ByteBuffer();
+            }
+
+            /// <summary>
+            /// Constructs a writable byte buffer of the given size in bytes.
+            /// </summary>
+            public ByteBuffer(System.UInt64 size)
+            {
+                this.native_ = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_wrapperCreate_ByteBufferWithSize(size);
+            }
+
+            /// <summary>
+            /// Gets if the data is read-only. Buffers of received messages
+            /// are always read-only.
+            /// </summary>
+            public bool ReadOnly
+            {
+                get
+                {
+                    var result = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_get_readOnly(this.native_);
+                    return (result);
+                }
+            }
+
+            /// <summary>
+            /// Gets the buffer data size.
+            /// </summary>
+            public System.UInt64 Size
+            {
+                get
+                {
+                    var result = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_get_size(this.native_);
+                    return (result);
+                }
+            }
+
+            /// <summary>
+            /// Gets a copy of the bytes of the buffer.
+            /// </summary>
+            public byte[] GetData()
+            {
+                var size = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_get_size(this.native_);
+                if (size < 1)
+                    return null;
+
+                byte[] buffer = new byte[size];
+
+                Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_get_data(this.native_, buffer, size);
+
+                return buffer;
+            }
+
+            /// <summary>
+            /// Copies the bytes into a writable buffer, up to its size.
+            /// </summary>
+            public void SetData(byte[] values)
+            {
+                if (null == values)
+                    return;
+
+                Wrapper.Org_WebRtc.OverrideApi.org_webRtc_ByteBuffer_set_data(this.native_, values, (System.UInt64)values.Length);
+            }
+
+            #endregion // Org.WebRtc.ByteBuffer
+
+
+        }
+
+    } //WebRtc
+} //Org
+
@@ -13,6 +13,11 @@ namespace Org
 
         public interface IVideoData
         {
+            /// <summary>
+            /// Gets if the data is read-only.
+            /// </summary>
+            bool ReadOnly { get; }
+
             bool Is8BitColorSpace { get; }
             bool Is16BitColorSpace { get; }
 
@@ -102,6 +107,36 @@ namespace Org
             //------------------------------------------------------------------
             //------------------------------------------------------------------
 
+            /// <summary>
+            /// Constructs a new empty video data object.
+            /// </summary>
+            public VideoData()
+            {
+                this.native_ = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_VideoData_wrapperCreate_VideoData();
+            }
+
+            /// <summary>
+            /// Constructs a writable 8 bit video data object of the given size
+            /// in bytes, suitable as the destination of a frame buffer
+            /// conversion.
+            /// </summary>
+            public VideoData(System.UInt64 size)
+            {
+                this.native_ = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_VideoData_wrapperCreate_VideoDataWithSize(size);
+            }
+
+            /// <summary>
+            /// Gets if the data is read-only.
+            /// </summary>
+            public bool ReadOnly
+            {
+                get
+                {
+                    var result = Wrapper.Org_WebRtc.OverrideApi.org_webRtc_VideoData_get_readOnly(this.native_);
+                    return (result);
+                }
+            }
+
             public bool Is8BitColorSpace
             {
                 get
@@ -0,0 +1,33 @@
+
+#ifndef WRAPPER_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
+
+#pragma once
+
+#include "types.h"
+
+namespace wrapper {
+  namespace org {
+    namespace webRtc {
+
+      struct ByteBuffer
+      {
+        static ByteBufferPtr wrapper_create() noexcept;
+        virtual ~ByteBuffer() noexcept {}
+
+        virtual void wrapper_dispose() noexcept = 0;
+
+        virtual void wrapper_init_org_webRtc_ByteBuffer() noexcept = 0;
+        virtual void wrapper_init_org_webRtc_ByteBuffer(size_t size) noexcept = 0;
+
+        virtual bool get_readOnly() noexcept = 0;
+        virtual const uint8_t *get_data() noexcept = 0;
+        virtual uint8_t *get_mutableData() noexcept = 0;
+
+        virtual size_t get_size() noexcept = 0;
+      };
+
+    } // webRtc
+  } // org
+} // namespace wrapper
+
+#endif //ifndef WRAPPER_USE_GENERATED_ORG_WEBRTC_BYTEBUFFER
@@ -16,10 +16,15 @@ namespace wrapper {
 
         virtual void wrapper_dispose() noexcept = 0;
 
+        virtual void wrapper_init_org_webRtc_VideoData() noexcept = 0;
+        virtual void wrapper_init_org_webRtc_VideoData(size_t size) noexcept = 0;
+
+        virtual bool get_readOnly() noexcept = 0;
         virtual bool get_is8BitColorSpace() noexcept = 0;
         virtual bool get_is16BitColorSpace() noexcept = 0;
         virtual const uint8_t *get_data8bit() noexcept = 0;
         virtual const uint16_t *get_data16bit() noexcept = 0;
+        virtual uint8_t *get_mutableData8bit() noexcept = 0;
 
         virtual size_t get_size() noexcept = 0;
       };
@@ -0,0 +1,195 @@
+
+#include <wrapper/impl_webrtc_DataChannelPayload.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "pc/datachannel.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const size_t kTransferBytes = 256 * 1024 * 1024;
+  const size_t kMessageSizes[] = {1024, 16 * 1024, 64 * 1024, 256 * 1024};
+  const int kRuns = 3;
+
+  //---------------------------------------------------------------------------
+  // Carries everything one data channel sends straight into another one's
+  // receive path, as the SCTP transport would, without a network between.
+  class LoopbackProvider : public DataChannelProviderInterface
+  {
+  public:
+    bool SendData(
+                  const cricket::SendDataParams &params,
+                  const rtc::CopyOnWriteBuffer &payload,
+                  cricket::SendDataResult *result
+                  ) override
+    {
+      *result = cricket::SDR_SUCCESS;
+      if (!peer_) return true;
+
+      cricket::ReceiveDataParams received;
+      received.sid = params.sid;
+      received.type = params.type;
+      peer_->OnDataReceived(received, payload);
+      return true;
+    }
+
+    bool ConnectDataChannel(DataChannel *) override { return true; }
+    void DisconnectDataChannel(DataChannel *) override {}
+    void AddSctpDataStream(int) override {}
+    void RemoveSctpDataStream(int) override {}
+    bool ReadyToSendData() const override { return false; }
+
+    DataChannel *peer_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // Counts what arrives and reads every message so none goes untouched.
+  class Receiver : public DataChannelObserver
+  {
+  public:
+    void OnStateChange() override {}
+    void OnMessage(const DataBuffer &buffer) override
+    {
+      ++messages_;
+      bytes_ += buffer.size();
+      if (buffer.size() > 0) check_ += buffer.data.cdata()[buffer.size() - 1];
+    }
+
+    uint64_t messages_ {};
+    uint64_t bytes_ {};
+    uint64_t check_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // A negotiated SCTP data channel pair, both ends open.
+  class Loopback
+  {
+  public:
+    Loopback()
+    {
+      DataChannelInit init;
+      init.negotiated = true;
+      init.id = 1;
+
+      sender_ = DataChannel::Create(&senderProvider_, cricket::DCT_SCTP, "sender", InternalDataChannelInit(init));
+      receiver_ = DataChannel::Create(&receiverProvider_, cricket::DCT_SCTP, "receiver", InternalDataChannelInit(init));
+      senderProvider_.peer_ = receiver_.get();
+      receiver_->RegisterObserver(&observer_);
+
+      for (auto channel : {sender_.get(), receiver_.get()}) {
+        channel->OnTransportChannelCreated();
+        channel->OnChannelReady(true);
+      }
+    }
+
+    ~Loopback()
+    {
+      receiver_->UnregisterObserver();
+    }
+
+    bool open() const { return (DataChannelInterface::kOpen == sender_->state()) && (DataChannelInterface::kOpen == receiver_->state()); }
+
+    LoopbackProvider senderProvider_;
+    LoopbackProvider receiverProvider_;
+    rtc::scoped_refptr<DataChannel> sender_;
+    rtc::scoped_refptr<DataChannel> receiver_;
+    Receiver observer_;
+  };
+
+  //---------------------------------------------------------------------------
+  // What the caller passes in: the bytes the wrapper gets from a
+  // SecureByteBlock, a string or a ByteBuffer.
+  struct Input
+  {
+    explicit Input(size_t size) :
+      bytes_(size, 0x5a),
+      text_(size, 'x'),
+      buffer_(bytes_.data(), bytes_.size())
+    {}
+
+    std::vector<uint8_t> bytes_;
+    std::string text_;
+    rtc::CopyOnWriteBuffer buffer_;
+  };
+
+  typedef std::function<DataBuffer(const Input &)> Build;
+
+  // called through a volatile pointer so the wipe is never optimized away,
+  // as SecureByteBlock's is not
+  void *(*const volatile wipe)(void *, int, size_t) = std::memset;
+
+  //---------------------------------------------------------------------------
+  // The path the wrapper used to take through MessageEvent: a copy into a
+  // SecureByteBlock, which is wiped when released, and a second copy into
+  // a buffer with one byte of spare capacity.
+  DataBuffer buildThroughMessageEvent(const Input &input)
+  {
+    std::vector<uint8_t> block(input.bytes_.begin(), input.bytes_.end());
+    rtc::CopyOnWriteBuffer buffer(block.data(), block.size(), block.size() + 1);
+    wipe(block.data(), 0, block.size());
+    return DataBuffer(buffer, true);
+  }
+
+  //---------------------------------------------------------------------------
+  // Sends the transfer in messages of the given size; returns MB/s, the
+  // best of a few runs.
+  double run(size_t messageSize, const Build &build)
+  {
+    Input input(messageSize);
+    const size_t messages = std::max<size_t>(1, kTransferBytes / messageSize);
+
+    double best = 0;
+    for (int index = 0; index < kRuns; ++index) {
+      Loopback loopback;
+      if (!loopback.open()) {
+        printf("the loopback data channels did not open\n");
+        return 0;
+      }
+
+      auto start = Clock::now();
+      for (size_t count = 0; count < messages; ++count) {
+        loopback.sender_->Send(build(input));
+      }
+      auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+      if (loopback.observer_.messages_ != messages) {
+        printf("%llu of %zu messages arrived\n", static_cast<unsigned long long>(loopback.observer_.messages_), messages);
+        return 0;
+      }
+      best = std::max(best, loopback.observer_.bytes_ / 1e6 / elapsed);
+    }
+    return best;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Measures data channel throughput over an in-process loopback of two real
+// SCTP data channels for each way the wrapper builds a message, against the
+// two copy MessageEvent path it used to take.
+int main()
+{
+  printf("%zu MB per run, MB/s, best of %d\n", kTransferBytes >> 20, kRuns);
+  printf("%10s %14s %14s %14s %14s\n", "message", "MessageEvent", "send(bytes)", "send(text)", "sendWithBuffer");
+
+  for (auto messageSize : kMessageSizes) {
+    const double messageEvent = run(messageSize, buildThroughMessageEvent);
+    const double bytes = run(messageSize, [](const Input &input) { return DataChannelPayload::fromBytes(input.bytes_.data(), input.bytes_.size()); });
+    const double text = run(messageSize, [](const Input &input) { return DataChannelPayload::fromText(input.text_); });
+    const double shared = run(messageSize, [](const Input &input) { return DataChannelPayload::fromBuffer(input.buffer_); });
+
+    printf("%7zu KB %14.0f %14.0f %14.0f %14.0f\n", messageSize >> 10, messageEvent, bytes, text, shared);
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+
+#include <wrapper/impl_webrtc_DataChannelSendQueue.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/refcountedobject.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const size_t kTransferBytes = 64 * 1024 * 1024;
+  const size_t kMessageBytes = 64 * 1024;
+  const size_t kLinkBytesPerTick = 100 * 1000;    // 10 MB/s in 10 ms ticks
+  const uint64_t kChannelLimit = 16 * 1024 * 1024; // the SCTP channel's own limit
+
+  //---------------------------------------------------------------------------
+  // An open channel over a link that carries a fixed number of bytes per
+  // tick. Like the SCTP data channel it refuses a message that would take
+  // its buffered amount over 16 MB.
+  class FakeChannel : public DataChannelInterface
+  {
+  public:
+    void RegisterObserver(DataChannelObserver *) override {}
+    void UnregisterObserver() override {}
+    std::string label() const override { return "bulk"; }
+    bool reliable() const override { return true; }
+    int id() const override { return 0; }
+    DataState state() const override { return kOpen; }
+    uint32_t messages_sent() const override { return 0; }
+    uint64_t bytes_sent() const override { return 0; }
+    uint32_t messages_received() const override { return 0; }
+    uint64_t bytes_received() const override { return 0; }
+    uint64_t buffered_amount() const override { return buffered_; }
+    void Close() override {}
+
+    bool Send(const DataBuffer &buffer) override
+    {
+      if (buffered_ + buffer.size() > kChannelLimit) return false;
+      buffered_ += buffer.size();
+      peakBuffered_ = std::max(peakBuffered_, buffered_);
+      return true;
+    }
+
+    void transmit() { buffered_ -= std::min<uint64_t>(buffered_, kLinkBytesPerTick); }
+
+    uint64_t buffered_ {};
+    uint64_t peakBuffered_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // Sends the transfer as fast as the queue accepts it, waiting a tick
+  // whenever the queue refuses a message for its byte budget, and runs the
+  // link until everything handed over has gone out.
+  void run(const char *name, const DataChannelSendQueue::Options &options)
+  {
+    rtc::scoped_refptr<FakeChannel> channel(new rtc::RefCountedObject<FakeChannel>());
+    auto queue = DataChannelSendQueue::create(channel, nullptr);
+    queue->setOptions(options);
+
+    size_t offered = 0;
+    size_t failed = 0;
+    size_t peakQueued = 0;
+    size_t ticks = 0;
+
+    auto start = Clock::now();
+    while ((offered < kTransferBytes) ||
+           (queue->stats().queuedMessages_ > 0) ||
+           (channel->buffered_ > 0)) {
+      while (offered < kTransferBytes) {
+        DataBuffer buffer(rtc::CopyOnWriteBuffer(kMessageBytes), true);
+        if (!queue->send(std::move(buffer), [&](bool handedOff) { if (!handedOff) ++failed; })) break;
+        offered += kMessageBytes;
+      }
+      peakQueued = std::max(peakQueued, queue->stats().queuedBytes_);
+
+      // the observer drains again once the buffered amount has changed
+      channel->transmit();
+      queue->drain();
+      ++ticks;
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    printf("%-22s %6.2f s  %5.2f MB/s  peak buffered %6.2f MB  peak queued %6.2f MB  failed %4zu  host %6.1f ms\n",
+           name,
+           ticks / 100.0,
+           (kTransferBytes - failed * kMessageBytes) / 1e6 / (ticks / 100.0),
+           channel->peakBuffered_ / 1e6,
+           peakQueued / 1e6,
+           failed,
+           elapsed);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Compares a bulk transfer through the send queue with and without its
+// watermarks over a simulated 10 MB/s link: the time the transfer takes,
+// how much the channel buffers, and the messages the channel refuses.
+int main()
+{
+  printf("%zu MB in %zu KB messages over a %zu KB/10 ms link\n", kTransferBytes >> 20, kMessageBytes >> 10, kLinkBytesPerTick / 1000);
+
+  DataChannelSendQueue::Options disabled;
+  run("disabled", disabled);
+
+  DataChannelSendQueue::Options enabled;
+  enabled.enabled_ = true;
+  run("enabled 1 MB/256 KB", enabled);
+
+  enabled.highWatermark_ = 256 * 1024;
+  enabled.lowWatermark_ = 64 * 1024;
+  run("enabled 256 KB/64 KB", enabled);
+
+  enabled.highWatermark_ = 128 * 1024;
+  enabled.lowWatermark_ = 0;
+  run("enabled 128 KB/0", enabled);
+  return 0;
+}
@@ -0,0 +1,313 @@
+
+#include <wrapper/impl_webrtc_DataChannelSendQueue.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "rtc_base/refcountedobject.h"
+#include "rtc_base/thread.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  const size_t kMessageBytes = 100;
+
+  //---------------------------------------------------------------------------
+  // A channel whose state and buffered amount the test sets; it remembers
+  // the size of every message it accepts.
+  class FakeChannel : public DataChannelInterface
+  {
+  public:
+    void RegisterObserver(DataChannelObserver *) override {}
+    void UnregisterObserver() override {}
+    std::string label() const override { return "test"; }
+    bool reliable() const override { return true; }
+    int id() const override { return 0; }
+    DataState state() const override { return state_; }
+    uint32_t messages_sent() const override { return 0; }
+    uint64_t bytes_sent() const override { return 0; }
+    uint32_t messages_received() const override { return 0; }
+    uint64_t bytes_received() const override { return 0; }
+    uint64_t buffered_amount() const override { return buffered_; }
+    void Close() override {}
+
+    bool Send(const DataBuffer &buffer) override
+    {
+      if (refuse_) return false;
+      buffered_ += buffer.size();
+      sent_.push_back(buffer.size());
+      if (onSend_) onSend_();
+      return true;
+    }
+
+    DataState state_ {kOpen};
+    uint64_t buffered_ {};
+    bool refuse_ {};
+    std::function<void()> onSend_;
+    std::vector<size_t> sent_;
+  };
+
+  //---------------------------------------------------------------------------
+  // Counts the callbacks of the messages it sends.
+  struct Results
+  {
+    DataChannelSendQueue::Callback callback()
+    {
+      return [this](bool handedOff) { ++(handedOff ? handedOff_ : failed_); };
+    }
+
+    int handedOff_ {};
+    int failed_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  DataBuffer message(size_t size = kMessageBytes)
+  {
+    return DataBuffer(rtc::CopyOnWriteBuffer(size), true);
+  }
+
+  //---------------------------------------------------------------------------
+  // Watermarks of 300 and 100 bytes, which is three and one messages.
+  DataChannelSendQueue::Options watermarks()
+  {
+    DataChannelSendQueue::Options options;
+    options.enabled_ = true;
+    options.highWatermark_ = 3 * kMessageBytes;
+    options.lowWatermark_ = kMessageBytes;
+    return options;
+  }
+
+  //---------------------------------------------------------------------------
+  class DataChannelSendQueueTest : public ::testing::Test
+  {
+  protected:
+    rtc::scoped_refptr<FakeChannel> channel_ {new rtc::RefCountedObject<FakeChannel>()};
+    DataChannelSendQueuePtr queue_ {DataChannelSendQueue::create(channel_, nullptr)};
+    Results results_;
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, DisabledHandsEverythingOverWhileOpen)
+{
+  channel_->buffered_ = 10 * 1024 * 1024;
+  for (int index = 0; index < 5; ++index) {
+    EXPECT_TRUE(queue_->send(message(), results_.callback()));
+  }
+
+  EXPECT_EQ(5u, channel_->sent_.size());
+  EXPECT_EQ(5, results_.handedOff_);
+
+  auto stats = queue_->stats();
+  EXPECT_EQ(5u, stats.sentMessages_);
+  EXPECT_EQ(5 * kMessageBytes, stats.sentBytes_);
+  EXPECT_EQ(0u, stats.queuedMessages_);
+  EXPECT_FALSE(stats.paused_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, WaitsForTheChannelToOpen)
+{
+  channel_->state_ = DataChannelInterface::kConnecting;
+  queue_->send(message(), results_.callback());
+  queue_->send(message(), results_.callback());
+
+  EXPECT_TRUE(channel_->sent_.empty());
+  EXPECT_EQ(2u, queue_->stats().queuedMessages_);
+  EXPECT_EQ(2 * kMessageBytes, queue_->stats().queuedBytes_);
+
+  channel_->state_ = DataChannelInterface::kOpen;
+  queue_->drain();
+  EXPECT_EQ(2u, channel_->sent_.size());
+  EXPECT_EQ(2, results_.handedOff_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, PausesAtTheHighWatermarkUntilTheLowWatermark)
+{
+  queue_->setOptions(watermarks());
+  for (int index = 0; index < 8; ++index) {
+    queue_->send(message(), results_.callback());
+  }
+
+  // handed over until the buffered amount reaches the high watermark
+  EXPECT_EQ(3u, channel_->sent_.size());
+  EXPECT_TRUE(queue_->stats().paused_);
+  EXPECT_EQ(5u, queue_->stats().queuedMessages_);
+
+  // still above the low watermark
+  channel_->buffered_ = kMessageBytes + 1;
+  queue_->drain();
+  EXPECT_EQ(3u, channel_->sent_.size());
+  EXPECT_TRUE(queue_->stats().paused_);
+
+  // at the low watermark the channel is filled up to the high one again
+  channel_->buffered_ = kMessageBytes;
+  queue_->drain();
+  EXPECT_EQ(5u, channel_->sent_.size());
+  EXPECT_TRUE(queue_->stats().paused_);
+
+  channel_->buffered_ = 0;
+  queue_->drain();
+  EXPECT_EQ(8u, channel_->sent_.size());
+  EXPECT_FALSE(queue_->stats().paused_);
+  EXPECT_EQ(8, results_.handedOff_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, DisablingReleasesAPausedQueue)
+{
+  queue_->setOptions(watermarks());
+  for (int index = 0; index < 6; ++index) {
+    queue_->send(message(), results_.callback());
+  }
+  ASSERT_TRUE(queue_->stats().paused_);
+
+  queue_->setOptions(DataChannelSendQueue::Options());
+  EXPECT_EQ(6u, channel_->sent_.size());
+  EXPECT_FALSE(queue_->stats().paused_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, LowWatermarkIsCappedAtTheHighWatermark)
+{
+  auto options = watermarks();
+  options.lowWatermark_ = options.highWatermark_ * 2;
+  queue_->setOptions(options);
+  EXPECT_EQ(options.highWatermark_, queue_->options().lowWatermark_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, RejectsMessagesOverTheBudget)
+{
+  auto options = watermarks();
+  options.maxQueuedBytes_ = 2 * kMessageBytes;
+  queue_->setOptions(options);
+  channel_->state_ = DataChannelInterface::kConnecting;
+
+  EXPECT_TRUE(queue_->send(message(), results_.callback()));
+  EXPECT_TRUE(queue_->send(message(), results_.callback()));
+  EXPECT_FALSE(queue_->send(message(), results_.callback()));
+  EXPECT_FALSE(queue_->send(message(1), results_.callback()));
+
+  // a rejected message is never called back
+  EXPECT_EQ(0, results_.handedOff_ + results_.failed_);
+  EXPECT_EQ(2u, queue_->stats().rejectedMessages_);
+
+  // handing messages over makes room again
+  channel_->state_ = DataChannelInterface::kOpen;
+  queue_->drain();
+  EXPECT_TRUE(queue_->send(message(2 * kMessageBytes), results_.callback()));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, BudgetAppliesWhenDisabled)
+{
+  DataChannelSendQueue::Options options;
+  options.maxQueuedBytes_ = kMessageBytes;
+  queue_->setOptions(options);
+  channel_->state_ = DataChannelInterface::kConnecting;
+
+  EXPECT_TRUE(queue_->send(message(), results_.callback()));
+  EXPECT_FALSE(queue_->send(message(), results_.callback()));
+  EXPECT_EQ(1u, queue_->stats().rejectedMessages_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, FailsQueuedMessagesOnceClosing)
+{
+  channel_->state_ = DataChannelInterface::kConnecting;
+  queue_->send(message(), results_.callback());
+  queue_->send(message(), results_.callback());
+
+  channel_->state_ = DataChannelInterface::kClosing;
+  queue_->drain();
+
+  EXPECT_EQ(2, results_.failed_);
+  auto stats = queue_->stats();
+  EXPECT_EQ(2u, stats.failedMessages_);
+  EXPECT_EQ(0u, stats.queuedMessages_);
+  EXPECT_EQ(0u, stats.queuedBytes_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, ReportsMessagesTheChannelRefuses)
+{
+  channel_->refuse_ = true;
+  queue_->send(message(), results_.callback());
+
+  EXPECT_EQ(1, results_.failed_);
+  EXPECT_EQ(1u, queue_->stats().failedMessages_);
+  EXPECT_EQ(0u, queue_->stats().sentMessages_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, DrainRequestedFromInsideSendRunsAfterIt)
+{
+  queue_->setOptions(watermarks());
+  channel_->state_ = DataChannelInterface::kConnecting;
+  for (int index = 0; index < 5; ++index) {
+    queue_->send(message(), results_.callback());
+  }
+
+  // the channel reports its buffered amount changing from inside Send(),
+  // as the SCTP channel does once a message goes out at once
+  int nested = 0;
+  channel_->onSend_ = [&] {
+    ++nested;
+    channel_->buffered_ = 0;
+    queue_->drain();
+  };
+
+  channel_->state_ = DataChannelInterface::kOpen;
+  queue_->drain();
+
+  EXPECT_EQ(5, nested);
+  EXPECT_EQ(5u, channel_->sent_.size());
+  EXPECT_EQ(0u, queue_->stats().queuedMessages_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(DataChannelSendQueueTest, DestroyingFailsQueuedMessages)
+{
+  channel_->state_ = DataChannelInterface::kConnecting;
+  queue_->send(message(), results_.callback());
+  queue_.reset();
+  EXPECT_EQ(1, results_.failed_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DataChannelSendQueueThreadTest, DrainsOnTheSignalingThread)
+{
+  rtc::scoped_refptr<FakeChannel> channel(new rtc::RefCountedObject<FakeChannel>());
+  auto thread = rtc::Thread::Current();
+  auto queue = DataChannelSendQueue::create(channel, thread);
+
+  queue->send(message(), nullptr);
+  queue->send(message(), nullptr);
+  EXPECT_TRUE(channel->sent_.empty());
+
+  // both sends are handed over by the one drain posted
+  thread->ProcessMessages(0);
+  EXPECT_EQ(2u, channel->sent_.size());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DataChannelSendQueueThreadTest, PendingDrainOutlivesTheQueue)
+{
+  rtc::scoped_refptr<FakeChannel> channel(new rtc::RefCountedObject<FakeChannel>());
+  auto thread = rtc::Thread::Current();
+  auto queue = DataChannelSendQueue::create(channel, thread);
+
+  Results results;
+  queue->send(message(), results.callback());
+  queue.reset();
+  EXPECT_EQ(1, results.failed_);
+
+  // the drain posted for the released queue finds nothing to do
+  thread->ProcessMessages(0);
+  EXPECT_TRUE(channel->sent_.empty());
+}
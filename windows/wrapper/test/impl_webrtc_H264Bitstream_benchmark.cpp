@@ -0,0 +1,148 @@
+
+#include <wrapper/impl_webrtc_H264Bitstream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+  typedef std::vector<uint8_t> Bytes;
+
+  const size_t kScannedBytes = 1024 * 1024 * 1024;
+
+  const uint8_t kAud[] = {0x09, 0xf0};
+  const uint8_t kSps[] = {0x67, 0x42, 0x00, 0x1e, 0x95, 0xa8, 0x28, 0x0f, 0x64};   // 640x480 baseline
+  const uint8_t kPps[] = {0x68, 0xce, 0x3c, 0x80};
+
+  //---------------------------------------------------------------------------
+  void append(Bytes &bytes, const uint8_t *nal, size_t length)
+  {
+    const uint8_t startCode[] = {0, 0, 0, 1};
+    bytes.insert(bytes.end(), startCode, startCode + sizeof(startCode));
+    bytes.insert(bytes.end(), nal, nal + length);
+  }
+
+  //---------------------------------------------------------------------------
+  // An access unit as an encoder emits it: an AUD, parameter sets ahead of
+  // an IDR, then one slice of random data with emulation prevention bytes
+  // so the slice holds no start code.
+  Bytes accessUnit(bool idr, size_t sliceLength, std::mt19937 &random)
+  {
+    Bytes bytes;
+    append(bytes, kAud, sizeof(kAud));
+    if (idr) {
+      append(bytes, kSps, sizeof(kSps));
+      append(bytes, kPps, sizeof(kPps));
+    }
+
+    const uint8_t header = idr ? 0x65 : 0x41;
+    append(bytes, &header, sizeof(header));
+
+    int zeros = 0;
+    for (size_t index = 0; index < sliceLength; ++index) {
+      // slice data has many more zero bytes than uniform noise
+      uint8_t value = (0 == (random() & 3)) ? 0 : static_cast<uint8_t>(random());
+      if ((zeros >= 2) && (value <= 3)) {
+        bytes.push_back(3);
+        zeros = 0;
+      }
+      bytes.push_back(value);
+      zeros = (0 == value) ? zeros + 1 : 0;
+    }
+    return bytes;
+  }
+
+  //---------------------------------------------------------------------------
+  // The byte at a time IDR detection the render path used before
+  // H264Bitstream, bounds fixed.
+  bool scalarIsIDR(const uint8_t *data, size_t length)
+  {
+    if (length < 5) return false;
+    for (size_t index = 0; index < length - 5; ++index) {
+      const uint8_t *ptr = data + index;
+      if ((0x00 != ptr[0]) || (0x00 != ptr[1])) continue;
+
+      size_t prefixLength = 0;
+      if ((0x00 == ptr[2]) && (0x01 == ptr[3]))
+        prefixLength = 4;
+      else if (0x01 == ptr[2])
+        prefixLength = 3;
+      else
+        continue;
+      if (0x05 == (ptr[prefixLength] & 0x1f)) return true;
+    }
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Every NAL unit of the sample located with findStartCode.
+  bool scanIsIDR(const uint8_t *data, size_t length)
+  {
+    size_t offset = 0;
+    H264Bitstream::NalUnit unit;
+    while (H264Bitstream::nextNalUnit(data, length, offset, unit)) {
+      if (H264Bitstream::NalUnitType_IDR == unit.type_) return true;
+    }
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  bool inspectIsIDR(const uint8_t *data, size_t length)
+  {
+    return H264Bitstream::inspect(data, length).isIDR_;
+  }
+
+  //---------------------------------------------------------------------------
+  // Microseconds per sample, detecting IDR in enough copies of the sample
+  // to cover kScannedBytes.
+  double measure(const Bytes &sample, bool (*isIDR)(const uint8_t *, size_t), bool expected)
+  {
+    const size_t iterations = (kScannedBytes / sample.size()) + 1;
+    size_t matched = 0;
+
+    // read through a volatile so the detection is not hoisted out of the loop
+    const uint8_t *volatile data = sample.data();
+
+    auto start = Clock::now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+      if (isIDR(data, sample.size()) == expected) ++matched;
+    }
+    auto elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    if (matched != iterations) printf("wrong IDR detection\n");
+    return elapsed / iterations;
+  }
+
+  //---------------------------------------------------------------------------
+  void run(const char *name, bool idr, size_t sliceLength)
+  {
+    std::mt19937 random(static_cast<uint32_t>(sliceLength));
+    auto sample = accessUnit(idr, sliceLength, random);
+
+    const double scalar = measure(sample, scalarIsIDR, idr);
+    const double scan = measure(sample, scanIsIDR, idr);
+    const double inspect = measure(sample, inspectIsIDR, idr);
+
+    printf("%-14s %8zu %12.3f %14.3f %10.3f\n", name, sample.size(), scalar, scan, inspect);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Compares IDR detection on encoded samples: the old scalar scan, a full
+// scan built on findStartCode, and inspect, which stops at the first slice.
+int main()
+{
+  printf("us per sample\n");
+  printf("%-14s %8s %12s %14s %10s\n", "sample", "bytes", "scalar", "findStartCode", "inspect");
+
+  run("P 5 KB", false, 5 * 1024);
+  run("P 50 KB", false, 50 * 1024);
+  run("IDR 50 KB", true, 50 * 1024);
+  run("IDR 500 KB", true, 500 * 1024);
+  return 0;
+}
@@ -0,0 +1,32 @@
+
+#include <wrapper/impl_webrtc_H264Bitstream.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace webrtc;
+
+//-----------------------------------------------------------------------------
+// Runs arbitrary input through every H264Bitstream entry point; they must
+// stay inside the buffer and report only plausible picture sizes.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  auto info = H264Bitstream::inspect(data, size);
+  if ((info.hasSps_) && ((info.sps_.width_ <= 0) || (info.sps_.height_ <= 0))) __builtin_trap();
+
+  size_t offset = 0;
+  H264Bitstream::NalUnit unit;
+  while (H264Bitstream::nextNalUnit(data, size, offset, unit)) {
+    if ((unit.data_ < data) || (unit.data_ + unit.length_ > data + size)) __builtin_trap();
+
+    H264Bitstream::SpsInfo sps;
+    if (H264Bitstream::parseSps(unit.data_, unit.length_, sps)) {
+      if ((sps.width_ <= 0) || (sps.height_ <= 0)) __builtin_trap();
+    }
+  }
+
+  // the whole input as a single NAL unit, as a packetizer would hand it over
+  H264Bitstream::SpsInfo sps;
+  H264Bitstream::parseSps(data, size, sps);
+  return 0;
+}
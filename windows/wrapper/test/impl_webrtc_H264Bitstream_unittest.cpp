@@ -0,0 +1,576 @@
+
+#include <wrapper/impl_webrtc_H264Bitstream.h>
+
+#include "test/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //---------------------------------------------------------------------------
+  // Writes an RBSP bit by bit so parameter sets can be built from their
+  // syntax elements rather than pasted in as opaque hex.
+  class BitWriter
+  {
+  public:
+    void bit(uint32_t value)
+    {
+      if (0 == (bits_ & 7)) bytes_.push_back(0);
+      if (0 != value) bytes_.back() |= static_cast<uint8_t>(0x80 >> (bits_ & 7));
+      ++bits_;
+    }
+
+    void bits(uint32_t value, int count)
+    {
+      while (count-- > 0) bit((value >> count) & 1);
+    }
+
+    void ue(uint32_t value)
+    {
+      uint64_t coded = static_cast<uint64_t>(value) + 1;
+      int length = 0;
+      while ((coded >> length) > 1) ++length;
+      bits(0, length);
+      for (int index = length; index >= 0; --index) bit(static_cast<uint32_t>((coded >> index) & 1));
+    }
+
+    void se(int32_t value)
+    {
+      ue(value > 0 ? static_cast<uint32_t>(value) * 2 - 1 : static_cast<uint32_t>(-value) * 2);
+    }
+
+    // rbsp_trailing_bits
+    Bytes finish()
+    {
+      bit(1);
+      while (0 != (bits_ & 7)) bit(0);
+      return bytes_;
+    }
+
+  private:
+    Bytes bytes_;
+    size_t bits_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // Inserts emulation_prevention_three_byte wherever the RBSP would
+  // otherwise contain a start code prefix.
+  Bytes escape(const Bytes &rbsp)
+  {
+    Bytes result;
+    size_t zeros = 0;
+    for (auto value : rbsp) {
+      if ((zeros >= 2) && (value <= 3)) {
+        result.push_back(3);
+        zeros = 0;
+      }
+      zeros = (0 == value ? zeros + 1 : 0);
+      result.push_back(value);
+    }
+    return result;
+  }
+
+  bool contains(const Bytes &data, const Bytes &pattern)
+  {
+    return data.end() != std::search(data.begin(), data.end(), pattern.begin(), pattern.end());
+  }
+
+  //---------------------------------------------------------------------------
+  struct SpsParams
+  {
+    uint32_t profileIdc {66};
+    uint32_t constraintFlags {0x30};
+    uint32_t levelIdc {31};
+    uint32_t spsId {};
+    uint32_t chromaFormatIdc {1};
+    bool scalingMatrix {};
+    uint32_t picOrderCntType {};
+    uint32_t widthInMbs {80};
+    uint32_t heightInMapUnits {45};
+    bool frameMbsOnly {true};
+    uint32_t cropLeft {}, cropRight {}, cropTop {}, cropBottom {};
+  };
+
+  // Returns the escaped SPS NAL unit including its header byte.
+  Bytes makeSps(const SpsParams &params)
+  {
+    BitWriter writer;
+    writer.bits(params.profileIdc, 8);
+    writer.bits(params.constraintFlags << 2, 8);
+    writer.bits(params.levelIdc, 8);
+    writer.ue(params.spsId);
+    if (params.profileIdc >= 100) {
+      writer.ue(params.chromaFormatIdc);
+      if (3 == params.chromaFormatIdc) writer.bit(0);     // separate_colour_plane_flag
+      writer.ue(0);                                       // bit_depth_luma_minus8
+      writer.ue(0);                                       // bit_depth_chroma_minus8
+      writer.bit(0);                                      // qpprime_y_zero_transform_bypass_flag
+      writer.bit(params.scalingMatrix ? 1 : 0);
+      if (params.scalingMatrix) {
+        int lists = (3 != params.chromaFormatIdc ? 8 : 12);
+        for (int index = 0; index < lists; ++index) {
+          bool present = (0 == (index & 1));
+          writer.bit(present ? 1 : 0);
+          if (!present) continue;
+          int size = (index < 6 ? 16 : 64);
+          for (int coefficient = 0; coefficient < size; ++coefficient) {
+            writer.se(0 == coefficient ? 8 : 1);              // delta_scale
+          }
+        }
+      }
+    }
+    writer.ue(0);                                         // log2_max_frame_num_minus4
+    writer.ue(params.picOrderCntType);
+    if (0 == params.picOrderCntType) {
+      writer.ue(2);                                       // log2_max_pic_order_cnt_lsb_minus4
+    } else if (1 == params.picOrderCntType) {
+      writer.bit(0);                                      // delta_pic_order_always_zero_flag
+      writer.se(-2);                                      // offset_for_non_ref_pic
+      writer.se(1);                                       // offset_for_top_to_bottom_field
+      writer.ue(2);                                       // num_ref_frames_in_pic_order_cnt_cycle
+      writer.se(3);
+      writer.se(-3);
+    }
+    writer.ue(1);                                         // max_num_ref_frames
+    writer.bit(0);                                        // gaps_in_frame_num_value_allowed_flag
+    writer.ue(params.widthInMbs - 1);
+    writer.ue(params.heightInMapUnits - 1);
+    writer.bit(params.frameMbsOnly ? 1 : 0);
+    if (!params.frameMbsOnly) writer.bit(0);              // mb_adaptive_frame_field_flag
+    writer.bit(1);                                        // direct_8x8_inference_flag
+    bool cropping = (0 != (params.cropLeft | params.cropRight | params.cropTop | params.cropBottom));
+    writer.bit(cropping ? 1 : 0);
+    if (cropping) {
+      writer.ue(params.cropLeft);
+      writer.ue(params.cropRight);
+      writer.ue(params.cropTop);
+      writer.ue(params.cropBottom);
+    }
+    writer.bit(0);                                        // vui_parameters_present_flag
+
+    Bytes nal {0x67};
+    auto payload = escape(writer.finish());
+    nal.insert(nal.end(), payload.begin(), payload.end());
+    return nal;
+  }
+
+  //---------------------------------------------------------------------------
+  void append(Bytes &stream, const Bytes &nal, bool longPrefix = true)
+  {
+    if (longPrefix) stream.push_back(0);
+    stream.insert(stream.end(), {0, 0, 1});
+    stream.insert(stream.end(), nal.begin(), nal.end());
+  }
+
+  const Bytes kAud {0x09, 0xF0};
+  const Bytes kPps {0x68, 0xCE, 0x38, 0x80};
+  const Bytes kIdrSlice {0x65, 0x88, 0x84, 0x00, 0x33, 0xFF};
+  const Bytes kSlice {0x41, 0x9A, 0x02, 0x0C, 0x3F};
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, FindsThreeAndFourByteStartCodes)
+{
+  const Bytes data {0xAA, 0x00, 0x00, 0x01, 0x67, 0x00, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00};
+  size_t prefixLength {};
+
+  EXPECT_EQ(1u, H264Bitstream::findStartCode(data.data(), data.size(), 0, prefixLength));
+  EXPECT_EQ(3u, prefixLength);
+
+  EXPECT_EQ(5u, H264Bitstream::findStartCode(data.data(), data.size(), 4, prefixLength));
+  EXPECT_EQ(4u, prefixLength);
+
+  // a trailing 00 00 with no 01 is not a start code
+  EXPECT_EQ(data.size(), H264Bitstream::findStartCode(data.data(), data.size(), 9, prefixLength));
+  EXPECT_EQ(0u, prefixLength);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, FourByteStartCodeDoesNotReachBeforeOffset)
+{
+  const Bytes data {0x00, 0x00, 0x00, 0x01, 0x09};
+  size_t prefixLength {};
+
+  EXPECT_EQ(1u, H264Bitstream::findStartCode(data.data(), data.size(), 1, prefixLength));
+  EXPECT_EQ(3u, prefixLength);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, FindStartCodeHandlesShortAndMissingInput)
+{
+  size_t prefixLength {};
+  const Bytes data {0x00, 0x00, 0x01};
+
+  EXPECT_EQ(0u, H264Bitstream::findStartCode(nullptr, 0, 0, prefixLength));
+  EXPECT_EQ(2u, H264Bitstream::findStartCode(data.data(), 2, 0, prefixLength));
+  EXPECT_EQ(0u, H264Bitstream::findStartCode(data.data(), 3, 0, prefixLength));
+  EXPECT_EQ(3u, prefixLength);
+  EXPECT_EQ(3u, H264Bitstream::findStartCode(data.data(), 3, 1, prefixLength));
+  EXPECT_EQ(3u, H264Bitstream::findStartCode(data.data(), 3, 100, prefixLength));
+  EXPECT_EQ(0u, prefixLength);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, FindsStartCodesInLongRuns)
+{
+  // long zero runs and stray 0x01 bytes around the real start code
+  Bytes data(4096, 0x00);
+  data[100] = 0x01;
+  data[101] = 0x01;
+  data[3000] = 0x01;
+  data[3001] = 0x41;
+
+  size_t prefixLength {};
+  EXPECT_EQ(97u, H264Bitstream::findStartCode(data.data(), data.size(), 0, prefixLength));
+  EXPECT_EQ(4u, prefixLength);
+  EXPECT_EQ(2997u, H264Bitstream::findStartCode(data.data(), data.size(), 101, prefixLength));
+  EXPECT_EQ(4u, prefixLength);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, IteratesNalUnits)
+{
+  SpsParams params;
+  auto sps = makeSps(params);
+
+  Bytes stream;
+  append(stream, kAud);
+  append(stream, sps, false);
+  append(stream, kPps);
+  append(stream, kIdrSlice, false);
+
+  std::vector<H264Bitstream::NalUnit> units;
+  size_t offset = 0;
+  H264Bitstream::NalUnit unit;
+  while (H264Bitstream::nextNalUnit(stream.data(), stream.size(), offset, unit)) {
+    units.push_back(unit);
+  }
+  EXPECT_EQ(stream.size(), offset);
+
+  ASSERT_EQ(4u, units.size());
+  EXPECT_EQ(H264Bitstream::NalUnitType_AUD, units[0].type_);
+  EXPECT_EQ(H264Bitstream::NalUnitType_SPS, units[1].type_);
+  EXPECT_EQ(H264Bitstream::NalUnitType_PPS, units[2].type_);
+  EXPECT_EQ(H264Bitstream::NalUnitType_IDR, units[3].type_);
+
+  // the zero of a following four byte start code is not part of the unit
+  EXPECT_EQ(kAud.size(), units[0].length_);
+  EXPECT_EQ(sps.size(), units[1].length_);
+  EXPECT_EQ(kPps.size(), units[2].length_);
+  EXPECT_EQ(kIdrSlice.size(), units[3].length_);
+  EXPECT_EQ(0, memcmp(units[1].data_, sps.data(), sps.size()));
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, NextNalUnitStopsAtEmptyTrailingStartCode)
+{
+  Bytes stream;
+  append(stream, kSlice);
+  stream.insert(stream.end(), {0x00, 0x00, 0x01});
+
+  size_t offset = 0;
+  H264Bitstream::NalUnit unit;
+  ASSERT_TRUE(H264Bitstream::nextNalUnit(stream.data(), stream.size(), offset, unit));
+  EXPECT_EQ(kSlice.size(), unit.length_);
+  EXPECT_FALSE(H264Bitstream::nextNalUnit(stream.data(), stream.size(), offset, unit));
+  EXPECT_EQ(stream.size(), offset);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, ParsesBaselineSps)
+{
+  SpsParams params;
+  auto sps = makeSps(params);
+
+  H264Bitstream::SpsInfo info;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(66, info.profileIdc_);
+  EXPECT_EQ(0x30, info.constraintFlags_);
+  EXPECT_EQ(31, info.levelIdc_);
+  EXPECT_EQ(1280, info.width_);
+  EXPECT_EQ(720, info.height_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, AppliesFrameCropping)
+{
+  // 1920x1088 coded, cropped to 1080 in 4:2:0 crop units of two lines
+  SpsParams params;
+  params.profileIdc = 100;
+  params.widthInMbs = 120;
+  params.heightInMapUnits = 68;
+  params.cropBottom = 4;
+  auto sps = makeSps(params);
+
+  H264Bitstream::SpsInfo info;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(1920, info.width_);
+  EXPECT_EQ(1080, info.height_);
+
+  // odd sizes: crop units are two pixels across and down
+  params.widthInMbs = 40;
+  params.heightInMapUnits = 30;
+  params.cropLeft = 1;
+  params.cropRight = 2;
+  params.cropTop = 3;
+  params.cropBottom = 1;
+  sps = makeSps(params);
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(640 - 6, info.width_);
+  EXPECT_EQ(480 - 8, info.height_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, AppliesCropUnitsForChromaFormatAndFields)
+{
+  SpsParams params;
+  params.profileIdc = 244;
+  params.widthInMbs = 20;
+  params.heightInMapUnits = 15;
+  params.cropRight = 3;
+  params.cropBottom = 5;
+
+  // 4:0:0 (monochrome) crops in single pixels
+  params.chromaFormatIdc = 0;
+  auto sps = makeSps(params);
+  H264Bitstream::SpsInfo info;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(320 - 3, info.width_);
+  EXPECT_EQ(240 - 5, info.height_);
+
+  // 4:4:4 crops in single pixels
+  params.chromaFormatIdc = 3;
+  sps = makeSps(params);
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(320 - 3, info.width_);
+  EXPECT_EQ(240 - 5, info.height_);
+
+  // 4:2:2 crops two pixels across and one down
+  params.chromaFormatIdc = 2;
+  sps = makeSps(params);
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(320 - 6, info.width_);
+  EXPECT_EQ(240 - 5, info.height_);
+
+  // field coding doubles the map unit height and the vertical crop unit
+  params.chromaFormatIdc = 1;
+  params.frameMbsOnly = false;
+  sps = makeSps(params);
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(320 - 6, info.width_);
+  EXPECT_EQ(480 - 20, info.height_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, SkipsScalingListsAndPicOrderCycle)
+{
+  SpsParams params;
+  params.profileIdc = 100;
+  params.scalingMatrix = true;
+  params.picOrderCntType = 1;
+  params.widthInMbs = 45;
+  params.heightInMapUnits = 36;
+  auto sps = makeSps(params);
+
+  H264Bitstream::SpsInfo info;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(720, info.width_);
+  EXPECT_EQ(576, info.height_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, RemovesEmulationPreventionBytes)
+{
+  // a zero constraint byte and level followed by a long Exp-Golomb code put
+  // three zero bytes in a row into the RBSP
+  SpsParams params;
+  params.constraintFlags = 0;
+  params.levelIdc = 0;
+  params.spsId = 255;
+  params.widthInMbs = 256;
+  params.heightInMapUnits = 256;
+  auto sps = makeSps(params);
+  ASSERT_TRUE(contains(sps, {0x00, 0x00, 0x03}));
+
+  H264Bitstream::SpsInfo info;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+  EXPECT_EQ(0, info.constraintFlags_);
+  EXPECT_EQ(0, info.levelIdc_);
+  EXPECT_EQ(4096, info.width_);
+  EXPECT_EQ(4096, info.height_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, RejectsInvalidSps)
+{
+  H264Bitstream::SpsInfo info;
+  SpsParams params;
+  auto sps = makeSps(params);
+
+  // not an SPS header
+  auto pps = sps;
+  pps[0] = 0x68;
+  EXPECT_FALSE(H264Bitstream::parseSps(pps.data(), pps.size(), info));
+  EXPECT_FALSE(H264Bitstream::parseSps(nullptr, 10, info));
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), 1, info));
+
+  // chroma_format_idc out of range
+  params.profileIdc = 100;
+  params.chromaFormatIdc = 4;
+  sps = makeSps(params);
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+
+  // pic_order_cnt_type out of range
+  params = SpsParams();
+  params.picOrderCntType = 3;
+  sps = makeSps(params);
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+
+  // larger than the macroblock limit
+  params = SpsParams();
+  params.widthInMbs = 1025;
+  sps = makeSps(params);
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+
+  // cropped away entirely
+  params = SpsParams();
+  params.widthInMbs = 2;
+  params.cropLeft = 8;
+  params.cropRight = 8;
+  sps = makeSps(params);
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), sps.size(), info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, TruncatedSpsNeverParsesWrongly)
+{
+  SpsParams params;
+  params.profileIdc = 100;
+  params.scalingMatrix = true;
+  params.widthInMbs = 120;
+  params.heightInMapUnits = 68;
+  params.cropBottom = 4;
+  auto sps = makeSps(params);
+
+  H264Bitstream::SpsInfo full;
+  ASSERT_TRUE(H264Bitstream::parseSps(sps.data(), sps.size(), full));
+
+  // a prefix either fails or, once it holds every field read, matches
+  for (size_t length = 0; length < sps.size(); ++length) {
+    Bytes prefix(sps.begin(), sps.begin() + length);
+    H264Bitstream::SpsInfo info;
+    if (!H264Bitstream::parseSps(prefix.data(), prefix.size(), info)) continue;
+    EXPECT_EQ(full.width_, info.width_) << "length " << length;
+    EXPECT_EQ(full.height_, info.height_) << "length " << length;
+  }
+
+  // far more than the whole header is needed
+  H264Bitstream::SpsInfo info;
+  EXPECT_FALSE(H264Bitstream::parseSps(sps.data(), 8, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, InspectsAccessUnits)
+{
+  SpsParams params;
+  params.widthInMbs = 40;
+  params.heightInMapUnits = 23;
+  params.cropBottom = 4;
+
+  Bytes keyFrame;
+  append(keyFrame, kAud);
+  append(keyFrame, makeSps(params));
+  append(keyFrame, kPps);
+  append(keyFrame, kIdrSlice);
+
+  auto info = H264Bitstream::inspect(keyFrame.data(), keyFrame.size());
+  EXPECT_TRUE(info.isIDR_);
+  ASSERT_TRUE(info.hasSps_);
+  EXPECT_EQ(640, info.sps_.width_);
+  EXPECT_EQ(360, info.sps_.height_);
+
+  Bytes deltaFrame;
+  append(deltaFrame, kAud);
+  append(deltaFrame, kSlice);
+  // anything after the first slice is never read
+  append(deltaFrame, makeSps(params));
+
+  info = H264Bitstream::inspect(deltaFrame.data(), deltaFrame.size());
+  EXPECT_FALSE(info.isIDR_);
+  EXPECT_FALSE(info.hasSps_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, InspectToleratesTruncatedAccessUnits)
+{
+  SpsParams params;
+  Bytes keyFrame;
+  append(keyFrame, makeSps(params));
+  append(keyFrame, kPps);
+  append(keyFrame, kIdrSlice);
+
+  for (size_t length = 0; length <= keyFrame.size(); ++length) {
+    Bytes prefix(keyFrame.begin(), keyFrame.begin() + length);
+    auto info = H264Bitstream::inspect(prefix.data(), prefix.size());
+    if (info.hasSps_) {
+      EXPECT_EQ(1280, info.sps_.width_);
+      EXPECT_EQ(720, info.sps_.height_);
+    }
+    if (length == keyFrame.size()) {
+      EXPECT_TRUE(info.isIDR_);
+    }
+  }
+
+  auto info = H264Bitstream::inspect(nullptr, 0);
+  EXPECT_FALSE(info.isIDR_);
+  EXPECT_FALSE(info.hasSps_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(H264BitstreamTest, ToleratesGarbage)
+{
+  std::mt19937 random(20181);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<size_t> size(0, 512);
+
+  for (int round = 0; round < 2000; ++round) {
+    Bytes data(size(random));
+    for (auto &value : data) {
+      // bias towards the bytes that make up start codes and escapes
+      int choice = byte(random);
+      value = static_cast<uint8_t>(choice < 96 ? 0x00 : (choice < 128 ? (choice & 3) : byte(random)));
+    }
+    if ((round & 1) && (!data.empty())) data[0] = 0x67;
+
+    H264Bitstream::SpsInfo sps;
+    if (H264Bitstream::parseSps(data.data(), data.size(), sps)) {
+      EXPECT_GT(sps.width_, 0);
+      EXPECT_GT(sps.height_, 0);
+      EXPECT_LE(sps.width_, 16 * 1024);
+      EXPECT_LE(sps.height_, 32 * 1024);
+    }
+
+    size_t offset = 0;
+    size_t total = 0;
+    H264Bitstream::NalUnit unit;
+    while (H264Bitstream::nextNalUnit(data.data(), data.size(), offset, unit)) {
+      ASSERT_GE(unit.data_, data.data());
+      ASSERT_LE(unit.data_ + unit.length_, data.data() + data.size());
+      total += unit.length_;
+    }
+    EXPECT_LE(total, data.size());
+
+    auto info = H264Bitstream::inspect(data.data(), data.size());
+    if (info.hasSps_) {
+      EXPECT_GT(info.sps_.width_, 0);
+      EXPECT_GT(info.sps_.height_, 0);
+    }
+  }
+}
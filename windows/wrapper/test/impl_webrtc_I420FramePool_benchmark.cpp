@@ -0,0 +1,132 @@
+
+#include <wrapper/impl_webrtc_I420FramePool.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/convert.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+  typedef std::function<rtc::scoped_refptr<I420Buffer>(int, int)> Allocate;
+
+  const int kFrames = 1200;
+  const size_t kFramesInFlight = 3;   // held further down the pipeline, as by an encoder
+
+  const int kSizes[][2] = {{640, 480}, {1280, 720}, {1920, 1080}};
+
+  //---------------------------------------------------------------------------
+  // An NV12 camera frame as the capture device hands it over.
+  struct CameraFrame
+  {
+    CameraFrame(int width, int height) :
+      width_(width),
+      height_(height),
+      bytes_((width * height) + (2 * ((width + 1) / 2) * ((height + 1) / 2)))
+    {
+      for (size_t index = 0; index < bytes_.size(); ++index) {
+        bytes_[index] = static_cast<uint8_t>(index * 7);
+      }
+    }
+
+    const uint8_t *y() const { return bytes_.data(); }
+    const uint8_t *uv() const { return bytes_.data() + (width_ * height_); }
+    int strideUV() const { return 2 * ((width_ + 1) / 2); }
+
+    int width_ {};
+    int height_ {};
+    std::vector<uint8_t> bytes_;
+  };
+
+  //---------------------------------------------------------------------------
+  long minorFaults()
+  {
+#if defined(__linux__)
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+#else
+    return 0;
+#endif
+  }
+
+  struct Result
+  {
+    double usPerFrame_ {};
+    double faultsPerFrame_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // Converts every camera frame into a buffer from the allocator, the way
+  // VideoCapturer::OnIncomingFrame does, keeping the last few frames alive.
+  Result run(const CameraFrame &camera, const Allocate &allocate)
+  {
+    std::deque< rtc::scoped_refptr<I420Buffer> > inFlight;
+
+    const long faults = minorFaults();
+    auto start = Clock::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+      auto buffer = allocate(camera.width_, camera.height_);
+      libyuv::NV12ToI420(
+        camera.y(), camera.width_,
+        camera.uv(), camera.strideUV(),
+        buffer->MutableDataY(), buffer->StrideY(),
+        buffer->MutableDataU(), buffer->StrideU(),
+        buffer->MutableDataV(), buffer->StrideV(),
+        camera.width_, camera.height_);
+
+      inFlight.push_back(buffer);
+      if (inFlight.size() > kFramesInFlight) inFlight.pop_front();
+    }
+
+    Result result;
+    result.usPerFrame_ = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kFrames;
+    result.faultsPerFrame_ = static_cast<double>(minorFaults() - faults) / kFrames;
+    return result;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Compares a fresh I420Buffer per captured frame with buffers recycled by
+// I420FramePool, converting synthetic NV12 frames at common capture sizes.
+int main()
+{
+  printf("%d frames, %zu held in flight\n", kFrames, kFramesInFlight);
+  printf("%-10s %12s %12s %14s %14s %8s %8s\n", "size", "fresh us", "pooled us", "fresh faults", "pooled faults", "hits", "misses");
+
+  for (auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+    CameraFrame camera(width, height);
+
+    auto pool = I420FramePool::create();
+    pool->configure(width, height);
+
+    auto fresh = run(camera, [](int width, int height) { return I420Buffer::Create(width, height); });
+    auto pooled = run(camera, [pool](int width, int height) { return pool->createBuffer(width, height, width, (width + 1) / 2, (width + 1) / 2); });
+
+    auto stats = pool->stats();
+    printf("%4dx%-5d %12.1f %12.1f %14.1f %14.1f %8llu %8llu\n",
+           width,
+           height,
+           fresh.usPerFrame_,
+           pooled.usPerFrame_,
+           fresh.faultsPerFrame_,
+           pooled.faultsPerFrame_,
+           static_cast<unsigned long long>(stats.hits_),
+           static_cast<unsigned long long>(stats.misses_));
+  }
+  return 0;
+}
@@ -0,0 +1,217 @@
+
+#include <wrapper/impl_webrtc_I420FramePool.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  rtc::scoped_refptr<I420Buffer> create(I420FramePool &pool, int width, int height)
+  {
+    return pool.createBuffer(width, height, width, (width + 1) / 2, (width + 1) / 2);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, ReusesReleasedBuffers)
+{
+  auto pool = I420FramePool::create();
+
+  auto buffer = create(*pool, 640, 480);
+  const I420Buffer *first = buffer.get();
+  buffer = nullptr;
+
+  buffer = create(*pool, 640, 480);
+  EXPECT_EQ(first, buffer.get());
+
+  auto stats = pool->stats();
+  EXPECT_EQ(1u, stats.hits_);
+  EXPECT_EQ(1u, stats.misses_);
+  EXPECT_EQ(1u, stats.pooledBuffers_);
+  EXPECT_EQ(1u, stats.buffersInUse_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, NeverHandsOutReferencedBuffers)
+{
+  auto pool = I420FramePool::create();
+
+  auto first = create(*pool, 320, 240);
+  auto second = create(*pool, 320, 240);
+  EXPECT_NE(first.get(), second.get());
+
+  // a frame still holding the buffer keeps it out of reuse
+  auto held = first;
+  first = nullptr;
+  auto third = create(*pool, 320, 240);
+  EXPECT_NE(held.get(), third.get());
+  EXPECT_NE(second.get(), third.get());
+
+  auto stats = pool->stats();
+  EXPECT_EQ(0u, stats.hits_);
+  EXPECT_EQ(3u, stats.misses_);
+  EXPECT_EQ(3u, stats.buffersInUse_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, AllocatesOneOffBuffersBeyondTheLimit)
+{
+  auto pool = I420FramePool::create(2);
+
+  std::vector<rtc::scoped_refptr<I420Buffer> > buffers;
+  for (int index = 0; index < 3; ++index) {
+    buffers.push_back(create(*pool, 64, 48));
+    ASSERT_TRUE(buffers.back());
+  }
+
+  auto stats = pool->stats();
+  EXPECT_EQ(3u, stats.misses_);
+  EXPECT_EQ(2u, stats.pooledBuffers_);
+  EXPECT_EQ(2u, stats.buffersInUse_);
+
+  // only the pooled buffers come back
+  buffers.clear();
+  for (int index = 0; index < 3; ++index) {
+    buffers.push_back(create(*pool, 64, 48));
+  }
+
+  stats = pool->stats();
+  EXPECT_EQ(2u, stats.hits_);
+  EXPECT_EQ(4u, stats.misses_);
+  EXPECT_EQ(2u, stats.pooledBuffers_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, RecyclesSteadyCaptureWithoutAllocating)
+{
+  // a capturer keeping up to three frames in flight settles on three
+  // buffers and then never allocates again
+  auto pool = I420FramePool::create();
+
+  std::vector<rtc::scoped_refptr<I420Buffer> > inFlight;
+  for (int frame = 0; frame < 300; ++frame) {
+    inFlight.push_back(create(*pool, 1280, 720));
+    if (inFlight.size() > 2) inFlight.erase(inFlight.begin());
+  }
+
+  auto stats = pool->stats();
+  EXPECT_EQ(3u, stats.misses_);
+  EXPECT_EQ(297u, stats.hits_);
+  EXPECT_EQ(3u, stats.pooledBuffers_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, DiscardsIdleBuffersOfOtherLayouts)
+{
+  auto pool = I420FramePool::create();
+
+  auto buffer = create(*pool, 640, 480);
+  auto held = create(*pool, 640, 480);
+  buffer = nullptr;
+
+  // a different stride does not match; the idle buffer is dropped
+  buffer = pool->createBuffer(640, 480, 656, 328, 328);
+  EXPECT_EQ(656, buffer->StrideY());
+
+  auto stats = pool->stats();
+  EXPECT_EQ(0u, stats.hits_);
+  EXPECT_EQ(3u, stats.misses_);
+  EXPECT_EQ(2u, stats.pooledBuffers_);
+  buffer = nullptr;
+
+  // a new capture format drops idle buffers of the old size but leaves the
+  // ones frames still reference
+  pool->configure(1280, 720);
+  stats = pool->stats();
+  EXPECT_EQ(1u, stats.pooledBuffers_);
+  EXPECT_EQ(1u, stats.buffersInUse_);
+
+  held = nullptr;
+  auto resized = create(*pool, 1280, 720);
+  stats = pool->stats();
+  EXPECT_EQ(0u, stats.hits_);
+  EXPECT_EQ(1u, stats.pooledBuffers_);
+  EXPECT_EQ(1280, resized->width());
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, ReusesNV12BuffersAlongside)
+{
+  auto pool = I420FramePool::create();
+
+  auto nv12 = pool->createNV12Buffer(640, 480);
+  auto i420 = create(*pool, 640, 480);
+  const NV12Buffer *first = nv12.get();
+  nv12 = nullptr;
+
+  nv12 = pool->createNV12Buffer(640, 480);
+  EXPECT_EQ(first, nv12.get());
+  EXPECT_NE(static_cast<const I420BufferInterface *>(i420.get()), static_cast<const I420BufferInterface *>(nv12.get()));
+
+  auto stats = pool->stats();
+  EXPECT_EQ(1u, stats.hits_);
+  EXPECT_EQ(2u, stats.misses_);
+  EXPECT_EQ(2u, stats.pooledBuffers_);
+  EXPECT_EQ(2u, stats.buffersInUse_);
+
+  nv12 = nullptr;
+  nv12 = pool->createNV12Buffer(320, 240);
+  EXPECT_EQ(320, nv12->width());
+  EXPECT_EQ(3u, pool->stats().misses_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, ReleaseDropsOnlyIdleBuffers)
+{
+  auto pool = I420FramePool::create();
+
+  auto held = create(*pool, 64, 48);
+  auto idle = create(*pool, 64, 48);
+  auto heldNV12 = pool->createNV12Buffer(64, 48);
+  idle = nullptr;
+
+  pool->release();
+
+  auto stats = pool->stats();
+  EXPECT_EQ(2u, stats.pooledBuffers_);
+  EXPECT_EQ(2u, stats.buffersInUse_);
+
+  held = nullptr;
+  heldNV12 = nullptr;
+  pool->release();
+  EXPECT_EQ(0u, pool->stats().pooledBuffers_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(I420FramePoolTest, HandsEachBufferToOneFrameAcrossThreads)
+{
+  auto pool = I420FramePool::create(4);
+  std::atomic<int> collisions {0};
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([&, thread]() {
+      for (int frame = 0; frame < 2000; ++frame) {
+        auto buffer = create(*pool, 32, 16);
+        const uint8_t mark = static_cast<uint8_t>(thread + 1);
+        buffer->MutableDataY()[0] = mark;
+        std::this_thread::yield();
+        if (mark != buffer->DataY()[0]) ++collisions;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  EXPECT_EQ(0, collisions.load());
+  auto stats = pool->stats();
+  EXPECT_EQ(8000u, stats.hits_ + stats.misses_);
+  EXPECT_EQ(0u, stats.buffersInUse_);
+  EXPECT_LE(stats.pooledBuffers_, 4u);
+}
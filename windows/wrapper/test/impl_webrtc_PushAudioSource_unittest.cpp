@@ -0,0 +1,399 @@
+
+#include <wrapper/impl_webrtc_PushAudioSource.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const auto kWaitTimeout = std::chrono::seconds(5);
+
+  //---------------------------------------------------------------------------
+  PushAudioSource::CreationProperties properties(int sampleRateHz = 48000, size_t channels = 1)
+  {
+    PushAudioSource::CreationProperties props;
+    props.sampleRateHz_ = sampleRateHz;
+    props.channels_ = channels;
+    return props;
+  }
+
+  //---------------------------------------------------------------------------
+  // Interleaved samples of a constant value per channel.
+  std::vector<int16_t> constant(size_t samplesPerChannel, std::vector<int16_t> values)
+  {
+    std::vector<int16_t> samples;
+    for (size_t index = 0; index < samplesPerChannel; ++index) {
+      samples.insert(samples.end(), values.begin(), values.end());
+    }
+    return samples;
+  }
+
+  //---------------------------------------------------------------------------
+  bool push(PushAudioSource &source, int sampleRateHz, size_t milliseconds, std::vector<int16_t> values = {1000})
+  {
+    const size_t samplesPerChannel = static_cast<size_t>(sampleRateHz) * milliseconds / 1000;
+    auto samples = constant(samplesPerChannel, values);
+    return source.pushAudio(samples.data(), samplesPerChannel, sampleRateHz, values.size());
+  }
+
+  //---------------------------------------------------------------------------
+  // Keeps every frame the pacing thread delivers so the test can wait for
+  // and inspect them.
+  class RecordingSink : public AudioTrackSinkInterface
+  {
+  public:
+    struct Frame
+    {
+      int bitsPerSample_ {};
+      int sampleRateHz_ {};
+      size_t channels_ {};
+      size_t samplesPerChannel_ {};
+      std::vector<int16_t> samples_;
+      Clock::time_point at_;
+    };
+
+    void OnData(
+                const void *audio,
+                int bitsPerSample,
+                int sampleRateHz,
+                size_t channels,
+                size_t samplesPerChannel
+                ) override
+    {
+      Frame frame;
+      frame.bitsPerSample_ = bitsPerSample;
+      frame.sampleRateHz_ = sampleRateHz;
+      frame.channels_ = channels;
+      frame.samplesPerChannel_ = samplesPerChannel;
+      auto samples = static_cast<const int16_t *>(audio);
+      frame.samples_.assign(samples, samples + (samplesPerChannel * channels));
+      frame.at_ = Clock::now();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frames_.push_back(std::move(frame));
+      }
+      received_.notify_all();
+
+      if (onData_) onData_();
+    }
+
+    // waits until a frame matches, returning false after a timeout
+    bool waitFor(std::function<bool(const std::vector<Frame> &)> done)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      return received_.wait_for(lock, kWaitTimeout, [this, &done]() { return done(frames_); });
+    }
+
+    bool waitForFrames(size_t count)
+    {
+      return waitFor([count](const std::vector<Frame> &frames) { return frames.size() >= count; });
+    }
+
+    bool waitForAudio(Frame &outFrame)
+    {
+      return waitFor([&outFrame](const std::vector<Frame> &frames) {
+        for (auto &frame : frames) {
+          for (auto sample : frame.samples_) {
+            if (0 == sample) continue;
+            outFrame = frame;
+            return true;
+          }
+        }
+        return false;
+      });
+    }
+
+    std::function<void()> onData_;
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable received_;
+    std::vector<Frame> frames_;
+  };
+
+  //---------------------------------------------------------------------------
+  // Records the order in which sinks are called.
+  struct CallOrder
+  {
+    void called(const std::string &name)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        names_.push_back(name);
+      }
+      changed_.notify_all();
+    }
+
+    std::vector<std::string> waitFor(size_t count)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      changed_.wait_for(lock, kWaitTimeout, [this, count]() { return names_.size() >= count; });
+      return std::vector<std::string>(names_.begin(), names_.begin() + std::min(count, names_.size()));
+    }
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<std::string> names_;
+  };
+
+  //---------------------------------------------------------------------------
+  class NamedSink : public AudioTrackSinkInterface
+  {
+  public:
+    NamedSink(const std::string &name, CallOrder &order) : name_(name), order_(order) {}
+
+    void OnData(const void *, int, int, size_t, size_t) override
+    {
+      order_.called(name_);
+      if (onData_) onData_();
+    }
+
+    std::function<void()> onData_;
+
+  private:
+    std::string name_;
+    CallOrder &order_;
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, RejectsUnsupportedFormats)
+{
+  EXPECT_FALSE(PushAudioSource::create(properties(44150)));
+  EXPECT_FALSE(PushAudioSource::create(properties(4000)));
+  EXPECT_FALSE(PushAudioSource::create(properties(48000, 0)));
+  EXPECT_FALSE(PushAudioSource::create(properties(48000, 3)));
+
+  auto source = PushAudioSource::create(properties());
+  ASSERT_TRUE(source);
+
+  int16_t samples[480] {};
+  EXPECT_FALSE(source->pushAudio(samples, 220, 22050, 1));
+  EXPECT_FALSE(source->pushAudio(samples, 40, 4000, 1));
+  EXPECT_FALSE(source->pushAudio(samples, 480, 48000, 0));
+  EXPECT_FALSE(source->pushAudio(static_cast<const int16_t *>(nullptr), 480, 48000, 1));
+
+  auto stats = source->stats();
+  EXPECT_EQ(4u, stats.rejectedPushes_);
+  EXPECT_EQ(0u, stats.pushedSamples_);
+  EXPECT_EQ(0u, stats.queuedFrames_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, PrebuffersBeforePlayoutAndAfterAnUnderrun)
+{
+  auto source = PushAudioSource::create(properties());
+
+  // prebuffering two frames by default
+  ASSERT_TRUE(push(*source, 48000, 10));
+  source->deliverFrame();
+  EXPECT_EQ(1u, source->stats().silentFrames_);
+  EXPECT_EQ(0u, source->stats().deliveredFrames_);
+
+  ASSERT_TRUE(push(*source, 48000, 10));
+  source->deliverFrame();
+  source->deliverFrame();
+  EXPECT_EQ(2u, source->stats().deliveredFrames_);
+  EXPECT_EQ(0u, source->stats().underruns_);
+
+  // starving counts one underrun however long it lasts
+  source->deliverFrame();
+  source->deliverFrame();
+  auto stats = source->stats();
+  EXPECT_EQ(1u, stats.underruns_);
+  EXPECT_EQ(3u, stats.silentFrames_);
+
+  // and playout waits for the prebuffer again
+  ASSERT_TRUE(push(*source, 48000, 10));
+  source->deliverFrame();
+  EXPECT_EQ(4u, source->stats().silentFrames_);
+  ASSERT_TRUE(push(*source, 48000, 10));
+  source->deliverFrame();
+  EXPECT_EQ(3u, source->stats().deliveredFrames_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, DropsTheOldestFramesWhenFull)
+{
+  auto props = properties();
+  props.maxQueuedFrames_ = 3;
+  auto source = PushAudioSource::create(props);
+
+  ASSERT_TRUE(push(*source, 48000, 50));
+  auto stats = source->stats();
+  EXPECT_EQ(3u, stats.queuedFrames_);
+  EXPECT_EQ(2u, stats.overflows_);
+  EXPECT_EQ(2400u, stats.pushedSamples_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, RechunksAnyRateIntoOutputFrames)
+{
+  auto source = PushAudioSource::create(properties());
+
+  ASSERT_TRUE(push(*source, 16000, 10));
+  EXPECT_EQ(1u, source->stats().queuedFrames_);
+
+  // half a block waits for the other half
+  ASSERT_TRUE(push(*source, 16000, 5));
+  EXPECT_EQ(1u, source->stats().queuedFrames_);
+  ASSERT_TRUE(push(*source, 16000, 5));
+  EXPECT_EQ(2u, source->stats().queuedFrames_);
+
+  // odd sized pushes add up
+  for (int index = 0; index < 3; ++index) {
+    ASSERT_TRUE(source->pushAudio(constant(147, {1000}).data(), 147, 44100, 1));
+  }
+  EXPECT_EQ(3u, source->stats().queuedFrames_);
+  EXPECT_EQ(320u + (3 * 147), source->stats().pushedSamples_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, ChangingRateDiscardsAPartialBlock)
+{
+  auto source = PushAudioSource::create(properties());
+
+  ASSERT_TRUE(push(*source, 16000, 5));
+  ASSERT_TRUE(push(*source, 32000, 5));
+  EXPECT_EQ(0u, source->stats().queuedFrames_);
+
+  ASSERT_TRUE(push(*source, 32000, 5));
+  EXPECT_EQ(1u, source->stats().queuedFrames_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, PacesTenMillisecondFrames)
+{
+  auto source = PushAudioSource::create(properties(16000));
+  ASSERT_TRUE(push(*source, 16000, 200));
+
+  RecordingSink sink;
+  source->AddSink(&sink);
+  ASSERT_TRUE(sink.waitForFrames(11));
+  source->RemoveSink(&sink);
+
+  // removal waited for any delivery, so nothing arrives afterwards
+  std::vector<RecordingSink::Frame> frames;
+  sink.waitFor([&frames](const std::vector<RecordingSink::Frame> &received) { frames = received; return true; });
+
+  for (auto &frame : frames) {
+    EXPECT_EQ(16, frame.bitsPerSample_);
+    EXPECT_EQ(16000, frame.sampleRateHz_);
+    EXPECT_EQ(1u, frame.channels_);
+    EXPECT_EQ(160u, frame.samplesPerChannel_);
+  }
+
+  // ten frame periods cannot pass in less than 100ms; allow for the pacing
+  // thread waking a little early
+  EXPECT_GE(frames[10].at_ - frames[0].at_, std::chrono::milliseconds(90));
+
+  auto stats = source->stats();
+  EXPECT_EQ(frames.size(), stats.deliveredFrames_ + stats.silentFrames_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, RemixesToTheOutputChannels)
+{
+  auto mono = PushAudioSource::create(properties(48000, 1));
+  ASSERT_TRUE(push(*mono, 48000, 50, {1000, 3000}));
+
+  RecordingSink monoSink;
+  mono->AddSink(&monoSink);
+  RecordingSink::Frame frame;
+  ASSERT_TRUE(monoSink.waitForAudio(frame));
+  mono->RemoveSink(&monoSink);
+  EXPECT_EQ(1u, frame.channels_);
+  EXPECT_EQ(2000, frame.samples_.front());
+  EXPECT_EQ(2000, frame.samples_.back());
+
+  auto stereo = PushAudioSource::create(properties(48000, 2));
+  ASSERT_TRUE(push(*stereo, 48000, 50, {1500}));
+
+  RecordingSink stereoSink;
+  stereo->AddSink(&stereoSink);
+  ASSERT_TRUE(stereoSink.waitForAudio(frame));
+  stereo->RemoveSink(&stereoSink);
+  EXPECT_EQ(2u, frame.channels_);
+  EXPECT_EQ((std::vector<int16_t> {1500, 1500}), std::vector<int16_t>(frame.samples_.begin(), frame.samples_.begin() + 2));
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, ConvertsFloatSamples)
+{
+  auto source = PushAudioSource::create(properties());
+  std::vector<float> samples(2400, 0.5f);
+  ASSERT_TRUE(source->pushAudio(samples.data(), samples.size(), 48000, 1));
+
+  RecordingSink sink;
+  source->AddSink(&sink);
+  RecordingSink::Frame frame;
+  ASSERT_TRUE(sink.waitForAudio(frame));
+  source->RemoveSink(&sink);
+
+  EXPECT_NEAR(16384, frame.samples_.front(), 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, SinkRemovingItselfDoesNotSkipTheNext)
+{
+  auto source = PushAudioSource::create(properties());
+
+  CallOrder order;
+  NamedSink first("first", order);
+  NamedSink second("second", order);
+  NamedSink third("third", order);
+  first.onData_ = [&source, &first]() { source->RemoveSink(&first); };
+
+  source->AddSink(&first);
+  source->AddSink(&second);
+  source->AddSink(&third);
+
+  auto calls = order.waitFor(5);
+  source->RemoveSink(&second);
+  source->RemoveSink(&third);
+
+  EXPECT_EQ((std::vector<std::string> {"first", "second", "third", "second", "third"}), calls);
+}
+
+//-----------------------------------------------------------------------------
+TEST(PushAudioSourceTest, LastReferenceCanBeDroppedInsideOnData)
+{
+  auto source = PushAudioSource::create(properties());
+
+  RecordingSink sink;
+  std::mutex mutex;
+  std::condition_variable released;
+  bool done = false;
+
+  // the sink holds the only reference and lets go of it on the pacing
+  // thread, as a track closed from inside its own audio callback would
+  sink.onData_ = [&]() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!source) return;
+    source->RemoveSink(&sink);
+    source = nullptr;
+    done = true;
+    released.notify_all();
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    source->AddSink(&sink);
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  EXPECT_TRUE(released.wait_for(lock, kWaitTimeout, [&done]() { return done; }));
+}
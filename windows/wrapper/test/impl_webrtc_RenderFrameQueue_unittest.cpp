@@ -0,0 +1,277 @@
+
+#include <wrapper/impl_webrtc_RenderFrameQueue.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <thread>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef RenderFrameQueue<int> Queue;
+
+  const bool kKey = true;
+  const bool kDelta = false;
+
+  //---------------------------------------------------------------------------
+  Queue::Options options(
+                         Queue::LatencyMode latencyMode,
+                         Queue::KeyFramePolicy keyFramePolicy,
+                         size_t smoothFrames = 3
+                         )
+  {
+    Queue::Options result;
+    result.latencyMode_ = latencyMode;
+    result.keyFramePolicy_ = keyFramePolicy;
+    result.smoothFrames_ = smoothFrames;
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  bool push(Queue &queue, int value, bool isKeyFrame)
+  {
+    return queue.push(std::make_unique<int>(value), isKeyFrame);
+  }
+
+  //---------------------------------------------------------------------------
+  // Everything the consumer can take right now.
+  std::vector<int> drain(Queue &queue)
+  {
+    std::vector<int> values;
+    while (auto value = queue.pop()) {
+      values.push_back(*value);
+    }
+    return values;
+  }
+
+  //---------------------------------------------------------------------------
+  // Pushes increasing values on one thread while another pops; returns
+  // whether the consumer only ever saw values in increasing order.
+  bool producerAndConsumer(Queue &queue, int frames)
+  {
+    bool ordered = true;
+    std::thread consumer([&queue, &ordered, frames]() {
+      int last = -1;
+      while (last < frames - 1) {
+        auto value = queue.pop();
+        if (!value) {
+          std::this_thread::yield();
+          continue;
+        }
+        if (*value <= last) ordered = false;
+        last = *value;
+      }
+    });
+
+    for (int value = 0; value < frames - 1; ++value) {
+      push(queue, value, kKey);
+    }
+
+    // the last frame is retried until accepted so the consumer sees it
+    while (!push(queue, frames - 1, kKey)) {
+      std::this_thread::yield();
+    }
+
+    consumer.join();
+    return ordered;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, SmoothDeliversInOrder)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_SkipToLatestKeyFrame));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+  EXPECT_TRUE(push(queue, 2, kDelta));
+  EXPECT_TRUE(push(queue, 3, kDelta));
+  EXPECT_EQ(3u, queue.stats().depth_);
+
+  EXPECT_EQ((std::vector<int> {1, 2, 3}), drain(queue));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(0u, stats.depth_);
+  EXPECT_EQ(3u, stats.pushed_);
+  EXPECT_EQ(3u, stats.delivered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, NothingRendersBeforeTheFirstKeyFrame)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_None));
+
+  EXPECT_FALSE(push(queue, 1, kDelta));
+  EXPECT_FALSE(queue.receivedKeyFrame());
+  EXPECT_FALSE(queue.pop());
+
+  EXPECT_TRUE(push(queue, 2, kKey));
+  EXPECT_TRUE(queue.receivedKeyFrame());
+  EXPECT_TRUE(push(queue, 3, kDelta));
+
+  EXPECT_EQ((std::vector<int> {2, 3}), drain(queue));
+  EXPECT_EQ(1u, queue.stats().awaitingKeyFrame_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, SmoothWithoutPolicyOnlyDropsTheOverflow)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_None, 2));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+  EXPECT_TRUE(push(queue, 2, kDelta));
+  EXPECT_FALSE(push(queue, 3, kDelta));
+
+  // room again, and deltas are not held back
+  EXPECT_EQ(1, *queue.pop());
+  EXPECT_TRUE(push(queue, 4, kDelta));
+  EXPECT_EQ((std::vector<int> {2, 4}), drain(queue));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(1u, stats.overflowed_);
+  EXPECT_EQ(0u, stats.awaitingKeyFrame_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, WaitForKeyFrameDropsDeltasAfterAnOverflow)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_WaitForKeyFrame, 2));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+  EXPECT_TRUE(push(queue, 2, kDelta));
+  EXPECT_FALSE(push(queue, 3, kDelta));
+
+  // the queue has room but the next delta references the dropped frame
+  EXPECT_EQ(1, *queue.pop());
+  EXPECT_FALSE(push(queue, 4, kDelta));
+  EXPECT_TRUE(push(queue, 5, kKey));
+
+  // frames ahead of the key frame are still rendered
+  EXPECT_EQ((std::vector<int> {2, 5}), drain(queue));
+  EXPECT_TRUE(push(queue, 6, kDelta));
+  EXPECT_TRUE(push(queue, 7, kDelta));
+  EXPECT_EQ((std::vector<int> {6, 7}), drain(queue));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(1u, stats.overflowed_);
+  EXPECT_EQ(1u, stats.awaitingKeyFrame_);
+  EXPECT_EQ(0u, stats.skipped_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, SkipToLatestKeyFrameDiscardsFramesAheadOfIt)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_SkipToLatestKeyFrame));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+  EXPECT_TRUE(push(queue, 2, kDelta));
+  EXPECT_TRUE(push(queue, 3, kKey));
+
+  EXPECT_EQ((std::vector<int> {3}), drain(queue));
+  EXPECT_EQ(2u, queue.stats().skipped_);
+  EXPECT_EQ(1u, queue.stats().delivered_);
+
+  // a frame already taken is never skipped
+  EXPECT_TRUE(push(queue, 4, kDelta));
+  EXPECT_EQ(4, *queue.pop());
+  EXPECT_TRUE(push(queue, 5, kKey));
+  EXPECT_EQ((std::vector<int> {5}), drain(queue));
+  EXPECT_EQ(2u, queue.stats().skipped_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, LatestFrameWins)
+{
+  Queue queue(options(Queue::LatencyMode_LatestFrame, Queue::KeyFramePolicy_None));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+  EXPECT_TRUE(push(queue, 2, kDelta));
+  EXPECT_TRUE(push(queue, 3, kDelta));
+  EXPECT_EQ(1u, queue.stats().depth_);
+
+  EXPECT_EQ((std::vector<int> {3}), drain(queue));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(0u, stats.depth_);
+  EXPECT_EQ(2u, stats.replaced_);
+  EXPECT_EQ(1u, stats.delivered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, LatestFrameKeepsAFrameADeltaDependsOn)
+{
+  Queue queue(options(Queue::LatencyMode_LatestFrame, Queue::KeyFramePolicy_WaitForKeyFrame));
+
+  EXPECT_TRUE(push(queue, 1, kKey));
+
+  // replacing the undelivered key frame would break the delta chain
+  EXPECT_FALSE(push(queue, 2, kDelta));
+  EXPECT_EQ(1, *queue.pop());
+  EXPECT_FALSE(push(queue, 3, kDelta));
+
+  // a key frame replaces anything pending
+  EXPECT_TRUE(push(queue, 4, kKey));
+  EXPECT_TRUE(push(queue, 5, kKey));
+  EXPECT_EQ((std::vector<int> {5}), drain(queue));
+
+  // a delta after a delivered frame is taken
+  EXPECT_TRUE(push(queue, 6, kDelta));
+  EXPECT_EQ((std::vector<int> {6}), drain(queue));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(1u, stats.overflowed_);
+  EXPECT_EQ(1u, stats.awaitingKeyFrame_);
+  EXPECT_EQ(1u, stats.replaced_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, RejectsAnEmptyFrame)
+{
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_None));
+  EXPECT_FALSE(queue.push(Queue::ValueUniPtr(), kKey));
+  EXPECT_EQ(0u, queue.stats().pushed_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, UndeliveredFramesAreReleased)
+{
+  // run under a leak checker; the queue owns whatever was never popped
+  Queue smooth(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_None));
+  push(smooth, 1, kKey);
+  push(smooth, 2, kKey);
+
+  Queue latest(options(Queue::LatencyMode_LatestFrame, Queue::KeyFramePolicy_None));
+  push(latest, 1, kKey);
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, SmoothAcrossThreads)
+{
+  const int kFrames = 200000;
+  Queue queue(options(Queue::LatencyMode_Smooth, Queue::KeyFramePolicy_None));
+
+  EXPECT_TRUE(producerAndConsumer(queue, kFrames));
+
+  // every frame was either delivered or counted as dropped
+  auto stats = queue.stats();
+  EXPECT_EQ(0u, stats.depth_);
+  EXPECT_EQ(stats.pushed_, stats.delivered_ + stats.overflowed_);
+  EXPECT_GE(stats.pushed_, static_cast<uint64_t>(kFrames));
+}
+
+//-----------------------------------------------------------------------------
+TEST(RenderFrameQueueTest, LatestFrameAcrossThreads)
+{
+  const int kFrames = 200000;
+  Queue queue(options(Queue::LatencyMode_LatestFrame, Queue::KeyFramePolicy_None));
+
+  EXPECT_TRUE(producerAndConsumer(queue, kFrames));
+
+  auto stats = queue.stats();
+  EXPECT_EQ(0u, stats.depth_);
+  EXPECT_EQ(static_cast<uint64_t>(kFrames), stats.pushed_);
+  EXPECT_EQ(stats.pushed_, stats.delivered_ + stats.replaced_);
+}
@@ -0,0 +1,159 @@
+
+#include <wrapper/impl_webrtc_VideoCaptureCrop.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <random>
+#include <string>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoCaptureCrop Crop;
+  typedef Crop::Rect Rect;
+
+  //---------------------------------------------------------------------------
+  Rect rect(int x, int y, int width, int height)
+  {
+    Rect result;
+    result.x_ = x;
+    result.y_ = y;
+    result.width_ = width;
+    result.height_ = height;
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  std::string toString(const Rect &value)
+  {
+    return std::to_string(value.x_) + "," + std::to_string(value.y_) + " " + std::to_string(value.width_) + "x" + std::to_string(value.height_);
+  }
+
+  //---------------------------------------------------------------------------
+  ::testing::AssertionResult rectEqual(const Rect &expected, const Rect &actual)
+  {
+    if ((expected.x_ == actual.x_) &&
+        (expected.y_ == actual.y_) &&
+        (expected.width_ == actual.width_) &&
+        (expected.height_ == actual.height_))
+      return ::testing::AssertionSuccess();
+    return ::testing::AssertionFailure() << toString(actual) << " != " << toString(expected);
+  }
+
+  //---------------------------------------------------------------------------
+  class VideoCaptureCropTest : public ::testing::Test
+  {
+  protected:
+    Rect resolve(const Rect &area, int aspectRatioWidth, int aspectRatioHeight, int width, int height)
+    {
+      Crop::Options options;
+      options.rect_ = area;
+      options.aspectRatioWidth_ = aspectRatioWidth;
+      options.aspectRatioHeight_ = aspectRatioHeight;
+      crop_->setOptions(options);
+      return crop_->resolve(width, height);
+    }
+
+    VideoCaptureCropPtr crop_ {Crop::create()};
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, EmptyOptionsSelectTheWholeFrame)
+{
+  EXPECT_TRUE(rectEqual(rect(0, 0, 640, 480), crop_->resolve(640, 480)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 640, 480), resolve(rect(0, 0, 0, 100), 0, 0, 640, 480)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 640, 480), resolve(Rect(), 16, 0, 640, 480)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, OptionsAreKept)
+{
+  resolve(rect(10, 20, 30, 40), 4, 3, 640, 480);
+
+  auto options = crop_->options();
+  EXPECT_TRUE(rectEqual(rect(10, 20, 30, 40), options.rect_));
+  EXPECT_EQ(4, options.aspectRatioWidth_);
+  EXPECT_EQ(3, options.aspectRatioHeight_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, RectIsClippedToTheFrame)
+{
+  EXPECT_TRUE(rectEqual(rect(100, 50, 200, 100), resolve(rect(100, 50, 200, 100), 0, 0, 640, 480)));
+  EXPECT_TRUE(rectEqual(rect(600, 400, 40, 80), resolve(rect(600, 400, 100, 100), 0, 0, 640, 480)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 90, 80), resolve(rect(-10, -20, 100, 100), 0, 0, 640, 480)));
+
+  // a rect entirely outside the frame leaves the whole frame
+  EXPECT_TRUE(rectEqual(rect(0, 0, 640, 480), resolve(rect(700, 0, 10, 10), 0, 0, 640, 480)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 640, 480), resolve(rect(-50, -50, 50, 50), 0, 0, 640, 480)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, OddOriginAndSizeAreEvened)
+{
+  EXPECT_TRUE(rectEqual(rect(2, 4, 100, 50), resolve(rect(3, 5, 101, 51), 0, 0, 640, 480)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 636, 478), resolve(Rect(), 0, 0, 637, 479)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, AspectRatioTrimsAroundTheCenter)
+{
+  // too wide
+  EXPECT_TRUE(rectEqual(rect(280, 0, 720, 720), resolve(Rect(), 1, 1, 1280, 720)));
+  EXPECT_TRUE(rectEqual(rect(160, 0, 960, 720), resolve(Rect(), 4, 3, 1280, 720)));
+
+  // too tall; 405 rows centered start on row 437, both evened
+  EXPECT_TRUE(rectEqual(rect(0, 436, 720, 404), resolve(Rect(), 16, 9, 720, 1280)));
+
+  // already matching
+  EXPECT_TRUE(rectEqual(rect(0, 0, 1280, 720), resolve(Rect(), 16, 9, 1280, 720)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, AspectRatioAppliesWithinTheRect)
+{
+  EXPECT_TRUE(rectEqual(rect(150, 100, 200, 200), resolve(rect(100, 100, 300, 200), 1, 1, 640, 480)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, TinyFramesAreLeftAlone)
+{
+  EXPECT_TRUE(rectEqual(rect(0, 0, 1, 1), resolve(rect(0, 0, 1, 1), 1, 1, 1, 1)));
+  EXPECT_TRUE(rectEqual(rect(0, 0, 1, 480), resolve(Rect(), 16, 9, 1, 480)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoCaptureCropTest, ResultAlwaysFitsTheFrame)
+{
+  std::mt19937 random(30);
+  std::uniform_int_distribution<int> size(2, 400);
+  std::uniform_int_distribution<int> position(-100, 500);
+  std::uniform_int_distribution<int> ratio(0, 20);
+
+  for (int iteration = 0; iteration < 20000; ++iteration) {
+    const int width = size(random);
+    const int height = size(random);
+    const Rect area = rect(position(random), position(random), position(random), position(random));
+    auto result = resolve(area, ratio(random), ratio(random), width, height);
+
+    SCOPED_TRACE(toString(area) + " in " + std::to_string(width) + "x" + std::to_string(height) + " gave " + toString(result));
+    ASSERT_GE(result.x_, 0);
+    ASSERT_GE(result.y_, 0);
+    ASSERT_GT(result.width_, 0);
+    ASSERT_GT(result.height_, 0);
+    ASSERT_LE(result.x_ + result.width_, width);
+    ASSERT_LE(result.y_ + result.height_, height);
+    ASSERT_EQ(0, result.x_ % 2);
+    ASSERT_EQ(0, result.y_ % 2);
+    if (result.width_ > 1) {
+      ASSERT_EQ(0, result.width_ % 2);
+    }
+    if (result.height_ > 1) {
+      ASSERT_EQ(0, result.height_ % 2);
+    }
+  }
+}
@@ -0,0 +1,198 @@
+
+#include <wrapper/impl_webrtc_VideoCaptureLoadMonitor.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+using namespace webrtc;
+
+namespace
+{
+  const int64_t kIntervalUs = 33333;    // 30fps
+  const int64_t kStartUs = 1000000;
+
+  //---------------------------------------------------------------------------
+  // Feeds frames spending the given fraction of the frame interval each from
+  // nowUs for durationMs; returns the first decision other than none, and
+  // leaves nowUs at the frame that made it.
+  class Feeder
+  {
+  public:
+    explicit Feeder(VideoCaptureLoadMonitor &monitor) : monitor_(monitor) {}
+
+    VideoCaptureLoadMonitor::Decision feed(float load, int durationMs)
+    {
+      const int64_t endUs = nowUs_ + (static_cast<int64_t>(durationMs) * 1000);
+      while (nowUs_ < endUs) {
+        nowUs_ += kIntervalUs;
+        auto decision = monitor_.onFrame(static_cast<int64_t>(load * kIntervalUs), kIntervalUs, nowUs_);
+        if (VideoCaptureLoadMonitor::Decision_None != decision) return decision;
+      }
+      return VideoCaptureLoadMonitor::Decision_None;
+    }
+
+    int64_t nowUs_ {kStartUs};
+
+  private:
+    VideoCaptureLoadMonitor &monitor_;
+  };
+
+  VideoCaptureLoadMonitorPtr createEnabled()
+  {
+    auto monitor = VideoCaptureLoadMonitor::create();
+    VideoCaptureLoadMonitor::Options options;
+    options.enabled_ = true;
+    monitor->setOptions(options);
+    return monitor;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, DecidesNothingWhenDisabled)
+{
+  auto monitor = VideoCaptureLoadMonitor::create();
+  Feeder feeder(*monitor);
+
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(2.0f, 30000));
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(0.0f, 30000));
+  EXPECT_EQ(0.0f, monitor->stats().load_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, StepsDownAfterSustainedOveruse)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+
+  // measurements start once the capture has settled
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(1.5f, VideoCaptureLoadMonitor::kSettleMs - 50));
+  EXPECT_EQ(0.0f, monitor->stats().load_);
+
+  const int64_t settledUs = feeder.nowUs_;
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_StepDown, feeder.feed(1.5f, 10000));
+
+  // after the overuse period, not before
+  const int64_t decidedMs = (feeder.nowUs_ - settledUs) / 1000;
+  EXPECT_GE(decidedMs, monitor->options().overuseMs_);
+  EXPECT_LE(decidedMs, monitor->options().overuseMs_ + 200);
+  EXPECT_NEAR(1.5f, monitor->stats().load_, 0.01f);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, StepsUpOnlyAfterTheLongerUnderusePeriod)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+
+  feeder.feed(0.1f, VideoCaptureLoadMonitor::kSettleMs);
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(0.1f, monitor->options().underuseMs_ - 500));
+
+  const int64_t beforeUs = feeder.nowUs_;
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_StepUp, feeder.feed(0.1f, 2000));
+  EXPECT_LE((feeder.nowUs_ - beforeUs) / 1000, 1000);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, LoadBetweenThresholdsHoldsTheFormat)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(0.6f, 60000));
+  EXPECT_NEAR(0.6f, monitor->stats().load_, 0.01f);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, SmoothsOverShortSpikes)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+  feeder.feed(0.6f, VideoCaptureLoadMonitor::kSettleMs + 2000);
+
+  // a single slow frame every second never lifts the smoothed load over
+  // the threshold
+  for (int second = 0; second < 20; ++second) {
+    EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(3.0f, 1));
+    EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(0.6f, 1000));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, InterruptedOveruseStartsOver)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+  feeder.feed(0.6f, VideoCaptureLoadMonitor::kSettleMs);
+
+  for (int round = 0; round < 5; ++round) {
+    // overloaded briefly enough that the smoothed load, which lags behind,
+    // is back under the threshold before the overuse period has passed
+    EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(1.5f, 1000));
+    EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(0.6f, 3000));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, SettlesAgainAfterEachStep)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+
+  feeder.feed(0.6f, VideoCaptureLoadMonitor::kSettleMs);
+  ASSERT_EQ(VideoCaptureLoadMonitor::Decision_StepDown, feeder.feed(1.5f, 10000));
+  monitor->onStepped(VideoCaptureLoadMonitor::Decision_StepDown);
+
+  // the load is forgotten and frames right after the restart are ignored
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(1.5f, VideoCaptureLoadMonitor::kSettleMs - 50));
+  EXPECT_EQ(0.0f, monitor->stats().load_);
+
+  // still overloaded at the lower format: another full period before the
+  // next step
+  const int64_t settledUs = feeder.nowUs_;
+  ASSERT_EQ(VideoCaptureLoadMonitor::Decision_StepDown, feeder.feed(1.5f, 10000));
+  EXPECT_GE((feeder.nowUs_ - settledUs) / 1000, monitor->options().overuseMs_);
+  monitor->onStepped(VideoCaptureLoadMonitor::Decision_StepDown);
+
+  monitor->onStepped(VideoCaptureLoadMonitor::Decision_None);
+  auto stats = monitor->stats();
+  EXPECT_EQ(2u, stats.stepsDown_);
+  EXPECT_EQ(0u, stats.stepsUp_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, ResetAndReenablingSettleAgain)
+{
+  auto monitor = createEnabled();
+  Feeder feeder(*monitor);
+  feeder.feed(1.5f, VideoCaptureLoadMonitor::kSettleMs + 1500);
+
+  monitor->reset();
+  EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, feeder.feed(1.5f, VideoCaptureLoadMonitor::kSettleMs - 50));
+
+  // changing only the thresholds keeps the measured load
+  feeder.feed(1.5f, 500);
+  auto options = monitor->options();
+  options.overuseLoad_ = 0.9f;
+  monitor->setOptions(options);
+  feeder.feed(1.5f, 100);
+  EXPECT_GT(monitor->stats().load_, 1.0f);
+
+  // toggling it off and on forgets it
+  options.enabled_ = false;
+  monitor->setOptions(options);
+  options.enabled_ = true;
+  monitor->setOptions(options);
+  feeder.feed(1.5f, 100);
+  EXPECT_EQ(0.0f, monitor->stats().load_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoCaptureLoadMonitorTest, IgnoresFramesWithoutAnInterval)
+{
+  auto monitor = createEnabled();
+  for (int64_t nowUs = kStartUs; nowUs < kStartUs + 20000000; nowUs += kIntervalUs) {
+    EXPECT_EQ(VideoCaptureLoadMonitor::Decision_None, monitor->onFrame(kIntervalUs * 2, 0, nowUs));
+  }
+  EXPECT_EQ(0.0f, monitor->stats().load_);
+}
@@ -0,0 +1,281 @@
+
+#include <wrapper/impl_webrtc_VideoChangeDetector.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/video_common.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoChangeDetector Detector;
+  typedef Detector::Rect Rect;
+  typedef Detector::SourceLayout SourceLayout;
+
+  //---------------------------------------------------------------------------
+  // A captured sample and the layout describing it, filled with a pattern
+  // so no two blocks hash alike.
+  struct Sample
+  {
+    Sample(uint32_t fourcc, int width, int height, size_t length)
+    {
+      layout_.fourcc_ = fourcc;
+      layout_.width_ = width;
+      layout_.height_ = height;
+      layout_.alignedWidth_ = width;
+      layout_.alignedHeight_ = height;
+      layout_.length_ = length;
+      bytes_.resize(length);
+      for (size_t index = 0; index < bytes_.size(); ++index) {
+        bytes_[index] = static_cast<uint8_t>(index * 7);
+      }
+    }
+
+    static Sample i420(int width, int height)
+    {
+      return Sample(libyuv::FOURCC_I420, width, height, (width * height) + (2 * ((width + 1) / 2) * ((height + 1) / 2)));
+    }
+
+    static Sample nv12(int width, int height)
+    {
+      return Sample(libyuv::FOURCC_NV12, width, height, (width * height) + (width * ((height + 1) / 2)));
+    }
+
+    uint8_t &luma(int x, int y) { return bytes_[(y * layout_.width_) + x]; }
+    uint8_t &chroma(size_t planeOffset, int stride, int x, int y) { return bytes_[planeOffset + (y * stride) + x]; }
+
+    Rect full() const
+    {
+      Rect result;
+      result.width_ = layout_.width_;
+      result.height_ = layout_.height_;
+      return result;
+    }
+
+    SourceLayout layout_;
+    std::vector<uint8_t> bytes_;
+  };
+
+  //---------------------------------------------------------------------------
+  Rect rect(int x, int y, int width, int height)
+  {
+    Rect result;
+    result.x_ = x;
+    result.y_ = y;
+    result.width_ = width;
+    result.height_ = height;
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  void expectRect(const Rect &expected, const Rect &actual)
+  {
+    EXPECT_EQ(expected.x_, actual.x_);
+    EXPECT_EQ(expected.y_, actual.y_);
+    EXPECT_EQ(expected.width_, actual.width_);
+    EXPECT_EQ(expected.height_, actual.height_);
+  }
+
+  //---------------------------------------------------------------------------
+  class VideoChangeDetectorTest : public ::testing::Test
+  {
+  protected:
+    void enable(float keepAliveFramerate = 0)
+    {
+      Detector::Options options;
+      options.enabled_ = true;
+      options.keepAliveFramerate_ = keepAliveFramerate;
+      detector_->setOptions(options);
+    }
+
+    bool examine(const Sample &sample, int64_t nowUs = 0)
+    {
+      return examine(sample, sample.full(), nowUs);
+    }
+
+    bool examine(const Sample &sample, const Rect &crop, int64_t nowUs = 0)
+    {
+      return detector_->examine(sample.bytes_.data(), sample.layout_, crop, nowUs);
+    }
+
+    VideoChangeDetectorPtr detector_ {Detector::create()};
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, DisabledEmitsEveryFrame)
+{
+  auto sample = Sample::i420(64, 64);
+  EXPECT_TRUE(examine(sample));
+  EXPECT_TRUE(examine(sample));
+
+  auto stats = detector_->stats();
+  EXPECT_EQ(0u, stats.changed_);
+  EXPECT_EQ(0u, stats.unchanged_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, IdenticalFramesAreDropped)
+{
+  enable();
+  auto sample = Sample::i420(128, 96);
+
+  // the first frame has nothing to compare against
+  EXPECT_TRUE(examine(sample));
+  expectRect(sample.full(), detector_->stats().dirty_);
+
+  EXPECT_FALSE(examine(sample, 1000));
+  EXPECT_FALSE(examine(sample, 2000));
+
+  auto stats = detector_->stats();
+  EXPECT_EQ(1u, stats.changed_);
+  EXPECT_EQ(2u, stats.unchanged_);
+  EXPECT_EQ(0u, stats.keepAlive_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, LumaChangeDirtiesItsBlock)
+{
+  enable();
+  auto sample = Sample::i420(128, 96);
+  examine(sample);
+
+  ++sample.luma(70, 40);
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(64, 32, 32, 32), detector_->stats().dirty_);
+
+  // blocks at the edge are clipped to the crop window
+  ++sample.luma(127, 95);
+  ++sample.luma(0, 0);
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(0, 0, 128, 96), detector_->stats().dirty_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, ChromaOnlyChangeIsDetectedInI420)
+{
+  enable();
+  const int width = 128;
+  const int height = 96;
+  auto sample = Sample::i420(width, height);
+  const size_t uOffset = width * height;
+  const size_t vOffset = uOffset + ((width / 2) * (height / 2));
+  examine(sample);
+
+  // chroma pixel (40, 20) covers luma (80, 40)
+  ++sample.chroma(uOffset, width / 2, 40, 20);
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(64, 32, 32, 32), detector_->stats().dirty_);
+
+  ++sample.chroma(vOffset, width / 2, 5, 40);
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(0, 64, 32, 32), detector_->stats().dirty_);
+
+  EXPECT_FALSE(examine(sample));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, ChromaOnlyChangeIsDetectedInNV12)
+{
+  enable();
+  const int width = 128;
+  const int height = 96;
+  auto sample = Sample::nv12(width, height);
+  const size_t uvOffset = width * height;
+  examine(sample);
+
+  // the V sample of chroma pixel (40, 20)
+  ++sample.chroma(uvOffset, width, (2 * 40) + 1, 20);
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(64, 32, 32, 32), detector_->stats().dirty_);
+
+  EXPECT_FALSE(examine(sample));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, OddCropCoversItsChroma)
+{
+  enable();
+  const int width = 64;
+  const int height = 64;
+  auto sample = Sample::i420(width, height);
+  const size_t vOffset = (width * height) + ((width / 2) * (height / 2));
+  const Rect crop = rect(1, 1, 63, 63);
+  examine(sample, crop);
+
+  // the last chroma pixel of the frame still belongs to the crop window
+  ++sample.chroma(vOffset, width / 2, 31, 31);
+  EXPECT_TRUE(examine(sample, crop));
+  expectRect(rect(32, 32, 31, 31), detector_->stats().dirty_);
+
+  // outside the crop window luma is ignored
+  ++sample.luma(0, 0);
+  EXPECT_FALSE(examine(sample, crop));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, PackedFormatsHashByBlock)
+{
+  enable();
+  const int width = 64;
+  const int height = 64;
+  Sample sample(libyuv::FOURCC_ARGB, width, height, width * height * 4);
+  examine(sample);
+
+  // the alpha byte of pixel (40, 10)
+  ++sample.bytes_[(((10 * width) + 40) * 4) + 3];
+  EXPECT_TRUE(examine(sample));
+  expectRect(rect(32, 0, 32, 32), detector_->stats().dirty_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, CompressedFormatsHashAsAWhole)
+{
+  enable();
+  Sample sample(libyuv::FOURCC_MJPG, 320, 240, 5000);
+  examine(sample);
+  EXPECT_FALSE(examine(sample));
+
+  ++sample.bytes_[4999];
+  EXPECT_TRUE(examine(sample));
+  expectRect(sample.full(), detector_->stats().dirty_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, UnchangedFramesKeepTheStreamAlive)
+{
+  enable(10);
+  auto sample = Sample::i420(64, 64);
+
+  EXPECT_TRUE(examine(sample, 0));
+  EXPECT_FALSE(examine(sample, 50000));
+  EXPECT_TRUE(examine(sample, 100000));
+  EXPECT_FALSE(examine(sample, 150000));
+
+  auto stats = detector_->stats();
+  EXPECT_EQ(1u, stats.changed_);
+  EXPECT_EQ(1u, stats.keepAlive_);
+  EXPECT_EQ(2u, stats.unchanged_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoChangeDetectorTest, ResetAndNewGeometryEmitTheWholeFrame)
+{
+  enable();
+  auto sample = Sample::i420(128, 96);
+  examine(sample);
+
+  detector_->reset();
+  EXPECT_TRUE(examine(sample));
+  expectRect(sample.full(), detector_->stats().dirty_);
+  EXPECT_FALSE(examine(sample));
+
+  const Rect crop = rect(32, 32, 64, 32);
+  EXPECT_TRUE(examine(sample, crop));
+  expectRect(rect(0, 0, 64, 32), detector_->stats().dirty_);
+  EXPECT_FALSE(examine(sample, crop));
+}
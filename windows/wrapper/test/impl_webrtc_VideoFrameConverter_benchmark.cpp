@@ -0,0 +1,113 @@
+
+#include <wrapper/impl_webrtc_VideoFrameConverter.h>
+#include <wrapper/impl_webrtc_VideoWorkerPool.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/convert.h"
+#include "libyuv/video_common.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const int kFrames = 1000;
+
+  //---------------------------------------------------------------------------
+  size_t paddedLength(uint32_t fourcc, int alignedWidth, int alignedHeight, int height)
+  {
+    const size_t plane = static_cast<size_t>(alignedWidth) * alignedHeight;
+    switch (fourcc) {
+      case libyuv::FOURCC_I420:
+      case libyuv::FOURCC_NV12: return plane * 3 / 2;
+      case libyuv::FOURCC_YUY2: return static_cast<size_t>(alignedWidth) * 2 * height;
+      default:                  break;
+    }
+    return 0;
+  }
+
+  //---------------------------------------------------------------------------
+  // Milliseconds per frame of the given conversion, with refresh (which
+  // restores the sample for conversions that modify it) left untimed.
+  template <typename Refresh, typename Convert>
+  double measure(Refresh refresh, Convert convert)
+  {
+    Clock::duration total {};
+    for (int frame = 0; frame < kFrames; ++frame) {
+      refresh();
+      auto start = Clock::now();
+      convert();
+      total += Clock::now() - start;
+    }
+    return std::chrono::duration<double, std::milli>(total).count() / kFrames;
+  }
+
+  //---------------------------------------------------------------------------
+  void run(const char *name, uint32_t fourcc, int width, int height)
+  {
+    const int alignedWidth = (width + 15) & ~15;
+    const int alignedHeight = (height + 15) & ~15;
+
+    std::vector<uint8_t> original(paddedLength(fourcc, alignedWidth, alignedHeight, height));
+    for (size_t index = 0; index < original.size(); ++index) {
+      original[index] = static_cast<uint8_t>((index * 7) ^ (index >> 9));
+    }
+    std::vector<uint8_t> sample(original);
+
+    auto layout = VideoFrameConverter::describe(fourcc, width, height, sample.size());
+    auto dest = I420Buffer::Create(width, height);
+
+    auto noRefresh = []() {};
+    auto refresh = [&]() { memcpy(sample.data(), original.data(), original.size()); };
+
+    // what capture did before: compact the padding in place, then convert
+    double compactThenConvert = measure(refresh, [&]() {
+      auto compact = VideoFrameConverter::removePadding(sample.data(), layout);
+      libyuv::ConvertToI420(
+        sample.data(), compact.length_,
+        dest->MutableDataY(), dest->StrideY(),
+        dest->MutableDataU(), dest->StrideU(),
+        dest->MutableDataV(), dest->StrideV(),
+        0, 0, width, height, width, height,
+        libyuv::kRotate0, fourcc);
+    });
+
+    refresh();
+    double cropWindow = measure(noRefresh, [&]() {
+      VideoFrameConverter::convertToI420(sample.data(), layout, VideoFrameConverter::Rect{0, 0, width, height}, kVideoRotation_0, *dest, false);
+    });
+
+    double banded = measure(noRefresh, [&]() {
+      VideoFrameConverter::convertToI420(sample.data(), layout, VideoFrameConverter::Rect{0, 0, width, height}, kVideoRotation_0, *dest, true);
+    });
+
+    printf("%-5s %4dx%-4d  compact+convert %7.3f ms  crop window %7.3f ms (%5.1f%%)  banded %7.3f ms (%5.1f%%)\n",
+           name, width, height,
+           compactThenConvert,
+           cropWindow, 100.0 * (compactThenConvert - cropWindow) / compactThenConvert,
+           banded, 100.0 * (compactThenConvert - banded) / compactThenConvert);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Compares converting padded capture samples by compacting them first with
+// reading the visible area as a crop window, serially and in row bands.
+int main()
+{
+  printf("worker pool concurrency %d, %d frames each\n", VideoWorkerPool::concurrency(), kFrames);
+
+  const int sizes[][2] = { {640, 360}, {1366, 768}, {1920, 1080} };
+  for (auto &size : sizes) {
+    run("NV12", libyuv::FOURCC_NV12, size[0], size[1]);
+    run("I420", libyuv::FOURCC_I420, size[0], size[1]);
+    run("YUY2", libyuv::FOURCC_YUY2, size[0], size[1]);
+  }
+  return 0;
+}
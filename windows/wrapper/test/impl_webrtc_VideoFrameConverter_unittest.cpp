@@ -0,0 +1,470 @@
+
+#include <wrapper/impl_webrtc_VideoFrameConverter.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "libyuv/convert.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/video_common.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+  typedef VideoFrameConverter::Rect Rect;
+  typedef VideoFrameConverter::SourceLayout SourceLayout;
+
+  const uint32_t kFourccs[] = {
+    libyuv::FOURCC_I420,
+    libyuv::FOURCC_IYUV,
+    libyuv::FOURCC_YV12,
+    libyuv::FOURCC_NV12,
+    libyuv::FOURCC_NV21,
+    libyuv::FOURCC_YUY2,
+    libyuv::FOURCC_UYVY,
+    libyuv::FOURCC_24BG,
+    libyuv::FOURCC_RAW,
+    libyuv::FOURCC_ARGB,
+    libyuv::FOURCC_BGRA,
+    libyuv::FOURCC_ABGR,
+    libyuv::FOURCC_RGBA,
+  };
+
+  // the formats capture devices pad to a 16 pixel boundary
+  const uint32_t kPaddedFourccs[] = {
+    libyuv::FOURCC_I420,
+    libyuv::FOURCC_YV12,
+    libyuv::FOURCC_NV12,
+    libyuv::FOURCC_YUY2,
+    libyuv::FOURCC_24BG,
+    libyuv::FOURCC_ARGB,
+  };
+
+  const VideoRotation kRotations[] = {
+    kVideoRotation_0,
+    kVideoRotation_90,
+    kVideoRotation_180,
+    kVideoRotation_270,
+  };
+
+  //---------------------------------------------------------------------------
+  std::string name(uint32_t fourcc)
+  {
+    return std::string(reinterpret_cast<const char *>(&fourcc), 4);
+  }
+
+  int half(int value) { return (value + 1) / 2; }
+  int even(int value) { return (value + 1) & ~1; }
+  int align(int value, int alignment) { return ((value + alignment - 1) / alignment) * alignment; }
+
+  //---------------------------------------------------------------------------
+  // Bytes in an unpadded frame as libyuv lays it out; rows of interleaved
+  // chroma and packed 4:2:2 pixels round odd widths up.
+  size_t frameLength(uint32_t fourcc, int width, int height)
+  {
+    const size_t pixels = static_cast<size_t>(width) * height;
+    switch (libyuv::CanonicalFourCC(fourcc)) {
+      case libyuv::FOURCC_I420:
+      case libyuv::FOURCC_YV12: return pixels + (2 * static_cast<size_t>(half(width)) * half(height));
+      case libyuv::FOURCC_NV12:
+      case libyuv::FOURCC_NV21: return pixels + (static_cast<size_t>(even(width)) * half(height));
+      case libyuv::FOURCC_YUY2:
+      case libyuv::FOURCC_UYVY: return static_cast<size_t>(even(width)) * 2 * height;
+      case libyuv::FOURCC_24BG:
+      case libyuv::FOURCC_RAW:  return pixels * 3;
+      default:                  break;
+    }
+    return pixels * 4;
+  }
+
+  //---------------------------------------------------------------------------
+  Bytes randomBytes(size_t length, uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> byte(0, 255);
+    Bytes result(length);
+    for (auto &value : result) value = static_cast<uint8_t>(byte(random));
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  SourceLayout unpadded(uint32_t fourcc, int width, int height, size_t length)
+  {
+    SourceLayout layout;
+    layout.fourcc_ = fourcc;
+    layout.width_ = width;
+    layout.height_ = height;
+    layout.alignedWidth_ = width;
+    layout.alignedHeight_ = height;
+    layout.length_ = length;
+    return layout;
+  }
+
+  //---------------------------------------------------------------------------
+  rtc::scoped_refptr<I420Buffer> createDest(const Rect &crop, VideoRotation rotation)
+  {
+    bool swap = (kVideoRotation_90 == rotation) || (kVideoRotation_270 == rotation);
+    return I420Buffer::Create(swap ? crop.height_ : crop.width_, swap ? crop.width_ : crop.height_);
+  }
+
+  // What libyuv produces converting the same crop window of the unpadded
+  // frame directly.
+  rtc::scoped_refptr<I420Buffer> reference(
+                                           const Bytes &sample,
+                                           uint32_t fourcc,
+                                           int width,
+                                           int height,
+                                           const Rect &crop,
+                                           VideoRotation rotation
+                                           )
+  {
+    auto dest = createDest(crop, rotation);
+    int result = libyuv::ConvertToI420(
+      sample.data(), sample.size(),
+      dest->MutableDataY(), dest->StrideY(),
+      dest->MutableDataU(), dest->StrideU(),
+      dest->MutableDataV(), dest->StrideV(),
+      crop.x_, crop.y_,
+      width, height,
+      crop.width_, crop.height_,
+      static_cast<libyuv::RotationMode>(rotation),
+      fourcc);
+    EXPECT_EQ(0, result);
+    return dest;
+  }
+
+  //---------------------------------------------------------------------------
+  ::testing::AssertionResult planeEqual(
+                                        const char *plane,
+                                        const uint8_t *expected,
+                                        int expectedStride,
+                                        const uint8_t *actual,
+                                        int actualStride,
+                                        int width,
+                                        int height
+                                        )
+  {
+    for (int row = 0; row < height; ++row) {
+      if (0 == memcmp(expected + (row * expectedStride), actual + (row * actualStride), width)) continue;
+      for (int column = 0; column < width; ++column) {
+        if (expected[(row * expectedStride) + column] == actual[(row * actualStride) + column]) continue;
+        return ::testing::AssertionFailure() << plane << " plane differs at (" << column << ", " << row << ")";
+      }
+    }
+    return ::testing::AssertionSuccess();
+  }
+
+  ::testing::AssertionResult framesEqual(const I420BufferInterface &expected, const I420BufferInterface &actual)
+  {
+    if ((expected.width() != actual.width()) || (expected.height() != actual.height()))
+      return ::testing::AssertionFailure() << "size " << actual.width() << "x" << actual.height() << " != " << expected.width() << "x" << expected.height();
+
+    auto result = planeEqual("Y", expected.DataY(), expected.StrideY(), actual.DataY(), actual.StrideY(), expected.width(), expected.height());
+    if (result) result = planeEqual("U", expected.DataU(), expected.StrideU(), actual.DataU(), actual.StrideU(), expected.ChromaWidth(), expected.ChromaHeight());
+    if (result) result = planeEqual("V", expected.DataV(), expected.StrideV(), actual.DataV(), actual.StrideV(), expected.ChromaWidth(), expected.ChromaHeight());
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  // Copies the rows of each plane of an unpadded frame into a frame whose
+  // rows and planes are padded out to the alignment, as capture devices lay
+  // them out. Packed formats are only padded along their rows.
+  Bytes pad(const Bytes &sample, uint32_t fourcc, int width, int height, int alignment)
+  {
+    const int alignedWidth = align(width, alignment);
+    const int alignedHeight = align(height, alignment);
+
+    auto copyRows = [](Bytes &dest, size_t destOffset, int destStride, const Bytes &src, size_t srcOffset, int srcStride, int rowBytes, int rows) {
+      for (int row = 0; row < rows; ++row) {
+        memcpy(dest.data() + destOffset + (static_cast<size_t>(row) * destStride), src.data() + srcOffset + (static_cast<size_t>(row) * srcStride), rowBytes);
+      }
+    };
+
+    Bytes result;
+    switch (libyuv::CanonicalFourCC(fourcc)) {
+      case libyuv::FOURCC_I420:
+      case libyuv::FOURCC_YV12: {
+        const size_t planeSize = static_cast<size_t>(width) * height;
+        const size_t chromaSize = static_cast<size_t>(half(width)) * half(height);
+        const size_t alignedPlaneSize = static_cast<size_t>(alignedWidth) * alignedHeight;
+        const size_t alignedChromaSize = static_cast<size_t>(alignedWidth / 2) * (alignedHeight / 2);
+        result.resize(alignedPlaneSize + (2 * alignedChromaSize));
+        copyRows(result, 0, alignedWidth, sample, 0, width, width, height);
+        copyRows(result, alignedPlaneSize, alignedWidth / 2, sample, planeSize, half(width), half(width), half(height));
+        copyRows(result, alignedPlaneSize + alignedChromaSize, alignedWidth / 2, sample, planeSize + chromaSize, half(width), half(width), half(height));
+        break;
+      }
+      case libyuv::FOURCC_NV12: {
+        const size_t planeSize = static_cast<size_t>(width) * height;
+        const size_t alignedPlaneSize = static_cast<size_t>(alignedWidth) * alignedHeight;
+        result.resize(alignedPlaneSize + (static_cast<size_t>(alignedWidth) * (alignedHeight / 2)));
+        copyRows(result, 0, alignedWidth, sample, 0, width, width, height);
+        copyRows(result, alignedPlaneSize, alignedWidth, sample, planeSize, even(width), even(width), half(height));
+        break;
+      }
+      default: {
+        const int bytesPerPixel = static_cast<int>(frameLength(fourcc, 2, 1) / 2);
+        const int rowBytes = static_cast<int>(frameLength(fourcc, width, 1));
+        result.resize(static_cast<size_t>(alignedWidth) * bytesPerPixel * height);
+        copyRows(result, 0, alignedWidth * bytesPerPixel, sample, 0, rowBytes, rowBytes, height);
+        break;
+      }
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  void expectMatchesLibyuv(uint32_t fourcc, int width, int height, const Rect &crop, VideoRotation rotation, bool parallel)
+  {
+    SCOPED_TRACE(name(fourcc) + " " + std::to_string(width) + "x" + std::to_string(height) +
+                 " crop " + std::to_string(crop.x_) + "," + std::to_string(crop.y_) + " " + std::to_string(crop.width_) + "x" + std::to_string(crop.height_) +
+                 " rotation " + std::to_string(static_cast<int>(rotation)) + (parallel ? " parallel" : ""));
+
+    auto sample = randomBytes(frameLength(fourcc, width, height), fourcc ^ static_cast<uint32_t>(width * 31 + height));
+    auto expected = reference(sample, fourcc, width, height, crop, rotation);
+
+    auto actual = createDest(crop, rotation);
+    ASSERT_EQ(0, VideoFrameConverter::convertToI420(sample.data(), unpadded(fourcc, width, height, sample.size()), crop, rotation, *actual, parallel));
+    EXPECT_TRUE(framesEqual(*expected, *actual));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, MatchesLibyuvForEveryFormatAndRotation)
+{
+  for (auto fourcc : kFourccs) {
+    for (auto rotation : kRotations) {
+      expectMatchesLibyuv(fourcc, 64, 48, Rect{0, 0, 64, 48}, rotation, false);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, MatchesLibyuvForOddSizes)
+{
+  for (auto fourcc : kFourccs) {
+    for (auto rotation : kRotations) {
+      expectMatchesLibyuv(fourcc, 33, 17, Rect{0, 0, 33, 17}, rotation, false);
+      expectMatchesLibyuv(fourcc, 1, 1, Rect{0, 0, 1, 1}, rotation, false);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, MatchesLibyuvForCropWindows)
+{
+  const Rect crops[] = {
+    {2, 4, 40, 30},
+    {3, 5, 21, 9},
+    {0, 1, 63, 47},
+    {63, 47, 1, 1},
+  };
+
+  for (auto fourcc : kFourccs) {
+    for (auto &crop : crops) {
+      for (auto rotation : kRotations) {
+        expectMatchesLibyuv(fourcc, 64, 48, crop, rotation, false);
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, ConvertsLargeFramesInBandsLikeLibyuv)
+{
+  // tall enough for several bands whenever more than one core is present;
+  // only the height decides the banding
+  const Rect crops[] = {
+    {0, 0, 320, 1080},
+    {16, 40, 288, 1000},
+    {1, 2, 317, 1077},
+  };
+
+  for (auto fourcc : kFourccs) {
+    for (auto &crop : crops) {
+      for (auto rotation : kRotations) {
+        expectMatchesLibyuv(fourcc, 320, 1080, crop, rotation, true);
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, RejectsInvalidCropWindows)
+{
+  auto sample = randomBytes(frameLength(libyuv::FOURCC_I420, 64, 48), 1);
+  auto layout = unpadded(libyuv::FOURCC_I420, 64, 48, sample.size());
+  auto dest = I420Buffer::Create(64, 48);
+
+  EXPECT_LT(VideoFrameConverter::convertToI420(nullptr, layout, Rect{0, 0, 64, 48}, kVideoRotation_0, *dest), 0);
+  EXPECT_LT(VideoFrameConverter::convertToI420(sample.data(), layout, Rect{-1, 0, 64, 48}, kVideoRotation_0, *dest), 0);
+  EXPECT_LT(VideoFrameConverter::convertToI420(sample.data(), layout, Rect{0, 0, 0, 48}, kVideoRotation_0, *dest), 0);
+  EXPECT_LT(VideoFrameConverter::convertToI420(sample.data(), layout, Rect{1, 0, 64, 48}, kVideoRotation_0, *dest), 0);
+  EXPECT_LT(VideoFrameConverter::convertToI420(sample.data(), layout, Rect{0, 1, 64, 48}, kVideoRotation_0, *dest), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, DescribesPaddedSamples)
+{
+  for (auto fourcc : kPaddedFourccs) {
+    SCOPED_TRACE(name(fourcc));
+
+    auto compact = randomBytes(frameLength(fourcc, 50, 30), fourcc);
+    auto padded = pad(compact, fourcc, 50, 30, 16);
+
+    auto layout = VideoFrameConverter::describe(fourcc, 50, 30, padded.size());
+    EXPECT_TRUE(layout.isPadded());
+    EXPECT_EQ(64, layout.alignedWidth_);
+    EXPECT_EQ(32, layout.alignedHeight_);
+
+    layout = VideoFrameConverter::describe(fourcc, 50, 30, compact.size());
+    EXPECT_FALSE(layout.isPadded());
+
+    // larger than a frame but too small to hold a padded one
+    layout = VideoFrameConverter::describe(fourcc, 50, 30, compact.size() + 1);
+    EXPECT_FALSE(layout.isPadded());
+  }
+
+  // an already aligned frame never has padding
+  auto layout = VideoFrameConverter::describe(libyuv::FOURCC_NV12, 64, 32, 64 * 32 * 2);
+  EXPECT_FALSE(layout.isPadded());
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, SkipsPaddingLikeLibyuvOnTheUnpaddedFrame)
+{
+  const int sizes[][2] = { {50, 30}, {33, 17}, {310, 1078} };
+
+  for (auto fourcc : kPaddedFourccs) {
+    for (auto &size : sizes) {
+      const int width = size[0];
+      const int height = size[1];
+      SCOPED_TRACE(name(fourcc) + " " + std::to_string(width) + "x" + std::to_string(height));
+
+      auto compact = randomBytes(frameLength(fourcc, width, height), fourcc + width);
+      auto padded = pad(compact, fourcc, width, height, 16);
+      auto layout = VideoFrameConverter::describe(fourcc, width, height, padded.size());
+      ASSERT_TRUE(layout.isPadded());
+
+      const Rect crops[] = {
+        {0, 0, width, height},
+        {2, 2, width - 4, height - 4},
+        {1, 3, width - 2, height - 5},
+      };
+
+      for (auto &crop : crops) {
+        for (auto rotation : kRotations) {
+          auto expected = reference(compact, fourcc, width, height, crop, rotation);
+          for (bool parallel : {false, true}) {
+            auto actual = createDest(crop, rotation);
+            ASSERT_EQ(0, VideoFrameConverter::convertToI420(padded.data(), layout, crop, rotation, *actual, parallel));
+            EXPECT_TRUE(framesEqual(*expected, *actual));
+          }
+        }
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, RemovesPaddingInPlace)
+{
+  // odd sizes round their chroma up, which the compact rows must keep
+  const int sizes[][2] = { {50, 30}, {33, 17}, {50, 17} };
+
+  for (auto fourcc : kPaddedFourccs) {
+    for (auto &size : sizes) {
+      const int width = size[0];
+      const int height = size[1];
+      SCOPED_TRACE(name(fourcc) + " " + std::to_string(width) + "x" + std::to_string(height));
+
+      auto compact = randomBytes(frameLength(fourcc, width, height), fourcc + width);
+      auto padded = pad(compact, fourcc, width, height, 16);
+      auto layout = VideoFrameConverter::describe(fourcc, width, height, padded.size());
+      ASSERT_TRUE(layout.isPadded());
+
+      auto result = VideoFrameConverter::removePadding(padded.data(), layout);
+      EXPECT_FALSE(result.isPadded());
+      ASSERT_EQ(compact.size(), result.length_);
+      EXPECT_EQ(0, memcmp(compact.data(), padded.data(), compact.size()));
+
+      // and the compacted frame converts like the original
+      const Rect crop {0, 0, width, height};
+      auto expected = reference(compact, fourcc, width, height, crop, kVideoRotation_0);
+      auto actual = createDest(crop, kVideoRotation_0);
+      ASSERT_EQ(0, VideoFrameConverter::convertToI420(padded.data(), result, crop, kVideoRotation_0, *actual));
+      EXPECT_TRUE(framesEqual(*expected, *actual));
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, ConvertsToNV12LikeLibyuv)
+{
+  const uint32_t fourccs[] = { libyuv::FOURCC_NV12, libyuv::FOURCC_I420, libyuv::FOURCC_YV12 };
+  const int sizes[][2] = { {64, 48}, {50, 30}, {33, 17}, {320, 1080} };
+
+  for (auto fourcc : fourccs) {
+    for (auto &size : sizes) {
+      const int width = size[0];
+      const int height = size[1];
+
+      auto compact = randomBytes(frameLength(fourcc, width, height), fourcc + height);
+      auto padded = pad(compact, fourcc, width, height, 16);
+
+      // the NV12 path needs even crop offsets; the crop size may be odd
+      const Rect crops[] = {
+        {0, 0, width, height},
+        {2, 4, width - 6, height - 8},
+        {4, 2, width - 7, height - 5},
+      };
+
+      for (auto &crop : crops) {
+        for (bool usePadded : {false, true}) {
+          if ((usePadded) && (0 == width % 16) && (0 == height % 16)) continue;
+
+          SCOPED_TRACE(name(fourcc) + " " + std::to_string(width) + "x" + std::to_string(height) +
+                       " crop " + std::to_string(crop.width_) + "x" + std::to_string(crop.height_) + (usePadded ? " padded" : ""));
+
+          auto &sample = (usePadded ? padded : compact);
+          auto layout = (usePadded ? VideoFrameConverter::describe(fourcc, width, height, padded.size()) : unpadded(fourcc, width, height, compact.size()));
+          ASSERT_EQ(usePadded, layout.isPadded());
+
+          auto expected = reference(compact, fourcc, width, height, crop, kVideoRotation_0);
+
+          auto actual = NV12Buffer::create(crop.width_, crop.height_);
+          ASSERT_EQ(0, VideoFrameConverter::convertToNV12(sample.data(), layout, crop, *actual, height > 1000));
+
+          // the split chroma of the NV12 buffer matches the I420 conversion
+          EXPECT_TRUE(framesEqual(*expected, *actual));
+        }
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameConverterTest, RejectsUnsupportedNV12Conversions)
+{
+  auto sample = randomBytes(frameLength(libyuv::FOURCC_YUY2, 64, 48), 1);
+  auto dest = NV12Buffer::create(64, 48);
+
+  EXPECT_FALSE(VideoFrameConverter::canConvertToNV12(libyuv::FOURCC_YUY2));
+  EXPECT_TRUE(VideoFrameConverter::canConvertToNV12(libyuv::FOURCC_IYUV));
+  EXPECT_LT(VideoFrameConverter::convertToNV12(sample.data(), unpadded(libyuv::FOURCC_YUY2, 64, 48, sample.size()), Rect{0, 0, 64, 48}, *dest), 0);
+
+  // odd crop offsets would split chroma pairs
+  auto nv12 = randomBytes(frameLength(libyuv::FOURCC_NV12, 64, 48), 2);
+  auto small = NV12Buffer::create(60, 40);
+  EXPECT_LT(VideoFrameConverter::convertToNV12(nv12.data(), unpadded(libyuv::FOURCC_NV12, 64, 48, nv12.size()), Rect{1, 0, 60, 40}, *small), 0);
+
+  // the destination must match the crop window
+  EXPECT_LT(VideoFrameConverter::convertToNV12(nv12.data(), unpadded(libyuv::FOURCC_NV12, 64, 48, nv12.size()), Rect{0, 0, 62, 40}, *small), 0);
+}
@@ -0,0 +1,320 @@
+
+#include <wrapper/impl_webrtc_VideoFrameExporter.h>
+#include <wrapper/impl_webrtc_NV12Buffer.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "libyuv/convert_argb.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/scale.h"
+#include "rtc_base/refcountedobject.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoFrameExporter Exporter;
+  typedef std::vector<uint8_t> Bytes;
+
+  const int kSizes[][2] = { {64, 48}, {33, 17}, {320, 1080} };
+
+  int half(int value) { return (value + 1) / 2; }
+
+  //---------------------------------------------------------------------------
+  rtc::scoped_refptr<I420Buffer> randomFrame(int width, int height, uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    auto buffer = I420Buffer::Create(width, height);
+    auto fill = [&](uint8_t *data, int stride, int rowBytes, int rows) {
+      for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < rowBytes; ++column) {
+          data[(row * stride) + column] = static_cast<uint8_t>(byte(random));
+        }
+      }
+    };
+    fill(buffer->MutableDataY(), buffer->StrideY(), width, height);
+    fill(buffer->MutableDataU(), buffer->StrideU(), half(width), half(height));
+    fill(buffer->MutableDataV(), buffer->StrideV(), half(width), half(height));
+    return buffer;
+  }
+
+  //---------------------------------------------------------------------------
+  rtc::scoped_refptr<NV12Buffer> toNV12Buffer(const I420BufferInterface &i420)
+  {
+    auto buffer = NV12Buffer::create(i420.width(), i420.height());
+    libyuv::I420ToNV12(
+      i420.DataY(), i420.StrideY(),
+      i420.DataU(), i420.StrideU(),
+      i420.DataV(), i420.StrideV(),
+      buffer->MutableDataY(), buffer->StrideY(),
+      buffer->MutableDataUV(), buffer->StrideUV(),
+      i420.width(), i420.height());
+    return buffer;
+  }
+
+  //---------------------------------------------------------------------------
+  Exporter::Plane plane(Bytes &bytes, int stride)
+  {
+    Exporter::Plane result;
+    result.data_ = bytes.data();
+    result.stride_ = stride;
+    result.size_ = bytes.size();
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  // A buffer that cannot be read as I420, like a texture whose download
+  // failed.
+  class UnreadableBuffer : public VideoFrameBuffer
+  {
+  public:
+    Type type() const override { return Type::kNative; }
+    int width() const override { return 64; }
+    int height() const override { return 48; }
+    rtc::scoped_refptr<I420BufferInterface> ToI420() override { return nullptr; }
+  };
+
+  //---------------------------------------------------------------------------
+  // Position of each channel in memory for every format, as named by
+  // RgbFormat, against libyuv's ARGB which is stored B, G, R, A.
+  struct ChannelOrder
+  {
+    Exporter::RgbFormat format_;
+    const char *name_;
+    int fromArgb_[4];
+  };
+
+  const ChannelOrder kChannelOrders[] = {
+    {Exporter::RgbFormat_BGRA, "BGRA", {0, 1, 2, 3}},
+    {Exporter::RgbFormat_RGBA, "RGBA", {2, 1, 0, 3}},
+    {Exporter::RgbFormat_ARGB, "ARGB", {3, 2, 1, 0}},
+    {Exporter::RgbFormat_ABGR, "ABGR", {3, 0, 1, 2}},
+  };
+
+  //---------------------------------------------------------------------------
+  Bytes reorder(const Bytes &argb, const ChannelOrder &order)
+  {
+    Bytes result(argb.size());
+    for (size_t pixel = 0; pixel < argb.size(); pixel += 4) {
+      for (int channel = 0; channel < 4; ++channel) {
+        result[pixel + channel] = argb[pixel + order.fromArgb_[channel]];
+      }
+    }
+    return result;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, ToNV12MatchesLibyuv)
+{
+  for (auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+    SCOPED_TRACE(std::to_string(width) + "x" + std::to_string(height));
+
+    auto source = randomFrame(width, height, width + height);
+
+    Bytes expectedY(width * height);
+    Bytes expectedUV(2 * half(width) * half(height));
+    libyuv::I420ToNV12(
+      source->DataY(), source->StrideY(),
+      source->DataU(), source->StrideU(),
+      source->DataV(), source->StrideV(),
+      expectedY.data(), width,
+      expectedUV.data(), 2 * half(width),
+      width, height);
+
+    for (bool parallel : {false, true}) {
+      Bytes y(expectedY.size());
+      Bytes uv(expectedUV.size());
+      ASSERT_TRUE(Exporter::toNV12(*source, plane(y, width), plane(uv, 2 * half(width)), parallel));
+      EXPECT_EQ(expectedY, y);
+      EXPECT_EQ(expectedUV, uv);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, ToNV12CopiesNV12Buffers)
+{
+  for (auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+    SCOPED_TRACE(std::to_string(width) + "x" + std::to_string(height));
+
+    auto source = toNV12Buffer(*randomFrame(width, height, width * height));
+
+    // a wider destination stride than the source
+    const int strideY = width + 16;
+    const int strideUV = (2 * half(width)) + 16;
+    Bytes y(strideY * height);
+    Bytes uv(strideUV * half(height));
+    ASSERT_TRUE(Exporter::toNV12(*source, plane(y, strideY), plane(uv, strideUV), height > 1000));
+
+    for (int row = 0; row < height; ++row) {
+      ASSERT_EQ(0, memcmp(source->DataY() + (row * source->StrideY()), y.data() + (row * strideY), width)) << "Y row " << row;
+    }
+    for (int row = 0; row < half(height); ++row) {
+      ASSERT_EQ(0, memcmp(source->DataUV() + (row * source->StrideUV()), uv.data() + (row * strideUV), 2 * half(width))) << "UV row " << row;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, ToRgbWritesTheNamedByteOrder)
+{
+  for (auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+
+    auto source = randomFrame(width, height, width - height);
+
+    Bytes argb(width * 4 * height);
+    libyuv::I420ToARGB(
+      source->DataY(), source->StrideY(),
+      source->DataU(), source->StrideU(),
+      source->DataV(), source->StrideV(),
+      argb.data(), width * 4,
+      width, height);
+
+    for (auto &order : kChannelOrders) {
+      SCOPED_TRACE(std::string(order.name_) + " " + std::to_string(width) + "x" + std::to_string(height));
+
+      auto expected = reorder(argb, order);
+      for (bool parallel : {false, true}) {
+        Bytes rgb(expected.size());
+        ASSERT_TRUE(Exporter::toRgb(*source, plane(rgb, width * 4), order.format_, parallel));
+        EXPECT_EQ(expected, rgb);
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, ToRgbFromNV12MatchesI420)
+{
+  for (auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+
+    auto i420 = randomFrame(width, height, width * 3);
+    auto nv12 = toNV12Buffer(*i420);
+
+    // BGRA and RGBA convert straight from the interleaved chroma
+    for (auto &order : kChannelOrders) {
+      SCOPED_TRACE(std::string(order.name_) + " " + std::to_string(width) + "x" + std::to_string(height));
+
+      Bytes expected(width * 4 * height);
+      Bytes actual(expected.size());
+      ASSERT_TRUE(Exporter::toRgb(*i420, plane(expected, width * 4), order.format_, false));
+      ASSERT_TRUE(Exporter::toRgb(*nv12, plane(actual, width * 4), order.format_, height > 1000));
+      EXPECT_EQ(expected, actual);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, ScaleToI420MatchesLibyuv)
+{
+  const int scales[][4] = { {640, 360, 320, 180}, {64, 48, 33, 17}, {320, 240, 640, 480}, {1280, 1080, 640, 540} };
+
+  for (auto &scale : scales) {
+    const int width = scale[2];
+    const int height = scale[3];
+    SCOPED_TRACE(std::to_string(scale[0]) + "x" + std::to_string(scale[1]) + " to " + std::to_string(width) + "x" + std::to_string(height));
+
+    auto source = randomFrame(scale[0], scale[1], scale[0] + width);
+
+    Bytes expectedY(width * height);
+    Bytes expectedU(half(width) * half(height));
+    Bytes expectedV(expectedU.size());
+    ASSERT_EQ(0, libyuv::I420Scale(
+      source->DataY(), source->StrideY(),
+      source->DataU(), source->StrideU(),
+      source->DataV(), source->StrideV(),
+      source->width(), source->height(),
+      expectedY.data(), width,
+      expectedU.data(), half(width),
+      expectedV.data(), half(width),
+      width, height,
+      libyuv::kFilterBox));
+
+    for (bool parallel : {false, true}) {
+      Bytes y(expectedY.size());
+      Bytes u(expectedU.size());
+      Bytes v(expectedV.size());
+      ASSERT_TRUE(Exporter::scaleToI420(*source, plane(y, width), plane(u, half(width)), plane(v, half(width)), width, height, parallel));
+      EXPECT_EQ(expectedY, y);
+      EXPECT_EQ(expectedU, u);
+      EXPECT_EQ(expectedV, v);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, RejectsDestinationsThatDoNotFit)
+{
+  const int width = 33;
+  const int height = 17;
+  auto source = randomFrame(width, height, 1);
+
+  // the last row only needs its own pixels, not a whole stride
+  const int stride = (width * 4) + 64;
+  Bytes padded((stride * (height - 1)) + (width * 4));
+  EXPECT_TRUE(Exporter::toRgb(*source, plane(padded, stride), Exporter::RgbFormat_BGRA, false));
+
+  auto shortPlane = plane(padded, stride);
+  --shortPlane.size_;
+  EXPECT_FALSE(Exporter::toRgb(*source, shortPlane, Exporter::RgbFormat_BGRA, false));
+
+  Bytes rgb(width * 4 * height);
+
+  auto narrowPlane = plane(rgb, (width * 4) - 1);
+  EXPECT_FALSE(Exporter::toRgb(*source, narrowPlane, Exporter::RgbFormat_BGRA, false));
+
+  Exporter::Plane missing;
+  missing.stride_ = width * 4;
+  missing.size_ = rgb.size();
+  EXPECT_FALSE(Exporter::toRgb(*source, missing, Exporter::RgbFormat_BGRA, false));
+
+  EXPECT_FALSE(Exporter::toRgb(*source, plane(rgb, width * 4), static_cast<Exporter::RgbFormat>(Exporter::RgbFormat_Last + 1), false));
+
+  // NV12 chroma pairs round odd widths up
+  Bytes y(width * height);
+  Bytes uv(2 * half(width) * half(height));
+  EXPECT_TRUE(Exporter::toNV12(*source, plane(y, width), plane(uv, 2 * half(width)), false));
+  EXPECT_FALSE(Exporter::toNV12(*source, plane(y, width), plane(uv, width), false));
+  EXPECT_FALSE(Exporter::toNV12(*source, plane(y, width - 1), plane(uv, 2 * half(width)), false));
+
+  Bytes u(half(width) * half(height));
+  Bytes v(u.size());
+  EXPECT_TRUE(Exporter::scaleToI420(*source, plane(y, width), plane(u, half(width)), plane(v, half(width)), width, height, false));
+  EXPECT_FALSE(Exporter::scaleToI420(*source, plane(y, width), plane(u, width / 2), plane(v, half(width)), width, height, false));
+  EXPECT_FALSE(Exporter::scaleToI420(*source, plane(y, width), plane(u, half(width)), plane(v, half(width)), width, height + 2, false));
+  EXPECT_FALSE(Exporter::scaleToI420(*source, plane(y, width), plane(u, half(width)), plane(v, half(width)), 0, height, false));
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameExporterTest, RejectsUnreadableBuffers)
+{
+  rtc::scoped_refptr<VideoFrameBuffer> source = new rtc::RefCountedObject<UnreadableBuffer>();
+
+  Bytes y(64 * 48);
+  Bytes u(32 * 24);
+  Bytes v(32 * 24);
+  Bytes uv(64 * 24);
+  Bytes rgb(64 * 4 * 48);
+
+  EXPECT_FALSE(Exporter::toNV12(*source, plane(y, 64), plane(uv, 64), false));
+  EXPECT_FALSE(Exporter::toRgb(*source, plane(rgb, 64 * 4), Exporter::RgbFormat_ARGB, false));
+  EXPECT_FALSE(Exporter::scaleToI420(*source, plane(y, 64), plane(u, 32), plane(v, 32), 64, 48, false));
+}
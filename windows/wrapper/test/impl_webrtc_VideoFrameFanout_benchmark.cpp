@@ -0,0 +1,174 @@
+
+#include <wrapper/impl_webrtc_VideoFrameFanout.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "libyuv/convert.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoFrameFanout Fanout;
+
+  const int kWidth = 1280;
+  const int kHeight = 720;
+  const int kSinks = 10;
+  const int kFrames = 600;
+
+  //---------------------------------------------------------------------------
+  // Runs posted deliveries when the benchmark drains it, after each frame.
+  class DrainedQueue : public zsLib::IMessageQueue
+  {
+  public:
+    void post(zsLib::IMessageQueueMessageUniPtr message) noexcept(false) override
+    {
+      messages_.push_back(std::move(message));
+    }
+
+    size_type getTotalUnprocessedMessages() const noexcept override
+    {
+      return messages_.size();
+    }
+
+    void process()
+    {
+      for (auto &message : messages_) {
+        message->processMessage();
+      }
+      messages_.clear();
+    }
+
+  private:
+    std::vector<zsLib::IMessageQueueMessageUniPtr> messages_;
+  };
+
+  //---------------------------------------------------------------------------
+  // Reads a byte of each plane of every frame it receives.
+  class ReadingSink : public Fanout::SinkType
+  {
+  public:
+    void OnFrame(const VideoFrame &frame) override
+    {
+      auto buffer = frame.video_frame_buffer()->GetI420();
+      check_ += buffer->DataY()[0] + buffer->DataU()[0] + buffer->DataV()[0];
+      ++frames_;
+    }
+
+    uint64_t check_ {};
+    int frames_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  // An NV12 camera frame as the capture device hands it over.
+  struct CameraFrame
+  {
+    CameraFrame() : bytes_(kWidth * kHeight * 3 / 2)
+    {
+      for (size_t index = 0; index < bytes_.size(); ++index) {
+        bytes_[index] = static_cast<uint8_t>(index * 7);
+      }
+    }
+
+    const uint8_t *y() const { return bytes_.data(); }
+    const uint8_t *uv() const { return bytes_.data() + (kWidth * kHeight); }
+
+    std::vector<uint8_t> bytes_;
+  };
+
+  //---------------------------------------------------------------------------
+  VideoFrame convert(const CameraFrame &camera, int64_t timestampUs)
+  {
+    auto buffer = I420Buffer::Create(kWidth, kHeight);
+    libyuv::NV12ToI420(
+      camera.y(), kWidth,
+      camera.uv(), kWidth,
+      buffer->MutableDataY(), buffer->StrideY(),
+      buffer->MutableDataU(), buffer->StrideU(),
+      buffer->MutableDataV(), buffer->StrideV(),
+      kWidth, kHeight);
+    return VideoFrame(buffer, kVideoRotation_0, timestampUs);
+  }
+
+  //---------------------------------------------------------------------------
+  double cpuMs(std::clock_t start)
+  {
+    return 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC;
+  }
+
+  //---------------------------------------------------------------------------
+  // Every sink has its own capture path and converts every frame itself, as
+  // a second VideoTrackSource on the same camera used to.
+  double perSinkConversion(const CameraFrame &camera, std::vector<ReadingSink> &sinks)
+  {
+    auto start = std::clock();
+    for (int frame = 0; frame < kFrames; ++frame) {
+      for (auto &sink : sinks) {
+        sink.OnFrame(convert(camera, frame));
+      }
+    }
+    return cpuMs(start);
+  }
+
+  //---------------------------------------------------------------------------
+  // One conversion per frame handed to every sink through the fanout.
+  double throughFanout(const CameraFrame &camera, std::vector<ReadingSink> &sinks, Fanout::DropPolicy policy)
+  {
+    auto queue = std::make_shared<DrainedQueue>();
+    auto fanout = Fanout::create();
+
+    Fanout::SinkOptions options;
+    options.policy_ = policy;
+    if (Fanout::DropPolicy_None != policy) options.queue_ = queue;
+    for (auto &sink : sinks) {
+      fanout->addSink(&sink, options);
+    }
+
+    auto start = std::clock();
+    for (int frame = 0; frame < kFrames; ++frame) {
+      fanout->OnFrame(convert(camera, frame));
+      queue->process();
+    }
+    return cpuMs(start);
+  }
+
+  //---------------------------------------------------------------------------
+  void report(const char *name, double ms, const std::vector<ReadingSink> &sinks)
+  {
+    for (auto &sink : sinks) {
+      if (kFrames != sink.frames_) printf("a sink missed frames\n");
+    }
+    printf("%-22s %10.1f %12.3f\n", name, ms, ms / kFrames);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Measures the CPU time one 720p NV12 capture costs when it feeds ten
+// sinks: each converting on its own, against one conversion fanned out
+// inline or through a queue.
+int main()
+{
+  CameraFrame camera;
+
+  printf("%dx%d NV12, 1 capture to %d sinks, %d frames\n", kWidth, kHeight, kSinks, kFrames);
+  printf("%-22s %10s %12s\n", "path", "cpu ms", "ms per frame");
+
+  {
+    std::vector<ReadingSink> sinks(kSinks);
+    report("conversion per sink", perSinkConversion(camera, sinks), sinks);
+  }
+  {
+    std::vector<ReadingSink> sinks(kSinks);
+    report("fanout inline", throughFanout(camera, sinks, Fanout::DropPolicy_None), sinks);
+  }
+  {
+    std::vector<ReadingSink> sinks(kSinks);
+    report("fanout latestOnly", throughFanout(camera, sinks, Fanout::DropPolicy_LatestOnly), sinks);
+  }
+  return 0;
+}
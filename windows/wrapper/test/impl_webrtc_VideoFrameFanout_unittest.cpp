@@ -0,0 +1,231 @@
+
+#include <wrapper/impl_webrtc_VideoFrameFanout.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoFrameFanout Fanout;
+
+  //---------------------------------------------------------------------------
+  // Holds posted messages until the test processes them, so a queued
+  // delivery runs exactly when the test decides.
+  class ManualQueue : public zsLib::IMessageQueue
+  {
+  public:
+    void post(zsLib::IMessageQueueMessageUniPtr message) noexcept(false) override
+    {
+      messages_.push_back(std::move(message));
+    }
+
+    size_type getTotalUnprocessedMessages() const noexcept override
+    {
+      return messages_.size();
+    }
+
+    void process()
+    {
+      auto messages = std::move(messages_);
+      messages_.clear();
+      for (auto &message : messages) {
+        message->processMessage();
+      }
+    }
+
+  private:
+    std::vector<zsLib::IMessageQueueMessageUniPtr> messages_;
+  };
+
+  //---------------------------------------------------------------------------
+  // Remembers the timestamp and buffer of every frame it receives.
+  class RecordingSink : public Fanout::SinkType
+  {
+  public:
+    void OnFrame(const VideoFrame &frame) override
+    {
+      timestamps_.push_back(frame.timestamp_us());
+      buffers_.push_back(frame.video_frame_buffer().get());
+    }
+
+    std::vector<int64_t> timestamps_;
+    std::vector<const VideoFrameBuffer *> buffers_;
+  };
+
+  //---------------------------------------------------------------------------
+  class VideoFrameFanoutTest : public ::testing::Test
+  {
+  protected:
+    Fanout::SinkOptions options(Fanout::DropPolicy policy)
+    {
+      Fanout::SinkOptions result;
+      result.policy_ = policy;
+      if (Fanout::DropPolicy_None != policy) result.queue_ = queue_;
+      return result;
+    }
+
+    void capture(int64_t timestampUs)
+    {
+      fanout_->OnFrame(VideoFrame(I420Buffer::Create(16, 16), kVideoRotation_0, timestampUs));
+    }
+
+    Fanout::SinkStats stats(Fanout::SinkType *sink)
+    {
+      Fanout::SinkStats result;
+      EXPECT_TRUE(fanout_->sinkStats(sink, result));
+      return result;
+    }
+
+    std::shared_ptr<ManualQueue> queue_ {std::make_shared<ManualQueue>()};
+    VideoFrameFanoutPtr fanout_ {Fanout::create()};
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, InlineSinksShareOneBuffer)
+{
+  RecordingSink first;
+  RecordingSink second;
+  fanout_->addSink(&first, options(Fanout::DropPolicy_None));
+  fanout_->addSink(&second, options(Fanout::DropPolicy_None));
+  EXPECT_EQ(2u, fanout_->sinkCount());
+
+  capture(1);
+  capture(2);
+
+  EXPECT_EQ((std::vector<int64_t> {1, 2}), first.timestamps_);
+  EXPECT_EQ((std::vector<int64_t> {1, 2}), second.timestamps_);
+  EXPECT_EQ(first.buffers_, second.buffers_);
+  EXPECT_EQ(2u, stats(&first).delivered_);
+  EXPECT_EQ(0u, queue_->getTotalUnprocessedMessages());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, DropIfBusySkipsFramesWhileADeliveryIsQueued)
+{
+  RecordingSink sink;
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_DropIfBusy));
+
+  capture(1);
+  capture(2);
+  capture(3);
+  EXPECT_TRUE(sink.timestamps_.empty());
+  EXPECT_EQ(1u, queue_->getTotalUnprocessedMessages());
+
+  queue_->process();
+  EXPECT_EQ((std::vector<int64_t> {1}), sink.timestamps_);
+
+  // once delivered the next frame is queued again
+  capture(4);
+  queue_->process();
+  EXPECT_EQ((std::vector<int64_t> {1, 4}), sink.timestamps_);
+
+  auto result = stats(&sink);
+  EXPECT_EQ(2u, result.delivered_);
+  EXPECT_EQ(2u, result.dropped_);
+  EXPECT_EQ(0u, result.replaced_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, LatestOnlyReplacesThePendingFrame)
+{
+  RecordingSink sink;
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_LatestOnly));
+
+  capture(1);
+  capture(2);
+  capture(3);
+  EXPECT_EQ(1u, queue_->getTotalUnprocessedMessages());
+
+  queue_->process();
+  EXPECT_EQ((std::vector<int64_t> {3}), sink.timestamps_);
+
+  auto result = stats(&sink);
+  EXPECT_EQ(1u, result.delivered_);
+  EXPECT_EQ(0u, result.dropped_);
+  EXPECT_EQ(2u, result.replaced_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, PolicyWithoutAQueueDeliversInline)
+{
+  RecordingSink sink;
+  Fanout::SinkOptions inlineOptions;
+  inlineOptions.policy_ = Fanout::DropPolicy_LatestOnly;
+  fanout_->addSink(&sink, inlineOptions);
+
+  capture(1);
+  EXPECT_EQ((std::vector<int64_t> {1}), sink.timestamps_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, RemovedSinkMissesItsQueuedFrame)
+{
+  RecordingSink kept;
+  RecordingSink removed;
+  fanout_->addSink(&kept, options(Fanout::DropPolicy_LatestOnly));
+  fanout_->addSink(&removed, options(Fanout::DropPolicy_LatestOnly));
+
+  capture(1);
+  fanout_->removeSink(&removed);
+  queue_->process();
+
+  EXPECT_EQ((std::vector<int64_t> {1}), kept.timestamps_);
+  EXPECT_TRUE(removed.timestamps_.empty());
+
+  Fanout::SinkStats result;
+  EXPECT_FALSE(fanout_->sinkStats(&removed, result));
+  EXPECT_EQ(1u, fanout_->sinkCount());
+
+  // removing twice is harmless
+  fanout_->removeSink(&removed);
+  EXPECT_EQ(1u, fanout_->sinkCount());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, AddingAgainRetiresTheQueuedDelivery)
+{
+  RecordingSink sink;
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_LatestOnly));
+  capture(1);
+  queue_->process();
+  capture(2);
+
+  // the frame queued with the old options is never delivered
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_None));
+  EXPECT_EQ(1u, fanout_->sinkCount());
+  queue_->process();
+  EXPECT_EQ((std::vector<int64_t> {1}), sink.timestamps_);
+
+  capture(3);
+  EXPECT_EQ((std::vector<int64_t> {1, 3}), sink.timestamps_);
+
+  // statistics carry over the change of options
+  EXPECT_EQ(2u, stats(&sink).delivered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameFanoutTest, AddingAgainWithAQueueStartsAFreshDelivery)
+{
+  RecordingSink sink;
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_DropIfBusy));
+  capture(1);
+  capture(2);
+
+  fanout_->addSink(&sink, options(Fanout::DropPolicy_LatestOnly));
+  capture(3);
+  EXPECT_EQ(2u, queue_->getTotalUnprocessedMessages());
+
+  queue_->process();
+  EXPECT_EQ((std::vector<int64_t> {3}), sink.timestamps_);
+
+  auto result = stats(&sink);
+  EXPECT_EQ(1u, result.delivered_);
+  EXPECT_EQ(1u, result.dropped_);
+}
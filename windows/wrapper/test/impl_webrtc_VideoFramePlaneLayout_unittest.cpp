@@ -0,0 +1,171 @@
+
+#include <wrapper/impl_webrtc_VideoFramePlaneLayout.h>
+#include <wrapper/impl_webrtc_NV12Buffer.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "api/video/i420_buffer.h"
+#include "common_video/include/video_frame_buffer.h"
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoFramePlaneLayout Layout;
+
+  const int kWidth = 64;
+  const int kHeight = 48;
+
+  void noLongerUsed() {}
+
+  //---------------------------------------------------------------------------
+  // Planes of a wrapped buffer, either in one allocation one after another
+  // or each in its own.
+  struct Planes
+  {
+    Planes(size_t ySize, size_t chromaSize, size_t alphaSize, bool together) :
+      together_(ySize + (chromaSize * 2) + alphaSize),
+      y_(together ? 0 : ySize),
+      u_(together ? 0 : chromaSize),
+      v_(together ? 0 : chromaSize),
+      a_(together ? 0 : alphaSize)
+    {
+      if (together) {
+        y = together_.data();
+        u = y + ySize;
+        v = u + chromaSize;
+        a = v + chromaSize;
+      } else {
+        y = y_.data();
+        u = u_.data();
+        v = v_.data();
+        a = a_.data();
+      }
+    }
+
+    const uint8_t *y {};
+    const uint8_t *u {};
+    const uint8_t *v {};
+    const uint8_t *a {};
+
+  private:
+    std::vector<uint8_t> together_;
+    std::vector<uint8_t> y_;
+    std::vector<uint8_t> u_;
+    std::vector<uint8_t> v_;
+    std::vector<uint8_t> a_;
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, I420ChromaIsHalfHeight)
+{
+  auto buffer = I420Buffer::Create(kWidth, kHeight + 1);
+  const size_t chromaRows = (kHeight + 2) / 2;
+
+  auto y = Layout::locate(*buffer, Layout::Plane_Y);
+  EXPECT_EQ(buffer->DataY(), y.data8bit_);
+  EXPECT_EQ(static_cast<size_t>(buffer->StrideY() * (kHeight + 1)), y.size_);
+
+  auto u = Layout::locate(*buffer, Layout::Plane_U);
+  EXPECT_EQ(buffer->DataU(), u.data8bit_);
+  EXPECT_EQ(buffer->StrideU() * chromaRows, u.size_);
+
+  auto v = Layout::locate(*buffer, Layout::Plane_V);
+  EXPECT_EQ(buffer->DataV(), v.data8bit_);
+  EXPECT_EQ(buffer->StrideV() * chromaRows, v.size_);
+
+  EXPECT_TRUE(Layout::locate(*buffer, Layout::Plane_UV).empty());
+  EXPECT_TRUE(Layout::locate(*buffer, Layout::Plane_A).empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, I444ChromaIsFullHeight)
+{
+  const size_t planeSize = kWidth * kHeight;
+  Planes planes(planeSize, planeSize, 0, false);
+  auto buffer = WrapI444Buffer(kWidth, kHeight, planes.y, kWidth, planes.u, kWidth, planes.v, kWidth, noLongerUsed);
+
+  auto u = Layout::locate(*buffer, Layout::Plane_U);
+  EXPECT_EQ(planes.u, u.data8bit_);
+  EXPECT_EQ(planeSize, u.size_);
+
+  auto v = Layout::locate(*buffer, Layout::Plane_V);
+  EXPECT_EQ(planes.v, v.data8bit_);
+  EXPECT_EQ(planeSize, v.size_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, I420AAlphaIsFullHeight)
+{
+  const size_t chromaSize = (kWidth / 2) * (kHeight / 2);
+  Planes planes(kWidth * kHeight, chromaSize, kWidth * kHeight, false);
+  auto buffer = WrapI420ABuffer(kWidth, kHeight, planes.y, kWidth, planes.u, kWidth / 2, planes.v, kWidth / 2, planes.a, kWidth, noLongerUsed);
+
+  EXPECT_EQ(chromaSize, Layout::locate(*buffer, Layout::Plane_U).size_);
+  EXPECT_EQ(chromaSize, Layout::locate(*buffer, Layout::Plane_V).size_);
+
+  auto a = Layout::locate(*buffer, Layout::Plane_A);
+  EXPECT_EQ(planes.a, a.data8bit_);
+  EXPECT_EQ(static_cast<size_t>(kWidth * kHeight), a.size_);
+
+  Layout::Span spans[Layout::kMaxPlanes];
+  ASSERT_EQ(4u, Layout::collect(*buffer, spans));
+  EXPECT_EQ(planes.a, spans[3].data8bit_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, NV12IsCollectedInterleaved)
+{
+  auto buffer = NV12Buffer::create(kWidth, kHeight + 1);
+  const size_t chromaRows = (kHeight + 2) / 2;
+
+  Layout::Span spans[Layout::kMaxPlanes];
+  ASSERT_EQ(2u, Layout::collect(*buffer, spans));
+  EXPECT_EQ(buffer->DataY(), spans[0].data8bit_);
+  EXPECT_EQ(buffer->DataUV(), spans[1].data8bit_);
+  EXPECT_EQ(buffer->StrideUV() * chromaRows, spans[1].size_);
+
+  Layout::Span whole;
+  ASSERT_TRUE(Layout::contiguous(*buffer, whole));
+  EXPECT_EQ(buffer->DataY(), whole.data8bit_);
+  EXPECT_EQ(spans[0].size_ + spans[1].size_, whole.size_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, AllocatedI420IsContiguous)
+{
+  auto buffer = I420Buffer::Create(kWidth + 1, kHeight + 1);
+
+  Layout::Span spans[Layout::kMaxPlanes];
+  ASSERT_EQ(3u, Layout::collect(*buffer, spans));
+
+  Layout::Span whole;
+  ASSERT_TRUE(Layout::contiguous(*buffer, whole));
+  EXPECT_EQ(buffer->DataY(), whole.data8bit_);
+  EXPECT_EQ(spans[0].size_ + spans[1].size_ + spans[2].size_, whole.size_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFramePlaneLayoutTest, ContiguousOnlyWhenPlanesFollowEachOther)
+{
+  const size_t planeSize = kWidth * kHeight;
+
+  Planes together(planeSize, planeSize, 0, true);
+  auto adjacent = WrapI444Buffer(kWidth, kHeight, together.y, kWidth, together.u, kWidth, together.v, kWidth, noLongerUsed);
+  Layout::Span whole;
+  ASSERT_TRUE(Layout::contiguous(*adjacent, whole));
+  EXPECT_EQ(together.y, whole.data8bit_);
+  EXPECT_EQ(planeSize * 3, whole.size_);
+
+  Planes apart(planeSize, planeSize, 0, false);
+  auto separate = WrapI444Buffer(kWidth, kHeight, apart.y, kWidth, apart.u, kWidth, apart.v, kWidth, noLongerUsed);
+  EXPECT_FALSE(Layout::contiguous(*separate, whole));
+
+  // U and V swapped in memory are not in frame order
+  auto swapped = WrapI444Buffer(kWidth, kHeight, together.y, kWidth, together.v, kWidth, together.u, kWidth, noLongerUsed);
+  EXPECT_FALSE(Layout::contiguous(*swapped, whole));
+}
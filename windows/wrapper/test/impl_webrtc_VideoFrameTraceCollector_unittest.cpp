@@ -0,0 +1,275 @@
+
+#include <wrapper/impl_webrtc_VideoFrameTraceCollector.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef VideoFrameTrace Trace;
+  typedef VideoFrameTraceCollector Collector;
+  typedef Collector::Histogram Histogram;
+
+  //---------------------------------------------------------------------------
+  // One stage of a frame as the collector published it.
+  struct PublishedStage
+  {
+    Collector::FrameId frameId_ {};
+    Collector::Stage stage_ {};
+    int64_t sincePreviousUs_ {};
+    int64_t sinceFirstUs_ {};
+  };
+
+  //---------------------------------------------------------------------------
+  class VideoFrameTraceCollectorTest : public ::testing::Test
+  {
+  protected:
+    // Records the capture stages of a frame, the given time apart, into a
+    // ring.
+    void captureFrame(Collector::Ring &ring, Collector::FrameId frameId, int64_t startUs, int64_t stepUs)
+    {
+      Collector::record(ring, frameId, Trace::Stage_CaptureSample, startUs);
+      Collector::record(ring, frameId, Trace::Stage_CaptureConverted, startUs + stepUs);
+      Collector::record(ring, frameId, Trace::Stage_CaptureDelivered, startUs + (2 * stepUs));
+    }
+
+    std::vector<Collector::FrameId> publishedFrames() const
+    {
+      std::vector<Collector::FrameId> result;
+      for (auto &stage : stages_) {
+        if ((result.empty()) || (result.back() != stage.frameId_)) result.push_back(stage.frameId_);
+      }
+      return result;
+    }
+
+    std::vector<PublishedStage> stages_;
+    std::vector<Histogram> summaries_;
+
+    Collector collector_ {
+      [this](Collector::FrameId frameId, Collector::Stage stage, int64_t sincePreviousUs, int64_t sinceFirstUs) {
+        PublishedStage published;
+        published.frameId_ = frameId;
+        published.stage_ = stage;
+        published.sincePreviousUs_ = sincePreviousUs;
+        published.sinceFirstUs_ = sinceFirstUs;
+        stages_.push_back(published);
+      },
+      [this](Collector::Stage stage, const Histogram &histogram) {
+        if (Trace::Stage_CaptureConverted == stage) summaries_.push_back(histogram);
+      }
+    };
+  };
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameTraceHistogramTest, EmptyHistogramHasNoPercentiles)
+{
+  Histogram histogram;
+  EXPECT_EQ(0, histogram.percentileUs(0.5));
+  EXPECT_EQ(0, histogram.percentileUs(0.99));
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameTraceHistogramTest, BucketsDoubleFromTheFirst)
+{
+  Histogram histogram;
+  histogram.add(0);
+  histogram.add(Trace::kFirstBucketUs - 1);
+  histogram.add(Trace::kFirstBucketUs);
+  histogram.add((Trace::kFirstBucketUs << 3) + 1);
+
+  EXPECT_EQ(2u, histogram.counts_[0]);
+  EXPECT_EQ(1u, histogram.counts_[1]);
+  EXPECT_EQ(1u, histogram.counts_[4]);
+  EXPECT_EQ(4u, histogram.total_);
+  EXPECT_EQ((Trace::kFirstBucketUs << 3) + 1, histogram.maxUs_);
+
+  // anything beyond the second to last bucket lands in the last one
+  histogram.add(Trace::kFirstBucketUs << (Trace::kHistogramBuckets + 4));
+  EXPECT_EQ(1u, histogram.counts_[Trace::kHistogramBuckets - 1]);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameTraceHistogramTest, PercentilesAreBucketUpperBounds)
+{
+  Histogram histogram;
+  for (int count = 0; count < 10; ++count) histogram.add(50);     // below 64
+  for (int count = 0; count < 10; ++count) histogram.add(100);    // below 128
+  histogram.add(100000);                                          // below 131072
+
+  EXPECT_EQ(64, histogram.percentileUs(0));
+  EXPECT_EQ(128, histogram.percentileUs(0.5));
+  EXPECT_EQ(128, histogram.percentileUs(0.9));
+
+  // the bound of the last occupied bucket is clamped to the maximum seen
+  EXPECT_EQ(100000, histogram.percentileUs(0.99));
+  EXPECT_EQ(100000, histogram.percentileUs(1));
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoFrameTraceHistogramTest, PercentileInTheLastBucketIsTheMaximum)
+{
+  const int64_t huge = Trace::kFirstBucketUs << (Trace::kHistogramBuckets + 2);
+
+  Histogram histogram;
+  histogram.add(10);
+  histogram.add(huge);
+  EXPECT_EQ(huge, histogram.percentileUs(0.99));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, PublishesCompletedFrames)
+{
+  auto ring = collector_.createRing();
+  captureFrame(*ring, 7, 1000, 100);
+
+  // the render pipeline of another frame is not complete yet
+  Collector::record(*ring, 8, Trace::Stage_RenderReceived, 1000);
+  Collector::record(*ring, 8, Trace::Stage_RenderQueued, 1300);
+  collector_.collect();
+
+  ASSERT_EQ(3u, stages_.size());
+  EXPECT_EQ(Trace::Stage_CaptureSample, stages_[0].stage_);
+  EXPECT_EQ(0, stages_[0].sincePreviousUs_);
+  EXPECT_EQ(Trace::Stage_CaptureConverted, stages_[1].stage_);
+  EXPECT_EQ(100, stages_[1].sincePreviousUs_);
+  EXPECT_EQ(Trace::Stage_CaptureDelivered, stages_[2].stage_);
+  EXPECT_EQ(100, stages_[2].sincePreviousUs_);
+  EXPECT_EQ(200, stages_[2].sinceFirstUs_);
+
+  EXPECT_EQ(0u, collector_.histogram(Trace::Stage_CaptureSample).total_);
+  EXPECT_EQ(1u, collector_.histogram(Trace::Stage_CaptureConverted).total_);
+  EXPECT_EQ(0u, collector_.histogram(Trace::Stage_RenderQueued).total_);
+
+  // stages skipped by a frame are left out of its latencies
+  Collector::record(*ring, 8, Trace::Stage_RenderResponded, 1700);
+  collector_.collect();
+  EXPECT_EQ((std::vector<Collector::FrameId> {7, 8}), publishedFrames());
+  EXPECT_EQ(400, stages_.back().sincePreviousUs_);
+  EXPECT_EQ(1u, collector_.histogram(Trace::Stage_RenderResponded).total_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, AssemblesFramesAcrossThreads)
+{
+  auto captureRing = collector_.createRing();
+  Collector::record(*captureRing, 1, Trace::Stage_CaptureSample, 1000);
+
+  std::thread deliverer([this]() {
+    auto ring = collector_.createRing();
+    Collector::record(*ring, 1, Trace::Stage_CaptureForwarded, 1250);
+    Collector::record(*ring, 1, Trace::Stage_CaptureDelivered, 1500);
+  });
+  deliverer.join();
+
+  collector_.collect();
+  ASSERT_EQ(3u, stages_.size());
+  EXPECT_EQ(250, stages_[1].sincePreviousUs_);
+  EXPECT_EQ(500, stages_[2].sinceFirstUs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, LappedRecordsAreLost)
+{
+  auto ring = collector_.createRing();
+
+  // 301 records; the oldest one still in the ring is skipped too, as the
+  // writer may be overwriting it, so the first 46 are lost
+  for (Collector::FrameId frameId = 1; frameId <= 100; ++frameId) {
+    captureFrame(*ring, frameId, static_cast<int64_t>(frameId) * 1000, 10);
+  }
+  Collector::record(*ring, 200, Trace::Stage_RenderReceived, 200000);
+  collector_.collect();
+
+  // frame 16 lost its first stage and its latencies start after it
+  auto frames = publishedFrames();
+  ASSERT_EQ(85u, frames.size());
+  EXPECT_EQ(16u, frames.front());
+  EXPECT_EQ(100u, frames.back());
+  EXPECT_EQ(Trace::Stage_CaptureConverted, stages_[0].stage_);
+  EXPECT_EQ(0, stages_[0].sinceFirstUs_);
+  EXPECT_EQ(10, stages_[1].sinceFirstUs_);
+
+  EXPECT_EQ(84u, collector_.histogram(Trace::Stage_CaptureConverted).total_);
+  EXPECT_EQ(85u, collector_.histogram(Trace::Stage_CaptureDelivered).total_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, ForgetsTheOldestIncompleteFrames)
+{
+  auto ring = collector_.createRing();
+  const Collector::FrameId frames = Collector::kMaxPendingFrames + 6;
+  for (Collector::FrameId frameId = 1; frameId <= frames; ++frameId) {
+    Collector::record(*ring, frameId, Trace::Stage_CaptureSample, 1000);
+  }
+  collector_.collect();
+  EXPECT_TRUE(stages_.empty());
+
+  // the first frame's start was forgotten, the last one's was kept
+  Collector::record(*ring, 1, Trace::Stage_CaptureDelivered, 2000);
+  Collector::record(*ring, frames, Trace::Stage_CaptureDelivered, 2000);
+  collector_.collect();
+
+  ASSERT_EQ(3u, stages_.size());
+  EXPECT_EQ(1u, stages_[0].frameId_);
+  EXPECT_EQ(Trace::Stage_CaptureDelivered, stages_[0].stage_);
+  EXPECT_EQ(frames, stages_[2].frameId_);
+  EXPECT_EQ(1000, stages_[2].sincePreviousUs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, SummarizesPeriodically)
+{
+  const uint64_t summaryFrames = Collector::kSummaryFrames;
+  auto ring = collector_.createRing();
+  Collector::FrameId frameId = 0;
+  for (uint64_t frame = 0; frame < (2 * summaryFrames) + 10; ++frame) {
+    captureFrame(*ring, ++frameId, 1000, 100);
+    collector_.collect();
+  }
+
+  ASSERT_EQ(2u, summaries_.size());
+  EXPECT_EQ(summaryFrames, summaries_[0].total_);
+  EXPECT_EQ(2 * summaryFrames, summaries_[1].total_);
+  EXPECT_EQ(100, summaries_[1].percentileUs(0.5));
+
+  collector_.resetHistograms();
+  EXPECT_EQ(0u, collector_.histogram(Trace::Stage_CaptureConverted).total_);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(VideoFrameTraceCollectorTest, CollectsWhileTheWriterLapsTheRing)
+{
+  const Collector::FrameId frames = 200000;
+  std::atomic<bool> done {false};
+
+  // every stage's time identifies its frame, so a record torn by the writer
+  // shows up as a latency no frame has
+  std::thread writer([this, &done, frames]() {
+    auto ring = collector_.createRing();
+    for (Collector::FrameId frameId = 1; frameId <= frames; ++frameId) {
+      captureFrame(*ring, frameId, static_cast<int64_t>(frameId) * 1000, 10);
+    }
+    done = true;
+  });
+
+  while (!done) {
+    collector_.collect();
+  }
+  writer.join();
+  collector_.collect();
+
+  ASSERT_FALSE(stages_.empty());
+  for (auto &stage : stages_) {
+    ASSERT_LE(stage.sinceFirstUs_, 20);
+    ASSERT_GE(stage.sinceFirstUs_, 0);
+  }
+  EXPECT_EQ(frames, stages_.back().frameId_);
+}
@@ -0,0 +1,200 @@
+
+#include <wrapper/impl_webrtc_VideoLatencyProbe.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+using namespace webrtc;
+
+namespace
+{
+  const int64_t kCaptureNtpMs = 3800000000000;
+
+  VideoLatencyProbePtr createEnabled()
+  {
+    auto probe = VideoLatencyProbe::create();
+    probe->setEnabled(true);
+    return probe;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, MeasuresNothingWhileDisabled)
+{
+  auto probe = VideoLatencyProbe::create();
+  probe->onFrameDelivered(kCaptureNtpMs, kCaptureNtpMs + 30);
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 40);
+
+  auto stats = probe->stats();
+  EXPECT_EQ(0u, stats.delivered_);
+  EXPECT_EQ(0u, stats.rendered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, SplitsLatencyAtTheTrack)
+{
+  auto probe = createEnabled();
+
+  probe->onFrameDelivered(kCaptureNtpMs, kCaptureNtpMs + 30);
+  auto stats = probe->stats();
+  EXPECT_EQ(1u, stats.delivered_);
+  EXPECT_EQ(30, stats.lastDeliveryMs_);
+  EXPECT_EQ(0u, stats.rendered_);
+
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 45);
+  stats = probe->stats();
+  EXPECT_EQ(1u, stats.rendered_);
+  EXPECT_EQ(kCaptureNtpMs, stats.lastRendered_.captureNtpMs_);
+  EXPECT_EQ(30, stats.lastRendered_.deliveryMs_);
+  EXPECT_EQ(15, stats.lastRendered_.renderMs_);
+  EXPECT_EQ(45, stats.lastRendered_.totalMs_);
+  EXPECT_EQ(45, stats.maxTotalMs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, AveragesEveryFrame)
+{
+  auto probe = createEnabled();
+
+  // delivery takes 20, 40 and 60 ms and rendering 10, 10 and 40 ms
+  for (int64_t index = 0; index < 3; ++index) {
+    const int64_t captureNtpMs = kCaptureNtpMs + (index * 33);
+    probe->onFrameDelivered(captureNtpMs, captureNtpMs + 20 + (index * 20));
+    probe->onFrameRendered(captureNtpMs, captureNtpMs + 30 + (index * 20) + (2 == index ? 30 : 0));
+  }
+
+  auto stats = probe->stats();
+  EXPECT_EQ(3u, stats.delivered_);
+  EXPECT_EQ(3u, stats.rendered_);
+  EXPECT_DOUBLE_EQ(40.0, stats.averageDeliveryMs_);
+  EXPECT_DOUBLE_EQ(20.0, stats.averageRenderMs_);
+  EXPECT_DOUBLE_EQ(60.0, stats.averageTotalMs_);
+  EXPECT_EQ(100, stats.maxTotalMs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, IgnoresFramesWithoutACaptureTime)
+{
+  auto probe = createEnabled();
+
+  probe->onFrameDelivered(0, kCaptureNtpMs);
+  probe->onFrameRendered(0, kCaptureNtpMs + 10);
+  probe->onFrameDelivered(-1, kCaptureNtpMs);
+
+  auto stats = probe->stats();
+  EXPECT_EQ(0u, stats.delivered_);
+  EXPECT_EQ(0u, stats.rendered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, ClockSkewNeverGivesNegativeLatency)
+{
+  auto probe = createEnabled();
+
+  // the sender report estimate puts the capture after the frame arrived
+  probe->onFrameDelivered(kCaptureNtpMs, kCaptureNtpMs - 5);
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs - 5);
+
+  auto stats = probe->stats();
+  EXPECT_EQ(0, stats.lastDeliveryMs_);
+  EXPECT_EQ(0, stats.lastRendered_.deliveryMs_);
+  EXPECT_EQ(0, stats.lastRendered_.renderMs_);
+  EXPECT_EQ(0, stats.lastRendered_.totalMs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, FramesDroppedBeforeRenderingAreForgotten)
+{
+  auto probe = createEnabled();
+
+  for (int64_t index = 0; index < 3; ++index) {
+    probe->onFrameDelivered(kCaptureNtpMs + index, kCaptureNtpMs + 20 + index);
+  }
+
+  // the render queue kept only the newest frame
+  probe->onFrameRendered(kCaptureNtpMs + 2, kCaptureNtpMs + 50);
+  EXPECT_EQ(1u, probe->stats().rendered_);
+
+  // so frames ahead of it are never rendered later
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 60);
+  probe->onFrameRendered(kCaptureNtpMs + 2, kCaptureNtpMs + 60);
+
+  auto stats = probe->stats();
+  EXPECT_EQ(3u, stats.delivered_);
+  EXPECT_EQ(1u, stats.rendered_);
+  EXPECT_EQ(kCaptureNtpMs + 2, stats.lastRendered_.captureNtpMs_);
+  EXPECT_EQ(28, stats.lastRendered_.renderMs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, RemembersALimitedNumberOfPendingFrames)
+{
+  auto probe = createEnabled();
+
+  for (int64_t index = 0; index <= static_cast<int64_t>(VideoLatencyProbe::kMaxPending); ++index) {
+    probe->onFrameDelivered(kCaptureNtpMs + index, kCaptureNtpMs + 20 + index);
+  }
+
+  // the oldest frame was pushed out; the next is still known
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 100);
+  EXPECT_EQ(0u, probe->stats().rendered_);
+  probe->onFrameRendered(kCaptureNtpMs + 1, kCaptureNtpMs + 100);
+  EXPECT_EQ(1u, probe->stats().rendered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, EnablingAgainRestarts)
+{
+  auto probe = createEnabled();
+  probe->onFrameDelivered(kCaptureNtpMs, kCaptureNtpMs + 30);
+
+  // enabling an enabled probe keeps what it measured
+  probe->setEnabled(true);
+  EXPECT_EQ(1u, probe->stats().delivered_);
+
+  probe->setEnabled(false);
+  probe->setEnabled(true);
+  EXPECT_EQ(0u, probe->stats().delivered_);
+
+  // nor is a frame delivered before the restart matched
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 40);
+  EXPECT_EQ(0u, probe->stats().rendered_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, ReportsTheCaptureTimeOnTheServerClock)
+{
+  auto probe = createEnabled();
+  const int64_t ntpOffsetMs = -1250;
+
+  // nothing rendered, nothing to move
+  EXPECT_EQ(0, probe->stats(ntpOffsetMs).lastRendered_.captureTimeMs_);
+
+  probe->onFrameDelivered(kCaptureNtpMs, kCaptureNtpMs + 30);
+  probe->onFrameRendered(kCaptureNtpMs, kCaptureNtpMs + 45);
+
+  auto local = probe->stats();
+  EXPECT_EQ(kCaptureNtpMs, local.lastRendered_.captureTimeMs_);
+
+  auto server = probe->stats(ntpOffsetMs);
+  EXPECT_EQ(kCaptureNtpMs, server.lastRendered_.captureNtpMs_);
+  EXPECT_EQ(kCaptureNtpMs + ntpOffsetMs, server.lastRendered_.captureTimeMs_);
+
+  // latencies are measured on one clock
+  EXPECT_EQ(local.lastRendered_.totalMs_, server.lastRendered_.totalMs_);
+  EXPECT_EQ(local.averageTotalMs_, server.averageTotalMs_);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoLatencyProbeTest, NtpOffsetIsTheServerClockAheadOfTheLocalOne)
+{
+  // the local clock moves on between the two reads
+  const int64_t aheadMs = VideoLatencyProbe::ntpOffsetMs(VideoLatencyProbe::currentNtpMs() + 5000);
+  EXPECT_LE(aheadMs, 5000);
+  EXPECT_GT(aheadMs, 4000);
+
+  const int64_t behindMs = VideoLatencyProbe::ntpOffsetMs(VideoLatencyProbe::currentNtpMs() - 5000);
+  EXPECT_LE(behindMs, -5000);
+  EXPECT_GT(behindMs, -6000);
+}
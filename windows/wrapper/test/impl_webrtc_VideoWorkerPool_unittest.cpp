@@ -0,0 +1,163 @@
+
+#include <wrapper/impl_webrtc_VideoWorkerPool.h>
+
+#include <wrapper/impl_org_webRtc_pre_include.h>
+#include "test/gtest.h"
+#include <wrapper/impl_org_webRtc_post_include.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace webrtc;
+
+namespace
+{
+  typedef std::vector< std::pair<int, int> > Bands;
+
+  Bands collectBands(int height, int minBandRows, bool parallel)
+  {
+    std::mutex mutex;
+    Bands bands;
+    VideoWorkerPool::forEachRowBand(height, minBandRows, parallel, [&](int firstRow, int rows) {
+      std::lock_guard<std::mutex> lock(mutex);
+      bands.emplace_back(firstRow, rows);
+    });
+    std::sort(bands.begin(), bands.end());
+    return bands;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, ReportsConcurrency)
+{
+  EXPECT_GE(VideoWorkerPool::concurrency(), 1);
+  EXPECT_LE(VideoWorkerPool::concurrency(), VideoWorkerPool::kMaxWorkers + 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, RunsEveryTaskOnceBeforeReturning)
+{
+  for (int count : {0, 1, 2, 3, 8, 33}) {
+    std::vector<std::atomic<int> > calls(count);
+    std::atomic<int> finished {0};
+
+    VideoWorkerPool::forEachTask(count, [&](int index) {
+      ASSERT_GE(index, 0);
+      ASSERT_LT(index, count);
+      std::this_thread::yield();
+      ++calls[index];
+      ++finished;
+    });
+
+    // every task has completed, not merely started, once the call returns
+    EXPECT_EQ(count, finished.load());
+    for (int index = 0; index < count; ++index) {
+      EXPECT_EQ(1, calls[index].load()) << "index " << index;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, RunsTheFirstTaskOnTheCallingThread)
+{
+  for (int count : {1, 2, 5}) {
+    std::thread::id first;
+    VideoWorkerPool::forEachTask(count, [&](int index) {
+      if (0 == index) first = std::this_thread::get_id();
+    });
+    EXPECT_EQ(std::this_thread::get_id(), first);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, WritesOfTasksAreVisibleAfterReturning)
+{
+  std::vector<int> results(64);
+  for (int round = 0; round < 200; ++round) {
+    VideoWorkerPool::forEachTask(static_cast<int>(results.size()), [&](int index) {
+      results[index] = round * 1000 + index;
+    });
+    for (int index = 0; index < static_cast<int>(results.size()); ++index) {
+      ASSERT_EQ(round * 1000 + index, results[index]);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, RowBandsCoverEveryRowOnceInEvenBands)
+{
+  for (int height : {1, 2, 17, 269, 540, 720, 1079, 1080, 2160}) {
+    for (bool parallel : {false, true}) {
+      auto bands = collectBands(height, 270, parallel);
+      ASSERT_FALSE(bands.empty());
+
+      // contiguous from the top row to the bottom row
+      int nextRow = 0;
+      for (size_t index = 0; index < bands.size(); ++index) {
+        EXPECT_EQ(nextRow, bands[index].first) << "height " << height << " band " << index;
+        EXPECT_GT(bands[index].second, 0);
+        EXPECT_EQ(0, bands[index].first % 2) << "height " << height << " band " << index;
+        nextRow = bands[index].first + bands[index].second;
+      }
+      EXPECT_EQ(height, nextRow);
+
+      // every band but the last holds an even number of rows
+      for (size_t index = 0; index + 1 < bands.size(); ++index) {
+        EXPECT_EQ(0, bands[index].second % 2);
+      }
+
+      EXPECT_LE(static_cast<int>(bands.size()), VideoWorkerPool::concurrency());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, ConvertsSmallOrSerialFramesInOneBand)
+{
+  // serial, too short for two bands of the minimum, or banding disabled
+  EXPECT_EQ(Bands({ {0, 1080} }), collectBands(1080, 270, false));
+  EXPECT_EQ(Bands({ {0, 539} }), collectBands(539, 270, true));
+  EXPECT_EQ(Bands({ {0, 1080} }), collectBands(1080, 0, true));
+
+  const int bands = std::min(VideoWorkerPool::concurrency(), 1080 / 270);
+  EXPECT_EQ(static_cast<size_t>(bands), collectBands(1080, 270, true).size());
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, ConcurrentCallersAllComplete)
+{
+  // several capturers converting at once share the pool; each caller helps
+  // drain the queue so none of them waits on another's frame
+  std::atomic<int> total {0};
+  std::vector<std::thread> callers;
+  for (int caller = 0; caller < 4; ++caller) {
+    callers.emplace_back([&]() {
+      for (int frame = 0; frame < 200; ++frame) {
+        std::atomic<int> done {0};
+        VideoWorkerPool::forEachTask(6, [&](int) {
+          ++done;
+          ++total;
+        });
+        ASSERT_EQ(6, done.load());
+      }
+    });
+  }
+  for (auto &caller : callers) caller.join();
+
+  EXPECT_EQ(4 * 200 * 6, total.load());
+}
+
+//-----------------------------------------------------------------------------
+TEST(VideoWorkerPoolTest, NestedCallsComplete)
+{
+  // a task may itself split work, e.g. a band converting planes in parallel
+  std::atomic<int> inner {0};
+  VideoWorkerPool::forEachTask(4, [&](int) {
+    VideoWorkerPool::forEachTask(4, [&](int) { ++inner; });
+  });
+  EXPECT_EQ(16, inner.load());
+}
@@ -23,6 +23,9 @@ namespace wrapper {
         ZS_DECLARE_STRUCT_PTR(AudioProcessingInitializeEvent);
         ZS_DECLARE_STRUCT_PTR(AudioProcessingRuntimeSettingEvent);
         ZS_DECLARE_STRUCT_PTR(AudioTrackSource);
+        ZS_DECLARE_STRUCT_PTR(AudioTrackSourcePushOptions);
+        ZS_DECLARE_STRUCT_PTR(AudioTrackSourcePushStats);
+        ZS_DECLARE_STRUCT_PTR(ByteBuffer);
         ZS_DECLARE_STRUCT_PTR(Constraint);
         ZS_DECLARE_STRUCT_PTR(EventQueue);
         ZS_DECLARE_STRUCT_PTR(EventQueueMaker);
@@ -32,6 +35,11 @@ namespace wrapper {
         ZS_DECLARE_STRUCT_PTR(MediaSample);
         ZS_DECLARE_STRUCT_PTR(MediaSource);
         ZS_DECLARE_STRUCT_PTR(MediaStreamTrack);
+        ZS_DECLARE_STRUCT_PTR(MediaStreamTrackLatencyStats);
+        ZS_DECLARE_STRUCT_PTR(MediaStreamTrackRenderOptions);
+        ZS_DECLARE_STRUCT_PTR(MediaStreamTrackRenderStats);
+        ZS_DECLARE_STRUCT_PTR(MediaStreamTrackVideoFrameOptions);
+        ZS_DECLARE_STRUCT_PTR(MediaStreamTrackVideoFrameStats);
         ZS_DECLARE_STRUCT_PTR(MediaTrackSource);
         ZS_DECLARE_STRUCT_PTR(MessageEvent);
         ZS_DECLARE_STRUCT_PTR(MillisecondIntervalRange);
@@ -47,6 +55,8 @@ namespace wrapper {
         ZS_DECLARE_STRUCT_PTR(RTCDataChannel);
         ZS_DECLARE_STRUCT_PTR(RTCDataChannelEvent);
         ZS_DECLARE_STRUCT_PTR(RTCDataChannelInit);
+        ZS_DECLARE_STRUCT_PTR(RTCDataChannelSendQueueOptions);
+        ZS_DECLARE_STRUCT_PTR(RTCDataChannelSendQueueStats);
         ZS_DECLARE_STRUCT_PTR(RTCDataChannelStats);
         ZS_DECLARE_STRUCT_PTR(RTCDtlsFingerprint);
         ZS_DECLARE_STRUCT_PTR(RTCDtmfSender);
@@ -111,7 +121,14 @@ namespace wrapper {
         ZS_DECLARE_STRUCT_PTR(RTCVideoReceiverStats);
         ZS_DECLARE_STRUCT_PTR(RTCVideoSenderStats);
         ZS_DECLARE_STRUCT_PTR(VideoCapturer);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerBufferPoolStats);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerChangeDetection);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerChangeStats);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerCrop);
         ZS_DECLARE_STRUCT_PTR(VideoCapturerInputSize);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerLoadAdaptation);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerLoadStats);
+        ZS_DECLARE_STRUCT_PTR(VideoCapturerSharingStats);
         ZS_DECLARE_STRUCT_PTR(VideoData);
         ZS_DECLARE_STRUCT_PTR(VideoDeviceInfo);
         ZS_DECLARE_STRUCT_PTR(VideoFormat);
@@ -120,7 +137,9 @@ namespace wrapper {
         ZS_DECLARE_STRUCT_PTR(VideoFrameNativeBuffer);
         ZS_DECLARE_STRUCT_PTR(VideoFramePlanarYuvBuffer);
         ZS_DECLARE_STRUCT_PTR(VideoFramePlanarYuvaBuffer);
+        ZS_DECLARE_STRUCT_PTR(VideoFramePlanes);
         ZS_DECLARE_STRUCT_PTR(VideoOptions);
+        ZS_DECLARE_STRUCT_PTR(VideoSinkWants);
         ZS_DECLARE_STRUCT_PTR(VideoTrackSource);
         ZS_DECLARE_STRUCT_PTR(VideoTrackSourceStats);
         ZS_DECLARE_STRUCT_PTR(WebRtcFactory);